@@ -0,0 +1,169 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// CPU benchmark of a halo exchange pipeline on an n x n grid: pack the
+/// boundary rows and columns into a buffer, copy it to a receive buffer,
+/// unpack it into the ghost cells, and update the interior, which does not
+/// depend on the halo. pipeline_sync runs the four loops one after the
+/// other; pipeline_async runs pack, copy and unpack on one host_resource
+/// and the interior update on another, so the time per step is the longer
+/// of the two chains rather than their sum.
+///
+
+#include "cpu-benchmark.hpp"
+
+#include <vector>
+
+namespace
+{
+
+//! halo width in cells
+constexpr RAJA::Index_type halo = 4;
+
+struct grid {
+  RAJA::Index_type n;
+  RAJA::Index_type nhalo;
+  double* u;
+  double* unew;
+  double* send;
+  double* recv;
+
+  template <typename ExecPolicy>
+  grid(RAJA::Index_type n_, ExecPolicy)
+      : n(n_),
+        nhalo(4 * halo * n_),
+        u(bench::allocate<ExecPolicy>(n_ * n_, 1.0)),
+        unew(bench::allocate<ExecPolicy>(n_ * n_, 0.0)),
+        send(bench::allocate<ExecPolicy>(nhalo, 0.0)),
+        recv(bench::allocate<ExecPolicy>(nhalo, 0.0))
+  {
+  }
+
+  ~grid()
+  {
+    bench::deallocate(u);
+    bench::deallocate(unew);
+    bench::deallocate(send);
+    bench::deallocate(recv);
+  }
+
+  //! grid offset of halo cell h: halo rows top and bottom, then columns
+  static RAJA::Index_type cell(RAJA::Index_type n, RAJA::Index_type h)
+  {
+    const RAJA::Index_type side = halo * n;
+    const RAJA::Index_type s = h / side;
+    const RAJA::Index_type k = h % side;
+    const RAJA::Index_type a = k / n;
+    const RAJA::Index_type b = k % n;
+    switch (s) {
+      case 0:
+        return a * n + b;
+      case 1:
+        return (n - 1 - a) * n + b;
+      case 2:
+        return b * n + a;
+      default:
+        return b * n + (n - 1 - a);
+    }
+  }
+};
+
+template <typename ExecPolicy>
+RAJA::event pack(RAJA::host_resource& res, grid const& g)
+{
+  const RAJA::Index_type n = g.n;
+  const double* u = g.u;
+  double* send = g.send;
+  return RAJA::forall<ExecPolicy>(res,
+                                  RAJA::RangeSegment(0, g.nhalo),
+                                  [=](RAJA::Index_type h) {
+                                    send[h] = u[grid::cell(n, h)];
+                                  });
+}
+
+template <typename ExecPolicy>
+RAJA::event exchange(RAJA::host_resource& res, grid const& g)
+{
+  const double* send = g.send;
+  double* recv = g.recv;
+  return RAJA::forall<ExecPolicy>(res,
+                                  RAJA::RangeSegment(0, g.nhalo),
+                                  [=](RAJA::Index_type h) {
+                                    recv[h] = send[h];
+                                  });
+}
+
+template <typename ExecPolicy>
+RAJA::event unpack(RAJA::host_resource& res, grid const& g)
+{
+  const RAJA::Index_type n = g.n;
+  const double* recv = g.recv;
+  double* unew = g.unew;
+  return RAJA::forall<ExecPolicy>(res,
+                                  RAJA::RangeSegment(0, g.nhalo),
+                                  [=](RAJA::Index_type h) {
+                                    unew[grid::cell(n, h)] = recv[h];
+                                  });
+}
+
+template <typename ExecPolicy>
+RAJA::event interior(RAJA::host_resource& res, grid const& g)
+{
+  const RAJA::Index_type n = g.n;
+  const double* u = g.u;
+  double* unew = g.unew;
+  return RAJA::forall<ExecPolicy>(
+      res, RAJA::RangeSegment(halo, n - halo), [=](RAJA::Index_type j) {
+        for (RAJA::Index_type i = halo; i < n - halo; ++i) {
+          unew[j * n + i] = 0.25 * (u[j * n + i - 1] + u[j * n + i + 1] +
+                                    u[(j - 1) * n + i] + u[(j + 1) * n + i]);
+        }
+      });
+}
+
+}  // namespace
+
+template <typename ExecPolicy>
+static void pipeline_sync(benchmark::State& state)
+{
+  grid g(RAJA::Index_type(state.range(0)), ExecPolicy{});
+  RAJA::host_resource res;
+
+  while (state.KeepRunning()) {
+    pack<ExecPolicy>(res, g);
+    exchange<ExecPolicy>(res, g);
+    unpack<ExecPolicy>(res, g);
+    interior<ExecPolicy>(res, g).wait();
+  }
+
+  bench::set_rates(state, g.n * g.n, 2 * sizeof(double), 1);
+}
+
+template <typename ExecPolicy>
+static void pipeline_async(benchmark::State& state)
+{
+  grid g(RAJA::Index_type(state.range(0)), ExecPolicy{});
+  RAJA::host_resource comm, comp;
+
+  while (state.KeepRunning()) {
+    pack<ExecPolicy>(comm, g);
+    exchange<ExecPolicy>(comm, g);
+    RAJA::event halo_done = unpack<ExecPolicy>(comm, g);
+    interior<ExecPolicy>(comp, g).wait();
+    halo_done.wait();
+  }
+
+  bench::set_rates(state, g.n * g.n, 2 * sizeof(double), 1);
+}
+
+BENCHMARK_TEMPLATE(pipeline_sync, RAJA::seq_exec)->Apply(bench::grid_sizes);
+BENCHMARK_TEMPLATE(pipeline_async, RAJA::seq_exec)->Apply(bench::grid_sizes);
+BENCHMARK_TEMPLATE(pipeline_sync, RAJA::loop_exec)->Apply(bench::grid_sizes);
+BENCHMARK_TEMPLATE(pipeline_async, RAJA::loop_exec)->Apply(bench::grid_sizes);
+
+BENCHMARK_MAIN();
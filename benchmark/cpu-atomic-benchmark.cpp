@@ -0,0 +1,53 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// CPU benchmarks of RAJA atomics: a histogram built with atomicAdd, with
+/// the atomic policy matching the execution policy. The number of bins
+/// (second argument) sets the contention, from one shared counter to
+/// mostly private ones.
+///
+
+#include "cpu-benchmark.hpp"
+
+template <typename ExecPolicy>
+static void atomic_histogram(benchmark::State& state)
+{
+  using atomic_policy = typename bench::policies<ExecPolicy>::atomic;
+  const RAJA::Index_type n = state.range(0);
+  const RAJA::Index_type bins = state.range(1);
+
+  int* bin = bench::allocate<ExecPolicy>(n, 0);
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n), [=](RAJA::Index_type i) {
+    bin[i] = static_cast<int>((i * 2654435761u) % bins);
+  });
+  double* hist = bench::allocate<RAJA::seq_exec>(bins, 0.0);
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n), [=](RAJA::Index_type i) {
+      RAJA::atomicAdd<atomic_policy>(&hist[bin[i]], 1.0);
+    });
+    benchmark::ClobberMemory();
+  }
+
+  bench::set_rates(state, n, sizeof(int) + 2 * sizeof(double), 1);
+  bench::deallocate(bin);
+  bench::deallocate(hist);
+}
+
+static void histogram_sizes(benchmark::internal::Benchmark* b)
+{
+  for (int bins : {1, 64, 4096}) {
+    b->Args({1 << 16, bins});
+    b->Args({1 << 22, bins});
+  }
+  b->UseRealTime();
+}
+
+RAJA_CPU_BENCHMARK(atomic_histogram, histogram_sizes);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,152 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Common pieces of the CPU benchmark suite: the policies each benchmark is
+/// run with, aligned allocation, and bytes/s and flops/s reporting.
+///
+/// A benchmark is a function template on a forall execution policy,
+/// registered for every enabled CPU back end with RAJA_CPU_BENCHMARK.
+///
+
+#ifndef RAJA_BENCHMARK_CPU_BENCHMARK_HPP
+#define RAJA_BENCHMARK_CPU_BENCHMARK_HPP
+
+#include <cstdint>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+namespace bench
+{
+
+//! reduction and atomic policies matching a forall execution policy
+template <typename ExecPolicy>
+struct policies {
+  using reduce = RAJA::seq_reduce;
+  using deterministic_reduce = RAJA::seq_reduce_deterministic;
+  using atomic = RAJA::seq_atomic;
+};
+
+#if defined(RAJA_ENABLE_OPENMP)
+template <>
+struct policies<RAJA::omp_parallel_for_exec> {
+  using reduce = RAJA::omp_reduce;
+  using deterministic_reduce = RAJA::omp_reduce_deterministic;
+  using atomic = RAJA::omp_atomic;
+};
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+template <>
+struct policies<RAJA::tbb_for_exec> {
+  using reduce = RAJA::tbb_reduce;
+  using deterministic_reduce = RAJA::tbb_reduce_deterministic;
+  using atomic = RAJA::builtin_atomic;
+};
+#endif
+
+#if defined(RAJA_ENABLE_THREADS)
+template <>
+struct policies<RAJA::threads_for_exec> {
+  using reduce = RAJA::threads_reduce;
+  // copies merge under a lock, so this is safe from pool threads
+  using deterministic_reduce = RAJA::seq_reduce_deterministic;
+  using atomic = RAJA::builtin_atomic;
+};
+#endif
+
+//! page-aligned array of n values, first touched by ExecPolicy
+template <typename ExecPolicy, typename T>
+T* allocate(RAJA::Index_type n, T value)
+{
+  return RAJA::allocate_first_touch<T>(ExecPolicy{}, n, value);
+}
+
+template <typename T>
+void deallocate(T* ptr)
+{
+  RAJA::free_aligned(ptr);
+}
+
+//! report items/s, bytes/s and flops/s for elems elements per iteration
+inline void set_rates(benchmark::State& state,
+                      double elems,
+                      double bytes_per_elem,
+                      double flops_per_elem)
+{
+  const double iters = static_cast<double>(state.iterations());
+  state.SetItemsProcessed(static_cast<int64_t>(iters * elems));
+  state.SetBytesProcessed(static_cast<int64_t>(iters * elems * bytes_per_elem));
+  state.counters["flops"] = benchmark::Counter(iters * elems * flops_per_elem,
+                                               benchmark::Counter::kIsRate);
+}
+
+//! 1D problem sizes, from in-cache to memory bound
+inline void vector_sizes(benchmark::internal::Benchmark* b)
+{
+  b->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+  b->UseRealTime();
+}
+
+//! loop lengths from a single iteration up, where launch cost dominates
+inline void launch_sizes(benchmark::internal::Benchmark* b)
+{
+  b->RangeMultiplier(8)->Range(1, 1 << 18);
+  b->UseRealTime();
+}
+
+//! 2D and 3D problem extents
+inline void grid_sizes(benchmark::internal::Benchmark* b)
+{
+  b->RangeMultiplier(4)->Range(64, 4096);
+  b->UseRealTime();
+}
+
+inline void cube_sizes(benchmark::internal::Benchmark* b)
+{
+  b->RangeMultiplier(2)->Range(16, 256);
+  b->UseRealTime();
+}
+
+}  // namespace bench
+
+#define RAJA_CPU_BENCHMARK_SEQ(func, sizes)                  \
+  BENCHMARK_TEMPLATE(func, RAJA::seq_exec)->Apply(sizes);    \
+  BENCHMARK_TEMPLATE(func, RAJA::loop_exec)->Apply(sizes);   \
+  BENCHMARK_TEMPLATE(func, RAJA::simd_exec)->Apply(sizes)
+
+#if defined(RAJA_ENABLE_OPENMP)
+#define RAJA_CPU_BENCHMARK_OMP(func, sizes) \
+  BENCHMARK_TEMPLATE(func, RAJA::omp_parallel_for_exec)->Apply(sizes)
+#else
+#define RAJA_CPU_BENCHMARK_OMP(func, sizes) static_assert(true, "")
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+#define RAJA_CPU_BENCHMARK_TBB(func, sizes) \
+  BENCHMARK_TEMPLATE(func, RAJA::tbb_for_exec)->Apply(sizes)
+#else
+#define RAJA_CPU_BENCHMARK_TBB(func, sizes) static_assert(true, "")
+#endif
+
+#if defined(RAJA_ENABLE_THREADS)
+#define RAJA_CPU_BENCHMARK_THREADS(func, sizes) \
+  BENCHMARK_TEMPLATE(func, RAJA::threads_for_exec)->Apply(sizes)
+#else
+#define RAJA_CPU_BENCHMARK_THREADS(func, sizes) static_assert(true, "")
+#endif
+
+//! register func<ExecPolicy> for every enabled CPU forall policy
+#define RAJA_CPU_BENCHMARK(func, sizes) \
+  RAJA_CPU_BENCHMARK_SEQ(func, sizes);  \
+  RAJA_CPU_BENCHMARK_OMP(func, sizes);  \
+  RAJA_CPU_BENCHMARK_TBB(func, sizes);  \
+  RAJA_CPU_BENCHMARK_THREADS(func, sizes)
+
+#endif  // closing endif for header file include guard
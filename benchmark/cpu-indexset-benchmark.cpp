@@ -0,0 +1,83 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// CPU benchmarks of IndexSet traversal: daxpy over an index set that
+/// alternates stride-1 range segments and list segments, with segments run
+/// one after another and the execution policy under test inside each
+/// segment. With OpenMP the segments are also run in parallel.
+///
+
+#include <vector>
+
+#include "cpu-benchmark.hpp"
+
+#define SEGMENT 4096
+
+static RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>
+make_index_set(RAJA::Index_type n)
+{
+  RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment> iset;
+  std::vector<RAJA::Index_type> list;
+  for (RAJA::Index_type begin = 0, seg = 0; begin < n;
+       begin += SEGMENT, ++seg) {
+    const RAJA::Index_type end = std::min(begin + SEGMENT, n);
+    if (seg % 2 == 0) {
+      iset.push_back(RAJA::RangeSegment(begin, end));
+    } else {
+      // every index of the block, in reverse order
+      list.clear();
+      for (RAJA::Index_type i = end - 1; i >= begin; --i) {
+        list.push_back(i);
+      }
+      iset.push_back(RAJA::ListSegment(&list[0], list.size()));
+    }
+  }
+  return iset;
+}
+
+template <typename IndexSetPolicy, typename ExecPolicy>
+static void run_indexset(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  double* x = bench::allocate<ExecPolicy>(n, 1.0);
+  double* y = bench::allocate<ExecPolicy>(n, 2.0);
+  const double a = 0.5;
+  auto iset = make_index_set(n);
+
+  while (state.KeepRunning()) {
+    RAJA::forall<IndexSetPolicy>(iset,
+                                 [=](RAJA::Index_type i) { y[i] += a * x[i]; });
+    benchmark::ClobberMemory();
+  }
+
+  bench::set_rates(state, n, 3 * sizeof(double), 2);
+  bench::deallocate(x);
+  bench::deallocate(y);
+}
+
+template <typename ExecPolicy>
+static void indexset_seq_segit(benchmark::State& state)
+{
+  run_indexset<RAJA::ExecPolicy<RAJA::seq_segit, ExecPolicy>, ExecPolicy>(
+      state);
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+static void indexset_omp_segit(benchmark::State& state)
+{
+  run_indexset<RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::seq_exec>,
+               RAJA::omp_parallel_for_exec>(state);
+}
+#endif
+
+RAJA_CPU_BENCHMARK(indexset_seq_segit, bench::vector_sizes);
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK(indexset_omp_segit)->Apply(bench::vector_sizes);
+#endif
+
+BENCHMARK_MAIN();
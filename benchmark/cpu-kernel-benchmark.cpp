@@ -0,0 +1,439 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// CPU benchmarks of RAJA::kernel loop nests on an N x N grid: a 5-point
+/// Jacobi stencil run as a plain For nest, as a Tile nest with fixed and
+/// run-time tile sizes and (OpenMP) as a Collapse, and wavefront
+/// Gauss-Seidel sweeps (N x N and n x n x n) run with Hyperplane. The
+/// execution policy under test runs the outermost loop of For and Tile and
+/// the loop across each hyperplane, or all hyperplanes for the collapse
+/// policies; simd_exec only runs innermost loops, so it has its own nest.
+/// A sum of squares over the grid compares a captured reducer with a
+/// kernel parameter combined by statement::Reduce, and a transpose goes
+/// through LocalArray tiles of two sizes held in CPU tile memory. A two-step
+/// update of the grid runs as two loop nests and as one made by
+/// statement::Fuse. Only the policies with kernel executors for each
+/// statement are registered.
+///
+
+#include "cpu-benchmark.hpp"
+
+using grid_view = RAJA::View<double, RAJA::Layout<2>>;
+
+template <typename KernelPol>
+static void run_jacobi(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  double* in_data = bench::allocate<RAJA::seq_exec>(n * n, 1.0);
+  double* out_data = bench::allocate<RAJA::seq_exec>(n * n, 0.0);
+  grid_view in(in_data, n, n);
+  grid_view out(out_data, n, n);
+
+  RAJA::RangeSegment interior(1, n - 1);
+  while (state.KeepRunning()) {
+    RAJA::kernel<KernelPol>(RAJA::make_tuple(interior, interior),
+                            [=](RAJA::Index_type i, RAJA::Index_type j) {
+                              out(j, i) = 0.25 * (in(j, i - 1) + in(j, i + 1) +
+                                                  in(j - 1, i) + in(j + 1, i));
+                            });
+    benchmark::ClobberMemory();
+  }
+
+  bench::set_rates(state, (n - 2) * (n - 2), 2 * sizeof(double), 4);
+  bench::deallocate(in_data);
+  bench::deallocate(out_data);
+}
+
+template <typename ExecPolicy>
+static void kernel_for(benchmark::State& state)
+{
+  using namespace RAJA::statement;
+  using pol = RAJA::KernelPolicy<
+      For<1, ExecPolicy, For<0, RAJA::loop_exec, Lambda<0>>>>;
+  run_jacobi<pol>(state);
+}
+
+template <typename ExecPolicy>
+static void kernel_tile(benchmark::State& state)
+{
+  using namespace RAJA::statement;
+  using pol = RAJA::KernelPolicy<
+      Tile<1,
+           tile_fixed<16>,
+           ExecPolicy,
+           Tile<0,
+                tile_fixed<256>,
+                RAJA::loop_exec,
+                For<1,
+                    RAJA::loop_exec,
+                    For<0, RAJA::loop_exec, Lambda<0>>>>>>;
+  run_jacobi<pol>(state);
+}
+
+// the same tiles as kernel_tile, with sizes passed as kernel parameters
+template <typename ExecPolicy>
+static void kernel_tile_dynamic(benchmark::State& state)
+{
+  using namespace RAJA::statement;
+  using pol = RAJA::KernelPolicy<
+      Tile<1,
+           tile_dynamic<0>,
+           ExecPolicy,
+           Tile<0,
+                tile_dynamic<1>,
+                RAJA::loop_exec,
+                For<1,
+                    RAJA::loop_exec,
+                    For<0, RAJA::loop_exec, Lambda<0>>>>>>;
+
+  const RAJA::Index_type n = state.range(0);
+  double* in_data = bench::allocate<RAJA::seq_exec>(n * n, 1.0);
+  double* out_data = bench::allocate<RAJA::seq_exec>(n * n, 0.0);
+  grid_view in(in_data, n, n);
+  grid_view out(out_data, n, n);
+
+  RAJA::RangeSegment interior(1, n - 1);
+  while (state.KeepRunning()) {
+    RAJA::kernel_param<pol>(
+        RAJA::make_tuple(interior, interior),
+        RAJA::make_tuple(RAJA::Index_type(16), RAJA::Index_type(256)),
+        [=](RAJA::Index_type i, RAJA::Index_type j, RAJA::Index_type,
+            RAJA::Index_type) {
+          out(j, i) = 0.25 * (in(j, i - 1) + in(j, i + 1) + in(j - 1, i) +
+                              in(j + 1, i));
+        });
+    benchmark::ClobberMemory();
+  }
+
+  bench::set_rates(state, (n - 2) * (n - 2), 2 * sizeof(double), 4);
+  bench::deallocate(in_data);
+  bench::deallocate(out_data);
+}
+
+static void kernel_for_simd(benchmark::State& state)
+{
+  using namespace RAJA::statement;
+  using pol = RAJA::KernelPolicy<
+      For<1, RAJA::loop_exec, For<0, RAJA::simd_exec, Lambda<0>>>>;
+  run_jacobi<pol>(state);
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+static void kernel_collapse_omp(benchmark::State& state)
+{
+  using namespace RAJA::statement;
+  using pol = RAJA::KernelPolicy<Collapse<RAJA::omp_parallel_collapse_exec,
+                                          RAJA::ArgList<1, 0>,
+                                          Lambda<0>>>;
+  run_jacobi<pol>(state);
+}
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+static void kernel_collapse_tbb(benchmark::State& state)
+{
+  using namespace RAJA::statement;
+  using pol = RAJA::KernelPolicy<
+      Collapse<RAJA::tbb_collapse_exec, RAJA::ArgList<1, 0>, Lambda<0>>>;
+  run_jacobi<pol>(state);
+}
+
+static void kernel_tile_collapse_tbb(benchmark::State& state)
+{
+  using namespace RAJA::statement;
+  using pol = RAJA::KernelPolicy<Collapse<RAJA::tbb_tile_collapse_exec<16, 256>,
+                                          RAJA::ArgList<1, 0>,
+                                          Lambda<0>>>;
+  run_jacobi<pol>(state);
+}
+#endif
+
+template <typename ExecPolicy>
+static void kernel_hyperplane(benchmark::State& state)
+{
+  using namespace RAJA::statement;
+  // sequential over hyperplanes, ExecPolicy across each hyperplane
+  using pol = RAJA::KernelPolicy<Hyperplane<1,
+                                            RAJA::seq_exec,
+                                            RAJA::ArgList<0>,
+                                            ExecPolicy,
+                                            Lambda<0>>>;
+
+  const RAJA::Index_type n = state.range(0);
+  double* data = bench::allocate<RAJA::seq_exec>(n * n, 1.0);
+  grid_view x(data, n, n);
+
+  RAJA::RangeSegment interior(1, n);
+  while (state.KeepRunning()) {
+    RAJA::kernel<pol>(RAJA::make_tuple(interior, interior),
+                      [=](RAJA::Index_type i, RAJA::Index_type j) {
+                        x(j, i) = 0.5 * (x(j, i - 1) + x(j - 1, i));
+                      });
+    benchmark::ClobberMemory();
+  }
+
+  bench::set_rates(state, (n - 1) * (n - 1), 2 * sizeof(double), 2);
+  bench::deallocate(data);
+}
+
+template <typename ExecPolicy>
+static void kernel_hyperplane_3d(benchmark::State& state)
+{
+  using namespace RAJA::statement;
+  using pol = RAJA::KernelPolicy<Hyperplane<2,
+                                            RAJA::seq_exec,
+                                            RAJA::ArgList<1, 0>,
+                                            ExecPolicy,
+                                            Lambda<0>>>;
+
+  const RAJA::Index_type n = state.range(0);
+  double* data = bench::allocate<RAJA::seq_exec>(n * n * n, 1.0);
+  RAJA::View<double, RAJA::Layout<3>> x(data, n, n, n);
+
+  RAJA::RangeSegment interior(1, n);
+  while (state.KeepRunning()) {
+    RAJA::kernel<pol>(RAJA::make_tuple(interior, interior, interior),
+                      [=](RAJA::Index_type i,
+                          RAJA::Index_type j,
+                          RAJA::Index_type k) {
+                        x(k, j, i) = (x(k, j, i - 1) + x(k, j - 1, i) +
+                                      x(k - 1, j, i)) *
+                                     (1.0 / 3.0);
+                      });
+    benchmark::ClobberMemory();
+  }
+
+  bench::set_rates(state, (n - 1) * (n - 1) * (n - 1), 2 * sizeof(double), 3);
+  bench::deallocate(data);
+}
+
+// sum of squares over the grid with a reducer object captured by the body
+template <typename ExecPolicy>
+static void kernel_norm_reducer(benchmark::State& state)
+{
+  using namespace RAJA::statement;
+  using reduce_policy = typename bench::policies<ExecPolicy>::reduce;
+  using pol = RAJA::KernelPolicy<
+      For<1, ExecPolicy, For<0, RAJA::loop_exec, Lambda<0>>>>;
+
+  const RAJA::Index_type n = state.range(0);
+  double* data = bench::allocate<ExecPolicy>(n * n, 0.5);
+  grid_view x(data, n, n);
+
+  double total = 0.0;
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<reduce_policy, double> norm(0.0);
+    RAJA::kernel<pol>(RAJA::make_tuple(RAJA::RangeSegment(0, n),
+                                       RAJA::RangeSegment(0, n)),
+                      [=](RAJA::Index_type i, RAJA::Index_type j) {
+                        norm += x(j, i) * x(j, i);
+                      });
+    total += norm.get();
+  }
+  benchmark::DoNotOptimize(total);
+
+  bench::set_rates(state, n * n, sizeof(double), 2);
+  bench::deallocate(data);
+}
+
+// the same sum accumulated in a kernel parameter and combined by Reduce
+template <typename ExecPolicy>
+static void kernel_norm_statement(benchmark::State& state)
+{
+  using namespace RAJA::statement;
+  using reduce_policy = typename bench::policies<ExecPolicy>::reduce;
+  using pol = RAJA::KernelPolicy<
+      Reduce<reduce_policy,
+             RAJA::operators::plus,
+             Param<0>,
+             For<1, ExecPolicy, For<0, RAJA::loop_exec, Lambda<0>>>>,
+      Lambda<1>>;
+
+  const RAJA::Index_type n = state.range(0);
+  double* data = bench::allocate<ExecPolicy>(n * n, 0.5);
+  grid_view x(data, n, n);
+
+  double total = 0.0;
+  double* ptotal = &total;
+  while (state.KeepRunning()) {
+    RAJA::kernel_param<pol>(
+        RAJA::make_tuple(RAJA::RangeSegment(0, n), RAJA::RangeSegment(0, n)),
+        RAJA::make_tuple(0.0),
+        [=](RAJA::Index_type i, RAJA::Index_type j, double& norm) {
+          norm += x(j, i) * x(j, i);
+        },
+        [=](RAJA::Index_type, RAJA::Index_type, double& norm) {
+          *ptotal += norm;
+        });
+  }
+  benchmark::DoNotOptimize(total);
+
+  bench::set_rates(state, n * n, sizeof(double), 2);
+  bench::deallocate(data);
+}
+
+// transpose through a LocalArray tile initialized for each tile by
+// InitLocalMem: loads along rows of the input, stores along rows of the output
+template <typename ExecPolicy, RAJA::Index_type TileDim>
+static void kernel_transpose_local(benchmark::State& state)
+{
+  using namespace RAJA::statement;
+  using tile_mem = RAJA::LocalArray<double,
+                                    RAJA::Perm<0, 1>,
+                                    RAJA::SizeList<TileDim, TileDim>>;
+  using pol = RAJA::KernelPolicy<
+      Tile<1, tile_fixed<TileDim>, ExecPolicy,
+        Tile<0, tile_fixed<TileDim>, RAJA::loop_exec,
+          InitLocalMem<RAJA::cpu_tile_mem, RAJA::ParamList<2>,
+            ForICount<1, Param<0>, RAJA::loop_exec,
+              ForICount<0, Param<1>, RAJA::loop_exec, Lambda<0>>>,
+            ForICount<0, Param<1>, RAJA::loop_exec,
+              ForICount<1, Param<0>, RAJA::loop_exec, Lambda<1>>>>>>>;
+
+  const RAJA::Index_type n = state.range(0);
+  double* in_data = bench::allocate<ExecPolicy>(n * n, 1.0);
+  double* out_data = bench::allocate<ExecPolicy>(n * n, 0.0);
+  grid_view in(in_data, n, n);
+  grid_view out(out_data, n, n);
+
+  while (state.KeepRunning()) {
+    RAJA::kernel_param<pol>(
+        RAJA::make_tuple(RAJA::RangeSegment(0, n), RAJA::RangeSegment(0, n)),
+        RAJA::make_tuple(RAJA::Index_type(0), RAJA::Index_type(0), tile_mem()),
+        [=](RAJA::Index_type c,
+            RAJA::Index_type r,
+            RAJA::Index_type tr,
+            RAJA::Index_type tc,
+            tile_mem& t) { t(tr, tc) = in(r, c); },
+        [=](RAJA::Index_type c,
+            RAJA::Index_type r,
+            RAJA::Index_type tr,
+            RAJA::Index_type tc,
+            tile_mem& t) { out(c, r) = t(tr, tc); });
+    benchmark::ClobberMemory();
+  }
+
+  bench::set_rates(state, n * n, 2 * sizeof(double), 0);
+  bench::deallocate(in_data);
+  bench::deallocate(out_data);
+}
+
+// pressure from density and energy, then the energy update that reads it,
+// as two loop nests or fused into one
+template <typename ExecPolicy, bool Fused>
+static void kernel_fuse(benchmark::State& state)
+{
+  using namespace RAJA::statement;
+  using nests = camp::list<
+      For<1, ExecPolicy, For<0, RAJA::loop_exec, Lambda<0>>>,
+      For<1, ExecPolicy, For<0, RAJA::loop_exec, Lambda<1>>>>;
+  using pol = typename std::conditional<
+      Fused,
+      RAJA::KernelPolicy<Fuse<camp::at_v<nests, 0>, camp::at_v<nests, 1>>>,
+      RAJA::KernelPolicy<camp::at_v<nests, 0>, camp::at_v<nests, 1>>>::type;
+
+  const RAJA::Index_type n = state.range(0);
+  double* rho_data = bench::allocate<ExecPolicy>(n * n, 1.0);
+  double* e_data = bench::allocate<ExecPolicy>(n * n, 2.0);
+  double* p_data = bench::allocate<ExecPolicy>(n * n, 0.0);
+  grid_view rho(rho_data, n, n);
+  grid_view e(e_data, n, n);
+  grid_view p(p_data, n, n);
+  const double gamma = 1.4, dt = 1e-9;
+
+  while (state.KeepRunning()) {
+    RAJA::kernel<pol>(
+        RAJA::make_tuple(RAJA::RangeSegment(0, n), RAJA::RangeSegment(0, n)),
+        [=](RAJA::Index_type i, RAJA::Index_type j) {
+          p(j, i) = (gamma - 1.0) * rho(j, i) * e(j, i);
+        },
+        [=](RAJA::Index_type i, RAJA::Index_type j) {
+          e(j, i) -= dt * p(j, i);
+        });
+    benchmark::ClobberMemory();
+  }
+
+  bench::set_rates(state, n * n, 4 * sizeof(double), 5);
+  bench::deallocate(rho_data);
+  bench::deallocate(e_data);
+  bench::deallocate(p_data);
+}
+
+BENCHMARK_TEMPLATE(kernel_for, RAJA::seq_exec)->Apply(bench::grid_sizes);
+BENCHMARK_TEMPLATE(kernel_for, RAJA::loop_exec)->Apply(bench::grid_sizes);
+BENCHMARK(kernel_for_simd)->Apply(bench::grid_sizes);
+RAJA_CPU_BENCHMARK_OMP(kernel_for, bench::grid_sizes);
+RAJA_CPU_BENCHMARK_TBB(kernel_for, bench::grid_sizes);
+
+BENCHMARK_TEMPLATE(kernel_tile, RAJA::seq_exec)->Apply(bench::grid_sizes);
+BENCHMARK_TEMPLATE(kernel_tile, RAJA::loop_exec)->Apply(bench::grid_sizes);
+RAJA_CPU_BENCHMARK_OMP(kernel_tile, bench::grid_sizes);
+RAJA_CPU_BENCHMARK_TBB(kernel_tile, bench::grid_sizes);
+
+BENCHMARK_TEMPLATE(kernel_tile_dynamic, RAJA::seq_exec)
+    ->Apply(bench::grid_sizes);
+RAJA_CPU_BENCHMARK_OMP(kernel_tile_dynamic, bench::grid_sizes);
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK(kernel_collapse_omp)->Apply(bench::grid_sizes);
+#endif
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK(kernel_collapse_tbb)->Apply(bench::grid_sizes);
+BENCHMARK(kernel_tile_collapse_tbb)->Apply(bench::grid_sizes);
+#endif
+
+BENCHMARK_TEMPLATE(kernel_norm_reducer, RAJA::seq_exec)
+    ->Apply(bench::grid_sizes);
+RAJA_CPU_BENCHMARK_OMP(kernel_norm_reducer, bench::grid_sizes);
+RAJA_CPU_BENCHMARK_TBB(kernel_norm_reducer, bench::grid_sizes);
+BENCHMARK_TEMPLATE(kernel_norm_statement, RAJA::seq_exec)
+    ->Apply(bench::grid_sizes);
+RAJA_CPU_BENCHMARK_OMP(kernel_norm_statement, bench::grid_sizes);
+RAJA_CPU_BENCHMARK_TBB(kernel_norm_statement, bench::grid_sizes);
+
+BENCHMARK_TEMPLATE(kernel_transpose_local, RAJA::seq_exec, 16)
+    ->Apply(bench::grid_sizes);
+BENCHMARK_TEMPLATE(kernel_transpose_local, RAJA::seq_exec, 64)
+    ->Apply(bench::grid_sizes);
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(kernel_transpose_local, RAJA::omp_parallel_for_exec, 64)
+    ->Apply(bench::grid_sizes);
+#endif
+
+BENCHMARK_TEMPLATE(kernel_fuse, RAJA::seq_exec, false)
+    ->Apply(bench::grid_sizes);
+BENCHMARK_TEMPLATE(kernel_fuse, RAJA::seq_exec, true)
+    ->Apply(bench::grid_sizes);
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(kernel_fuse, RAJA::omp_parallel_for_exec, false)
+    ->Apply(bench::grid_sizes);
+BENCHMARK_TEMPLATE(kernel_fuse, RAJA::omp_parallel_for_exec, true)
+    ->Apply(bench::grid_sizes);
+#endif
+
+BENCHMARK_TEMPLATE(kernel_hyperplane, RAJA::seq_exec)
+    ->Apply(bench::grid_sizes);
+BENCHMARK_TEMPLATE(kernel_hyperplane, RAJA::loop_exec)
+    ->Apply(bench::grid_sizes);
+RAJA_CPU_BENCHMARK_OMP(kernel_hyperplane, bench::grid_sizes);
+RAJA_CPU_BENCHMARK_TBB(kernel_hyperplane, bench::grid_sizes);
+
+BENCHMARK_TEMPLATE(kernel_hyperplane_3d, RAJA::seq_exec)
+    ->Apply(bench::cube_sizes);
+RAJA_CPU_BENCHMARK_OMP(kernel_hyperplane_3d, bench::cube_sizes);
+RAJA_CPU_BENCHMARK_TBB(kernel_hyperplane_3d, bench::cube_sizes);
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(kernel_hyperplane_3d, RAJA::omp_parallel_collapse_exec)
+    ->Apply(bench::cube_sizes);
+#endif
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(kernel_hyperplane_3d, RAJA::tbb_collapse_exec)
+    ->Apply(bench::cube_sizes);
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,87 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// CPU benchmarks of loop launch latency: short loops, where the cost of
+/// starting and joining the threads is comparable to the work, for every
+/// CPU back end. launch_forall runs a trivial update, launch_reduce a sum,
+/// and launch_region four loops in one parallel region.
+///
+
+#include "cpu-benchmark.hpp"
+
+template <typename ExecPolicy>
+static void launch_forall(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  double* x = bench::allocate<ExecPolicy>(n, 1.0);
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n),
+                             [=](RAJA::Index_type i) { x[i] += 1.0; });
+    benchmark::ClobberMemory();
+  }
+
+  bench::set_rates(state, n, 2 * sizeof(double), 1);
+  bench::deallocate(x);
+}
+
+template <typename ExecPolicy>
+static void launch_reduce(benchmark::State& state)
+{
+  using reduce_policy = typename bench::policies<ExecPolicy>::reduce;
+  const RAJA::Index_type n = state.range(0);
+  double* x = bench::allocate<ExecPolicy>(n, 1.0);
+
+  double total = 0.0;
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<reduce_policy, double> sum(0.0);
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n),
+                             [=](RAJA::Index_type i) { sum += x[i]; });
+    total += sum.get();
+  }
+  benchmark::DoNotOptimize(total);
+
+  bench::set_rates(state, n, sizeof(double), 1);
+  bench::deallocate(x);
+}
+
+//! four dependent loops per region, each ending with a barrier
+template <typename RegionPolicy, typename ExecPolicy>
+static void launch_region(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  double* x = bench::allocate<RAJA::seq_exec>(n, 1.0);
+
+  while (state.KeepRunning()) {
+    RAJA::region<RegionPolicy>([=]() {
+      for (int rep = 0; rep < 4; ++rep) {
+        RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n),
+                                 [=](RAJA::Index_type i) { x[i] += 1.0; });
+      }
+    });
+    benchmark::ClobberMemory();
+  }
+
+  bench::set_rates(state, 4 * n, 2 * sizeof(double), 1);
+  bench::deallocate(x);
+}
+
+RAJA_CPU_BENCHMARK(launch_forall, bench::launch_sizes);
+RAJA_CPU_BENCHMARK(launch_reduce, bench::launch_sizes);
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(launch_region,
+                   RAJA::omp_parallel_region,
+                   RAJA::omp_for_nowait_exec)
+    ->Apply(bench::launch_sizes);
+#endif
+#if defined(RAJA_ENABLE_THREADS)
+BENCHMARK_TEMPLATE(launch_region, RAJA::threads_region, RAJA::threads_for_exec)
+    ->Apply(bench::launch_sizes);
+#endif
+
+BENCHMARK_MAIN();
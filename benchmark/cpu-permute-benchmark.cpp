@@ -0,0 +1,132 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// CPU benchmarks of copies between Views with different layouts: an
+/// n x n transpose and a 4D (zone, group) reordering like the one between
+/// zone-major and group-major LTimes data. The naive versions loop over
+/// the indices in the source's order with forall on the outermost loop;
+/// the permute versions call RAJA::permute_copy.
+///
+
+#include "cpu-benchmark.hpp"
+
+template <typename ExecPolicy>
+static void transpose_naive(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  double* a = bench::allocate<ExecPolicy>(n * n, 1.0);
+  double* b = bench::allocate<ExecPolicy>(n * n, 0.0);
+  RAJA::View<double, RAJA::Layout<2>> src(a, n, n);
+  RAJA::View<double, RAJA::Layout<2>> dst(
+      b,
+      RAJA::make_permuted_layout({{n, n}},
+                                 RAJA::as_array<RAJA::Perm<1, 0>>::get()));
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n), [=](RAJA::Index_type i) {
+      for (RAJA::Index_type j = 0; j < n; ++j) {
+        dst(i, j) = src(i, j);
+      }
+    });
+    benchmark::ClobberMemory();
+  }
+
+  bench::set_rates(state, n * n, 2 * sizeof(double), 0);
+  bench::deallocate(a);
+  bench::deallocate(b);
+}
+
+template <typename ExecPolicy>
+static void transpose_permute(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  double* a = bench::allocate<ExecPolicy>(n * n, 1.0);
+  double* b = bench::allocate<ExecPolicy>(n * n, 0.0);
+  RAJA::View<double, RAJA::Layout<2>> src(a, n, n);
+  RAJA::View<double, RAJA::Layout<2>> dst(
+      b,
+      RAJA::make_permuted_layout({{n, n}},
+                                 RAJA::as_array<RAJA::Perm<1, 0>>::get()));
+
+  while (state.KeepRunning()) {
+    RAJA::permute_copy<ExecPolicy>(src, dst);
+    benchmark::ClobberMemory();
+  }
+
+  bench::set_rates(state, n * n, 2 * sizeof(double), 0);
+  bench::deallocate(a);
+  bench::deallocate(b);
+}
+
+//! (dir, zone, group, moment) with zone stride-1 to group stride-1
+template <typename ExecPolicy, bool Permute>
+static void regroup_4d(benchmark::State& state)
+{
+  const RAJA::Index_type nz = state.range(0);
+  const RAJA::Index_type nd = 8, ng = 64, nm = 4;
+  const RAJA::Index_type total = nd * nz * ng * nm;
+  double* a = bench::allocate<ExecPolicy>(total, 1.0);
+  double* b = bench::allocate<ExecPolicy>(total, 0.0);
+  using view_type = RAJA::View<double, RAJA::Layout<4>>;
+  view_type src(a,
+                RAJA::make_permuted_layout(
+                    {{nd, nz, ng, nm}},
+                    RAJA::as_array<RAJA::Perm<0, 3, 2, 1>>::get()));
+  view_type dst(b,
+                RAJA::make_permuted_layout(
+                    {{nd, nz, ng, nm}},
+                    RAJA::as_array<RAJA::Perm<0, 3, 1, 2>>::get()));
+
+  while (state.KeepRunning()) {
+    if (Permute) {
+      RAJA::permute_copy<ExecPolicy>(src, dst);
+    } else {
+      RAJA::forall<ExecPolicy>(
+          RAJA::RangeSegment(0, nd), [=](RAJA::Index_type d) {
+            for (RAJA::Index_type m = 0; m < nm; ++m) {
+              for (RAJA::Index_type g = 0; g < ng; ++g) {
+                for (RAJA::Index_type z = 0; z < nz; ++z) {
+                  dst(d, z, g, m) = src(d, z, g, m);
+                }
+              }
+            }
+          });
+    }
+    benchmark::ClobberMemory();
+  }
+
+  bench::set_rates(state, total, 2 * sizeof(double), 0);
+  bench::deallocate(a);
+  bench::deallocate(b);
+}
+
+template <typename ExecPolicy>
+static void regroup_naive(benchmark::State& state)
+{
+  regroup_4d<ExecPolicy, false>(state);
+}
+
+template <typename ExecPolicy>
+static void regroup_permute(benchmark::State& state)
+{
+  regroup_4d<ExecPolicy, true>(state);
+}
+
+//! zones per direction for the 4D reordering
+static void zone_counts(benchmark::internal::Benchmark* b)
+{
+  b->RangeMultiplier(4)->Range(256, 16384);
+  b->UseRealTime();
+}
+
+RAJA_CPU_BENCHMARK(transpose_naive, bench::grid_sizes);
+RAJA_CPU_BENCHMARK(transpose_permute, bench::grid_sizes);
+RAJA_CPU_BENCHMARK(regroup_naive, zone_counts);
+RAJA_CPU_BENCHMARK(regroup_permute, zone_counts);
+
+BENCHMARK_MAIN();
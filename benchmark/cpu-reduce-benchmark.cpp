@@ -0,0 +1,264 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// CPU benchmarks of the RAJA reducer types: ReduceSum, ReduceMin,
+/// ReduceMax, ReduceMinLoc and ReduceMaxLoc, each with the reduction policy
+/// matching the execution policy, and ReduceSum with the matching
+/// deterministic policy. The vector_exec variants feed the loc
+/// reducers a run of values per call. The multi variants update three
+/// reducers per iteration, captured by the loop body or passed with
+/// RAJA::reduce_params.
+///
+
+#include "cpu-benchmark.hpp"
+
+template <typename ExecPolicy>
+static void reduce_sum(benchmark::State& state)
+{
+  using reduce_policy = typename bench::policies<ExecPolicy>::reduce;
+  const RAJA::Index_type n = state.range(0);
+  double* x = bench::allocate<ExecPolicy>(n, 1.0);
+
+  double total = 0.0;
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<reduce_policy, double> sum(0.0);
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n),
+                             [=](RAJA::Index_type i) { sum += x[i]; });
+    total += sum.get();
+  }
+  benchmark::DoNotOptimize(total);
+
+  bench::set_rates(state, n, sizeof(double), 1);
+  bench::deallocate(x);
+}
+
+template <typename ExecPolicy>
+static void reduce_sum_deterministic(benchmark::State& state)
+{
+  using reduce_policy =
+      typename bench::policies<ExecPolicy>::deterministic_reduce;
+  const RAJA::Index_type n = state.range(0);
+  double* x = bench::allocate<ExecPolicy>(n, 1.0);
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    x[i] = 1.0 / (i + 1);
+  }
+
+  double total = 0.0;
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<reduce_policy, double> sum(0.0);
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n),
+                             [=](RAJA::Index_type i) { sum += x[i]; });
+    total += sum.get();
+  }
+  benchmark::DoNotOptimize(total);
+
+  bench::set_rates(state, n, sizeof(double), 1);
+  bench::deallocate(x);
+}
+
+template <typename ExecPolicy>
+static void reduce_min(benchmark::State& state)
+{
+  using reduce_policy = typename bench::policies<ExecPolicy>::reduce;
+  const RAJA::Index_type n = state.range(0);
+  double* x = bench::allocate<ExecPolicy>(n, 1.0);
+
+  double total = 0.0;
+  while (state.KeepRunning()) {
+    RAJA::ReduceMin<reduce_policy, double> min(2.0);
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n),
+                             [=](RAJA::Index_type i) { min.min(x[i]); });
+    total += min.get();
+  }
+  benchmark::DoNotOptimize(total);
+
+  bench::set_rates(state, n, sizeof(double), 1);
+  bench::deallocate(x);
+}
+
+template <typename ExecPolicy>
+static void reduce_max(benchmark::State& state)
+{
+  using reduce_policy = typename bench::policies<ExecPolicy>::reduce;
+  const RAJA::Index_type n = state.range(0);
+  double* x = bench::allocate<ExecPolicy>(n, 1.0);
+
+  double total = 0.0;
+  while (state.KeepRunning()) {
+    RAJA::ReduceMax<reduce_policy, double> max(0.0);
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n),
+                             [=](RAJA::Index_type i) { max.max(x[i]); });
+    total += max.get();
+  }
+  benchmark::DoNotOptimize(total);
+
+  bench::set_rates(state, n, sizeof(double), 1);
+  bench::deallocate(x);
+}
+
+template <typename ExecPolicy>
+static void reduce_minloc(benchmark::State& state)
+{
+  using reduce_policy = typename bench::policies<ExecPolicy>::reduce;
+  const RAJA::Index_type n = state.range(0);
+  double* x = bench::allocate<ExecPolicy>(n, 1.0);
+  x[n / 2] = 0.0;
+
+  RAJA::Index_type total = 0;
+  while (state.KeepRunning()) {
+    RAJA::ReduceMinLoc<reduce_policy, double> min(2.0, -1);
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n),
+                             [=](RAJA::Index_type i) { min.minloc(x[i], i); });
+    total += min.getLoc();
+  }
+  benchmark::DoNotOptimize(total);
+
+  bench::set_rates(state, n, sizeof(double), 1);
+  bench::deallocate(x);
+}
+
+template <typename ExecPolicy>
+static void reduce_maxloc(benchmark::State& state)
+{
+  using reduce_policy = typename bench::policies<ExecPolicy>::reduce;
+  const RAJA::Index_type n = state.range(0);
+  double* x = bench::allocate<ExecPolicy>(n, 1.0);
+  x[n / 2] = 2.0;
+
+  RAJA::Index_type total = 0;
+  while (state.KeepRunning()) {
+    RAJA::ReduceMaxLoc<reduce_policy, double> max(0.0, -1);
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n),
+                             [=](RAJA::Index_type i) { max.maxloc(x[i], i); });
+    total += max.getLoc();
+  }
+  benchmark::DoNotOptimize(total);
+
+  bench::set_rates(state, n, sizeof(double), 1);
+  bench::deallocate(x);
+}
+
+template <typename ExecPolicy>
+static void reduce_multi(benchmark::State& state)
+{
+  using reduce_policy = typename bench::policies<ExecPolicy>::reduce;
+  const RAJA::Index_type n = state.range(0);
+  double* x = bench::allocate<ExecPolicy>(n, 1.0);
+  x[n / 2] = 2.0;
+
+  double total = 0.0;
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<reduce_policy, double> sum(0.0);
+    RAJA::ReduceMin<reduce_policy, double> min(2.0);
+    RAJA::ReduceMaxLoc<reduce_policy, double> max(0.0, -1);
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n),
+                             [=](RAJA::Index_type i) {
+                               sum += x[i];
+                               min.min(x[i]);
+                               max.maxloc(x[i], i);
+                             });
+    total += sum.get() + min.get() + max.getLoc();
+  }
+  benchmark::DoNotOptimize(total);
+
+  bench::set_rates(state, n, sizeof(double), 3);
+  bench::deallocate(x);
+}
+
+template <typename ExecPolicy>
+static void reduce_multi_params(benchmark::State& state)
+{
+  using reduce_policy = typename bench::policies<ExecPolicy>::reduce;
+  using Sum = RAJA::ReduceSum<reduce_policy, double>;
+  using Min = RAJA::ReduceMin<reduce_policy, double>;
+  using MaxLoc = RAJA::ReduceMaxLoc<reduce_policy, double>;
+  const RAJA::Index_type n = state.range(0);
+  double* x = bench::allocate<ExecPolicy>(n, 1.0);
+  x[n / 2] = 2.0;
+
+  double total = 0.0;
+  while (state.KeepRunning()) {
+    Sum sum(0.0);
+    Min min(2.0);
+    MaxLoc max(0.0, -1);
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n),
+                             RAJA::reduce_params(sum, min, max),
+                             [=](RAJA::Index_type i,
+                                 typename Sum::param_type& s,
+                                 typename Min::param_type& lo,
+                                 typename MaxLoc::param_type& hi) {
+                               s += x[i];
+                               lo.min(x[i]);
+                               hi.maxloc(x[i], i);
+                             });
+    total += sum.get() + min.get() + max.getLoc();
+  }
+  benchmark::DoNotOptimize(total);
+
+  bench::set_rates(state, n, sizeof(double), 3);
+  bench::deallocate(x);
+}
+
+template <camp::idx_t Width>
+static void reduce_minloc_vector(benchmark::State& state)
+{
+  using vindex = RAJA::vector_index<RAJA::Index_type, Width>;
+  const RAJA::Index_type n = state.range(0);
+  double* data = bench::allocate<RAJA::seq_exec>(n, 1.0);
+  data[n / 2] = 0.0;
+  RAJA::View<double, RAJA::Layout<1>> x(data, n);
+
+  RAJA::Index_type total = 0;
+  while (state.KeepRunning()) {
+    RAJA::ReduceMinLoc<RAJA::seq_reduce, double> min(2.0, -1);
+    RAJA::forall<RAJA::vector_exec<Width>>(
+        RAJA::RangeSegment(0, n), [=](vindex i) { min.minloc(x(i), i); });
+    total += min.getLoc();
+  }
+  benchmark::DoNotOptimize(total);
+
+  bench::set_rates(state, n, sizeof(double), 1);
+  bench::deallocate(data);
+}
+
+template <camp::idx_t Width>
+static void reduce_maxloc_vector(benchmark::State& state)
+{
+  using vindex = RAJA::vector_index<RAJA::Index_type, Width>;
+  const RAJA::Index_type n = state.range(0);
+  double* data = bench::allocate<RAJA::seq_exec>(n, 1.0);
+  data[n / 2] = 2.0;
+  RAJA::View<double, RAJA::Layout<1>> x(data, n);
+
+  RAJA::Index_type total = 0;
+  while (state.KeepRunning()) {
+    RAJA::ReduceMaxLoc<RAJA::seq_reduce, double> max(0.0, -1);
+    RAJA::forall<RAJA::vector_exec<Width>>(
+        RAJA::RangeSegment(0, n), [=](vindex i) { max.maxloc(x(i), i); });
+    total += max.getLoc();
+  }
+  benchmark::DoNotOptimize(total);
+
+  bench::set_rates(state, n, sizeof(double), 1);
+  bench::deallocate(data);
+}
+
+RAJA_CPU_BENCHMARK(reduce_sum, bench::vector_sizes);
+RAJA_CPU_BENCHMARK(reduce_sum_deterministic, bench::vector_sizes);
+RAJA_CPU_BENCHMARK(reduce_min, bench::vector_sizes);
+RAJA_CPU_BENCHMARK(reduce_max, bench::vector_sizes);
+RAJA_CPU_BENCHMARK(reduce_minloc, bench::vector_sizes);
+RAJA_CPU_BENCHMARK(reduce_maxloc, bench::vector_sizes);
+RAJA_CPU_BENCHMARK(reduce_multi, bench::vector_sizes);
+RAJA_CPU_BENCHMARK(reduce_multi_params, bench::vector_sizes);
+BENCHMARK_TEMPLATE(reduce_minloc_vector, 4)->Apply(bench::vector_sizes);
+BENCHMARK_TEMPLATE(reduce_minloc_vector, 8)->Apply(bench::vector_sizes);
+BENCHMARK_TEMPLATE(reduce_maxloc_vector, 4)->Apply(bench::vector_sizes);
+BENCHMARK_TEMPLATE(reduce_maxloc_vector, 8)->Apply(bench::vector_sizes);
+
+BENCHMARK_MAIN();
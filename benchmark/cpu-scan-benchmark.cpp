@@ -0,0 +1,79 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// CPU benchmarks of the RAJA scans: inclusive and exclusive prefix sums,
+/// out of place and in place.
+///
+
+#include "cpu-benchmark.hpp"
+
+template <typename ExecPolicy>
+static void inclusive_scan(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  double* in = bench::allocate<ExecPolicy>(n, 1.0);
+  double* out = bench::allocate<ExecPolicy>(n, 0.0);
+
+  while (state.KeepRunning()) {
+    RAJA::inclusive_scan(ExecPolicy{}, in, in + n, out);
+    benchmark::ClobberMemory();
+  }
+
+  bench::set_rates(state, n, 2 * sizeof(double), 1);
+  bench::deallocate(in);
+  bench::deallocate(out);
+}
+
+template <typename ExecPolicy>
+static void exclusive_scan(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  double* in = bench::allocate<ExecPolicy>(n, 1.0);
+  double* out = bench::allocate<ExecPolicy>(n, 0.0);
+
+  while (state.KeepRunning()) {
+    RAJA::exclusive_scan(ExecPolicy{}, in, in + n, out);
+    benchmark::ClobberMemory();
+  }
+
+  bench::set_rates(state, n, 2 * sizeof(double), 1);
+  bench::deallocate(in);
+  bench::deallocate(out);
+}
+
+template <typename ExecPolicy>
+static void inclusive_scan_inplace(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  // a max scan leaves the data unchanged, so every iteration does the
+  // same work
+  double* data = bench::allocate<ExecPolicy>(n, 1.0);
+
+  while (state.KeepRunning()) {
+    RAJA::inclusive_scan_inplace(ExecPolicy{},
+                                 data,
+                                 data + n,
+                                 RAJA::operators::maximum<double>{});
+    benchmark::ClobberMemory();
+  }
+
+  bench::set_rates(state, n, 2 * sizeof(double), 1);
+  bench::deallocate(data);
+}
+
+// scans have no thread pool implementation
+#define RAJA_CPU_SCAN_BENCHMARK(func, sizes) \
+  RAJA_CPU_BENCHMARK_SEQ(func, sizes);       \
+  RAJA_CPU_BENCHMARK_OMP(func, sizes);       \
+  RAJA_CPU_BENCHMARK_TBB(func, sizes)
+
+RAJA_CPU_SCAN_BENCHMARK(inclusive_scan, bench::vector_sizes);
+RAJA_CPU_SCAN_BENCHMARK(exclusive_scan, bench::vector_sizes);
+RAJA_CPU_SCAN_BENCHMARK(inclusive_scan_inplace, bench::vector_sizes);
+
+BENCHMARK_MAIN();
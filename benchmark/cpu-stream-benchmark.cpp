@@ -0,0 +1,148 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// CPU benchmarks of the stream kernels daxpy and triad, and of a chain of
+/// three zone updates run as three foralls and as one forall_fused.
+///
+/// With OpenMP, the kernels also run under
+/// omp_parallel_for_affinity_static, whose index-to-thread mapping matches
+/// the first touch of the arrays on every call; bind the threads
+/// (OMP_PROC_BIND=close or spread) to see the NUMA effect.
+///
+
+#include "cpu-benchmark.hpp"
+
+#include <cmath>
+
+template <typename ExecPolicy>
+static void daxpy(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  double* x = bench::allocate<ExecPolicy>(n, 1.0);
+  double* y = bench::allocate<ExecPolicy>(n, 2.0);
+  const double a = 0.5;
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n),
+                             [=](RAJA::Index_type i) { y[i] += a * x[i]; });
+    benchmark::ClobberMemory();
+  }
+
+  bench::set_rates(state, n, 3 * sizeof(double), 2);
+  bench::deallocate(x);
+  bench::deallocate(y);
+}
+
+template <typename ExecPolicy>
+static void triad(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  double* a = bench::allocate<ExecPolicy>(n, 0.0);
+  double* b = bench::allocate<ExecPolicy>(n, 1.0);
+  double* c = bench::allocate<ExecPolicy>(n, 2.0);
+  const double s = 3.0;
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n), [=](RAJA::Index_type i) {
+      a[i] = b[i] + s * c[i];
+    });
+    benchmark::ClobberMemory();
+  }
+
+  bench::set_rates(state, n, 3 * sizeof(double), 2);
+  bench::deallocate(a);
+  bench::deallocate(b);
+  bench::deallocate(c);
+}
+
+// equation of state, sound speed and energy update over the same zones;
+// fused, the chain reads rho, e and div once and writes p, c and e once
+struct zone_chain {
+  double* rho;
+  double* e;
+  double* div;
+  double* p;
+  double* c;
+
+  explicit zone_chain(RAJA::Index_type n)
+  {
+    rho = bench::allocate<RAJA::seq_exec>(n, 1.0);
+    e = bench::allocate<RAJA::seq_exec>(n, 2.0);
+    div = bench::allocate<RAJA::seq_exec>(n, 1e-9);
+    p = bench::allocate<RAJA::seq_exec>(n, 0.0);
+    c = bench::allocate<RAJA::seq_exec>(n, 0.0);
+  }
+
+  ~zone_chain()
+  {
+    bench::deallocate(rho);
+    bench::deallocate(e);
+    bench::deallocate(div);
+    bench::deallocate(p);
+    bench::deallocate(c);
+  }
+};
+
+template <typename ExecPolicy>
+static void zone_update_separate(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  zone_chain z(n);
+  double *rho = z.rho, *e = z.e, *div = z.div, *p = z.p, *c = z.c;
+  const double gamma = 1.4, dt = 1e-3;
+  RAJA::RangeSegment zones(0, n);
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPolicy>(zones, [=](RAJA::Index_type i) {
+      p[i] = (gamma - 1.0) * rho[i] * e[i];
+    });
+    RAJA::forall<ExecPolicy>(zones, [=](RAJA::Index_type i) {
+      c[i] = std::sqrt(gamma * p[i] / rho[i]);
+    });
+    RAJA::forall<ExecPolicy>(zones, [=](RAJA::Index_type i) {
+      e[i] -= dt * p[i] * div[i];
+    });
+    benchmark::ClobberMemory();
+  }
+
+  bench::set_rates(state, n, 6 * sizeof(double), 9);
+}
+
+template <typename ExecPolicy>
+static void zone_update_fused(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  zone_chain z(n);
+  double *rho = z.rho, *e = z.e, *div = z.div, *p = z.p, *c = z.c;
+  const double gamma = 1.4, dt = 1e-3;
+
+  while (state.KeepRunning()) {
+    RAJA::forall_fused<ExecPolicy>(
+        RAJA::RangeSegment(0, n),
+        [=](RAJA::Index_type i) { p[i] = (gamma - 1.0) * rho[i] * e[i]; },
+        [=](RAJA::Index_type i) { c[i] = std::sqrt(gamma * p[i] / rho[i]); },
+        [=](RAJA::Index_type i) { e[i] -= dt * p[i] * div[i]; });
+    benchmark::ClobberMemory();
+  }
+
+  bench::set_rates(state, n, 6 * sizeof(double), 9);
+}
+
+RAJA_CPU_BENCHMARK(daxpy, bench::vector_sizes);
+RAJA_CPU_BENCHMARK(triad, bench::vector_sizes);
+RAJA_CPU_BENCHMARK(zone_update_separate, bench::vector_sizes);
+RAJA_CPU_BENCHMARK(zone_update_fused, bench::vector_sizes);
+
+#if defined(RAJA_ENABLE_OPENMP)
+// 512 doubles per chunk: one page per thread at a time
+using affinity_exec = RAJA::omp_parallel_for_affinity_static<512>;
+BENCHMARK_TEMPLATE(daxpy, affinity_exec)->Apply(bench::vector_sizes);
+BENCHMARK_TEMPLATE(triad, affinity_exec)->Apply(bench::vector_sizes);
+#endif
+
+BENCHMARK_MAIN();
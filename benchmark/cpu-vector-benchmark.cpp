@@ -0,0 +1,98 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// CPU benchmarks comparing vector_exec with simd_exec and loop_exec.
+///
+/// Each kernel body is a function object templated on its index, so the
+/// same source runs on scalar indices under loop_exec and simd_exec and on
+/// vector indices under vector_exec.  Build with the target's ISA flags
+/// (e.g. -march=native) for vector_exec to use AVX2 or AVX-512 registers.
+///
+
+#include "cpu-benchmark.hpp"
+
+using view_1d = RAJA::View<double, RAJA::Layout<1>>;
+using view_2d = RAJA::View<double, RAJA::Layout<2>>;
+
+struct triad_body {
+  view_1d a, b, c;
+  double s;
+
+  template <typename Index>
+  RAJA_INLINE void operator()(Index i) const
+  {
+    a(i) = b(i) + s * c(i);
+  }
+};
+
+// one row of a 5-point stencil; the vector index runs along the row
+struct stencil_body {
+  view_2d in, out;
+  RAJA::Index_type j;
+
+  template <typename Index>
+  RAJA_INLINE void operator()(Index i) const
+  {
+    out(j, i) = 0.25 * (in(j, i - 1) + in(j, i + 1) + in(j - 1, i) +
+                        in(j + 1, i));
+  }
+};
+
+template <typename ExecPolicy>
+static void vector_triad(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  double* a = bench::allocate<RAJA::seq_exec>(n, 0.0);
+  double* b = bench::allocate<RAJA::seq_exec>(n, 1.0);
+  double* c = bench::allocate<RAJA::seq_exec>(n, 2.0);
+  const triad_body body{view_1d(a, n), view_1d(b, n), view_1d(c, n), 3.0};
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n), body);
+    benchmark::ClobberMemory();
+  }
+
+  bench::set_rates(state, n, 3 * sizeof(double), 2);
+  bench::deallocate(a);
+  bench::deallocate(b);
+  bench::deallocate(c);
+}
+
+template <typename ExecPolicy>
+static void vector_stencil(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  double* in = bench::allocate<RAJA::seq_exec>(n * n, 1.0);
+  double* out = bench::allocate<RAJA::seq_exec>(n * n, 0.0);
+  stencil_body body{view_2d(in, n, n), view_2d(out, n, n), 0};
+
+  // the interior is not a multiple of any width, so the tail is exercised
+  RAJA::RangeSegment interior(1, n - 1);
+  while (state.KeepRunning()) {
+    for (RAJA::Index_type j = 1; j < n - 1; ++j) {
+      body.j = j;
+      RAJA::forall<ExecPolicy>(interior, body);
+    }
+    benchmark::ClobberMemory();
+  }
+
+  bench::set_rates(state, (n - 2) * (n - 2), 2 * sizeof(double), 4);
+  bench::deallocate(in);
+  bench::deallocate(out);
+}
+
+#define RAJA_VECTOR_BENCHMARK(func, sizes)                        \
+  BENCHMARK_TEMPLATE(func, RAJA::loop_exec)->Apply(sizes);        \
+  BENCHMARK_TEMPLATE(func, RAJA::simd_exec)->Apply(sizes);        \
+  BENCHMARK_TEMPLATE(func, RAJA::vector_exec<4>)->Apply(sizes);   \
+  BENCHMARK_TEMPLATE(func, RAJA::vector_exec<8>)->Apply(sizes)
+
+RAJA_VECTOR_BENCHMARK(vector_triad, bench::vector_sizes);
+RAJA_VECTOR_BENCHMARK(vector_stencil, bench::grid_sizes);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,161 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// CPU benchmarks of View/Layout indexing on an N^3 array: the same
+/// update through a raw pointer, a View with the default Layout, a View
+/// with a permuted Layout and a View with an OffsetLayout. The execution
+/// policy under test runs the outermost loop; the inner loops are
+/// sequential, so the cost of index computation is what differs.
+///
+/// The to_indices benchmarks run one flat loop over the array and recover
+/// (k, j, i) from the linear index with a LayoutDecoder, or with the
+/// plain divisions and remainders of Layout::toIndices.
+///
+
+#include "cpu-benchmark.hpp"
+
+template <typename ExecPolicy>
+static void view_raw(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  double* in = bench::allocate<ExecPolicy>(n * n * n, 1.0);
+  double* out = bench::allocate<ExecPolicy>(n * n * n, 0.0);
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n), [=](RAJA::Index_type k) {
+      for (RAJA::Index_type j = 0; j < n; ++j) {
+        for (RAJA::Index_type i = 0; i < n; ++i) {
+          const RAJA::Index_type idx = i + n * (j + n * k);
+          out[idx] = in[idx] + 1.0;
+        }
+      }
+    });
+    benchmark::ClobberMemory();
+  }
+
+  bench::set_rates(state, n * n * n, 2 * sizeof(double), 1);
+  bench::deallocate(in);
+  bench::deallocate(out);
+}
+
+template <typename ExecPolicy, typename ViewType>
+static void run_view(benchmark::State& state, ViewType in, ViewType out)
+{
+  const RAJA::Index_type n = state.range(0);
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n), [=](RAJA::Index_type k) {
+      for (RAJA::Index_type j = 0; j < n; ++j) {
+        for (RAJA::Index_type i = 0; i < n; ++i) {
+          out(k, j, i) = in(k, j, i) + 1.0;
+        }
+      }
+    });
+    benchmark::ClobberMemory();
+  }
+  bench::set_rates(state, n * n * n, 2 * sizeof(double), 1);
+}
+
+template <typename ExecPolicy>
+static void view_layout(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  double* in = bench::allocate<ExecPolicy>(n * n * n, 1.0);
+  double* out = bench::allocate<ExecPolicy>(n * n * n, 0.0);
+
+  using view_type = RAJA::View<double, RAJA::Layout<3>>;
+  run_view<ExecPolicy>(state, view_type(in, n, n, n), view_type(out, n, n, n));
+
+  bench::deallocate(in);
+  bench::deallocate(out);
+}
+
+template <typename ExecPolicy>
+static void view_permuted_layout(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  double* in = bench::allocate<ExecPolicy>(n * n * n, 1.0);
+  double* out = bench::allocate<ExecPolicy>(n * n * n, 0.0);
+
+  // k stride-1: the inner loop over i strides through memory
+  auto layout = RAJA::make_permuted_layout(
+      {{n, n, n}}, RAJA::as_array<RAJA::Perm<1, 2, 0>>::get());
+  using view_type = RAJA::View<double, RAJA::Layout<3>>;
+  run_view<ExecPolicy>(state, view_type(in, layout), view_type(out, layout));
+
+  bench::deallocate(in);
+  bench::deallocate(out);
+}
+
+template <typename ExecPolicy>
+static void view_offset_layout(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  double* in = bench::allocate<ExecPolicy>(n * n * n, 1.0);
+  double* out = bench::allocate<ExecPolicy>(n * n * n, 0.0);
+
+  // same extents as the other views, indexed from 0 through the offset
+  auto layout =
+      RAJA::make_offset_layout<3>({{0, 0, 0}}, {{n - 1, n - 1, n - 1}});
+  using view_type = RAJA::View<double, RAJA::OffsetLayout<3>>;
+  run_view<ExecPolicy>(state, view_type(in, layout), view_type(out, layout));
+
+  bench::deallocate(in);
+  bench::deallocate(out);
+}
+
+//! out[k][j][i] = in(i, j, k) for in with a permuted layout
+template <typename ExecPolicy, bool Divide>
+static void run_to_indices(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  double* in = bench::allocate<ExecPolicy>(n * n * n, 1.0);
+  double* out = bench::allocate<ExecPolicy>(n * n * n, 0.0);
+  const RAJA::Layout<3> layout(n, n, n);
+  const auto decoder = RAJA::make_layout_decoder(layout);
+  const auto perm = RAJA::make_permuted_layout(
+      {{n, n, n}}, RAJA::as_array<RAJA::Perm<1, 2, 0>>::get());
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n * n * n),
+                             [=](RAJA::Index_type lin) {
+                               RAJA::Index_type k, j, i;
+                               if (Divide) {
+                                 layout.toIndices(lin, k, j, i);
+                               } else {
+                                 decoder.toIndices(lin, k, j, i);
+                               }
+                               out[lin] = in[perm(i, j, k)];
+                             });
+    benchmark::ClobberMemory();
+  }
+
+  bench::set_rates(state, n * n * n, 2 * sizeof(double), 0);
+  bench::deallocate(in);
+  bench::deallocate(out);
+}
+
+template <typename ExecPolicy>
+static void to_indices_divide(benchmark::State& state)
+{
+  run_to_indices<ExecPolicy, true>(state);
+}
+
+template <typename ExecPolicy>
+static void to_indices_decoder(benchmark::State& state)
+{
+  run_to_indices<ExecPolicy, false>(state);
+}
+
+RAJA_CPU_BENCHMARK(view_raw, bench::cube_sizes);
+RAJA_CPU_BENCHMARK(view_layout, bench::cube_sizes);
+RAJA_CPU_BENCHMARK(view_permuted_layout, bench::cube_sizes);
+RAJA_CPU_BENCHMARK(view_offset_layout, bench::cube_sizes);
+RAJA_CPU_BENCHMARK(to_indices_divide, bench::cube_sizes);
+RAJA_CPU_BENCHMARK(to_indices_decoder, bench::cube_sizes);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,106 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// 3D zone-to-node scatter: OpenMP atomics versus a lock-free block
+/// index set executed in dependency order.
+///
+/// The benchmark argument is the number of zones along each mesh edge.
+///
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+struct ScatterMesh {
+  RAJA::Index_type nx, ny, nz;
+  RAJA::Index_type offsets[8];
+  std::vector<double> zonal;
+  std::vector<double> nodal;
+
+  explicit ScatterMesh(RAJA::Index_type n)
+      : nx(n),
+        ny(n),
+        nz(n),
+        zonal(n * n * n, 1.0),
+        nodal((n + 1) * (n + 1) * (n + 1), 0.0)
+  {
+    RAJA::Index_type nnx = nx + 1, nnxy = (nx + 1) * (ny + 1);
+    RAJA::Index_type off[8] = {0, 1, nnx, nnx + 1,
+                               nnxy, nnxy + 1, nnxy + nnx, nnxy + nnx + 1};
+    for (int i = 0; i < 8; ++i) {
+      offsets[i] = off[i];
+    }
+  }
+
+  RAJA::Index_type numZones() const { return nx * ny * nz; }
+
+  //! index of the lowest node of zone z
+  RAJA_INLINE RAJA::Index_type node0(RAJA::Index_type z) const
+  {
+    RAJA::Index_type i = z % nx;
+    RAJA::Index_type j = (z / nx) % ny;
+    RAJA::Index_type k = z / (nx * ny);
+    return i + (nx + 1) * (j + (ny + 1) * k);
+  }
+};
+
+static void benchmark_scatter_atomic(benchmark::State& state)
+{
+  ScatterMesh mesh(state.range(0));
+  const double* zonal = mesh.zonal.data();
+  double* nodal = mesh.nodal.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::RangeSegment(0, mesh.numZones()), [=, &mesh](RAJA::Index_type z) {
+          RAJA::Index_type n0 = mesh.node0(z);
+          double val = 0.125 * zonal[z];
+          for (int n = 0; n < 8; ++n) {
+            RAJA::atomicAdd<RAJA::omp_atomic>(&nodal[n0 + mesh.offsets[n]],
+                                              val);
+          }
+        });
+  }
+
+  state.SetItemsProcessed(state.iterations() * mesh.numZones());
+}
+
+static void benchmark_scatter_lockfree(benchmark::State& state)
+{
+  ScatterMesh mesh(state.range(0));
+  const double* zonal = mesh.zonal.data();
+  double* nodal = mesh.nodal.data();
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment,
+                      RAJA::ListSegment,
+                      RAJA::RangeStrideSegment>
+      iset;
+  RAJA::buildLockFreeBlockIndexset(iset, mesh.nx, mesh.ny, mesh.nz);
+
+  using EXEC_POL = RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::loop_exec>;
+
+  while (state.KeepRunning()) {
+    RAJA::forall<EXEC_POL>(iset, [=, &mesh](RAJA::Index_type z) {
+      RAJA::Index_type n0 = mesh.node0(z);
+      double val = 0.125 * zonal[z];
+      for (int n = 0; n < 8; ++n) {
+        nodal[n0 + mesh.offsets[n]] += val;
+      }
+    });
+  }
+
+  state.SetItemsProcessed(state.iterations() * mesh.numZones());
+}
+
+BENCHMARK(benchmark_scatter_atomic)->Arg(32)->Arg(64)->Arg(128)->Arg(256);
+BENCHMARK(benchmark_scatter_lockfree)->Arg(32)->Arg(64)->Arg(128)->Arg(256);
+
+BENCHMARK_MAIN();
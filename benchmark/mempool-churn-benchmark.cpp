@@ -0,0 +1,107 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Microbenchmark of allocation churn in the basic_mempool pools.
+///
+/// Every OpenMP thread keeps a window of live blocks of random sizes
+/// (8 B to 4 KiB) and repeatedly frees the oldest and allocates a new one,
+/// the pattern of reduction scratch and temporary buffers. After each round
+/// the threads free the blocks of their neighbour, so blocks also migrate
+/// between threads. The number of OpenMP threads is swept.
+///
+
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include <omp.h>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+#include "RAJA/util/basic_mempool.hpp"
+
+#define LIVE 64
+#define OPS 4096
+
+using allocator = RAJA::basic_mempool::generic_allocator;
+
+//! baseline going straight to malloc/free
+struct system_pool {
+  template <typename T>
+  T* malloc(size_t nTs, size_t = alignof(T))
+  {
+    return static_cast<T*>(std::malloc(nTs * sizeof(T)));
+  }
+  void free(const void* ptr) { std::free(const_cast<void*>(ptr)); }
+};
+
+template <typename Pool>
+static void benchmark_mempool_churn(benchmark::State& state)
+{
+  const int nthreads = static_cast<int>(state.range(0));
+  omp_set_num_threads(nthreads);
+
+  Pool pool;
+  std::vector<char*> live(LIVE * nthreads, nullptr);
+
+  // per-thread sequences of sizes, generated once
+  std::vector<int> sizes(OPS * nthreads);
+  std::mt19937 gen(1);
+  std::uniform_int_distribution<int> dist(8, 4096);
+  for (auto& s : sizes) {
+    s = dist(gen);
+  }
+
+  while (state.KeepRunning()) {
+#pragma omp parallel
+    {
+      const int tid = omp_get_thread_num();
+      char** mine = &live[tid * LIVE];
+      const int* my_sizes = &sizes[tid * OPS];
+      for (int i = 0; i < OPS; ++i) {
+        const int k = i % LIVE;
+        if (mine[k] != nullptr) {
+          pool.free(mine[k]);
+        }
+        mine[k] = pool.template malloc<char>(my_sizes[i]);
+        mine[k][0] = static_cast<char>(i);
+      }
+#pragma omp barrier
+      char** theirs = &live[((tid + 1) % nthreads) * LIVE];
+      for (int k = 0; k < LIVE; ++k) {
+        pool.free(theirs[k]);
+      }
+#pragma omp barrier
+      for (int k = 0; k < LIVE; ++k) {
+        mine[k] = nullptr;
+      }
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * nthreads * (OPS + LIVE));
+}
+
+static void thread_counts(benchmark::internal::Benchmark* b)
+{
+  for (int t = 1; t < omp_get_max_threads(); t *= 2) {
+    b->Arg(t);
+  }
+  b->Arg(omp_get_max_threads());
+  b->UseRealTime();
+}
+
+BENCHMARK_TEMPLATE(benchmark_mempool_churn, system_pool)->Apply(thread_counts);
+BENCHMARK_TEMPLATE(benchmark_mempool_churn,
+                   RAJA::basic_mempool::MemPool<allocator>)
+    ->Apply(thread_counts);
+BENCHMARK_TEMPLATE(benchmark_mempool_churn,
+                   RAJA::basic_mempool::ThreadCachingMemPool<allocator>)
+    ->Apply(thread_counts);
+
+BENCHMARK_MAIN();
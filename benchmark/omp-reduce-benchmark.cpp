@@ -0,0 +1,83 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Microbenchmark comparing OpenMP reduction policies.
+///
+/// Each benchmark runs a short loop carrying NumReducers sum reducers,
+/// sweeping the number of OpenMP threads. Short loops make the cost of
+/// combining thread-private copies at loop exit visible.
+///
+
+#include <array>
+
+#include <omp.h>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+#define N 16384
+
+template <typename ReducePolicy, int NumReducers>
+static void benchmark_omp_reduce(benchmark::State& state)
+{
+  omp_set_num_threads(static_cast<int>(state.range(0)));
+
+  double* a = new double[N];
+  for (int i = 0; i < N; i++) {
+    a[i] = 1.0;
+  }
+
+  double total = 0.0;
+  while (state.KeepRunning()) {
+    std::array<RAJA::ReduceSum<ReducePolicy, double>, NumReducers> sums;
+
+    RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, N),
+                                              [=](int i) {
+                                                for (auto& sum : sums) {
+                                                  sum += a[i];
+                                                }
+                                              });
+
+    for (auto& sum : sums) {
+      total += sum.get();
+    }
+  }
+  benchmark::DoNotOptimize(total);
+
+  state.SetItemsProcessed(state.iterations() * N * NumReducers);
+
+  delete[] a;
+}
+
+static void thread_counts(benchmark::internal::Benchmark* b)
+{
+  for (int t = 1; t < omp_get_max_threads(); t *= 2) {
+    b->Arg(t);
+  }
+  b->Arg(omp_get_max_threads());
+}
+
+BENCHMARK_TEMPLATE2(benchmark_omp_reduce, RAJA::omp_reduce, 1)
+    ->Apply(thread_counts);
+BENCHMARK_TEMPLATE2(benchmark_omp_reduce, RAJA::omp_reduce_padded, 1)
+    ->Apply(thread_counts);
+BENCHMARK_TEMPLATE2(benchmark_omp_reduce, RAJA::omp_reduce, 2)
+    ->Apply(thread_counts);
+BENCHMARK_TEMPLATE2(benchmark_omp_reduce, RAJA::omp_reduce_padded, 2)
+    ->Apply(thread_counts);
+BENCHMARK_TEMPLATE2(benchmark_omp_reduce, RAJA::omp_reduce, 4)
+    ->Apply(thread_counts);
+BENCHMARK_TEMPLATE2(benchmark_omp_reduce, RAJA::omp_reduce_padded, 4)
+    ->Apply(thread_counts);
+BENCHMARK_TEMPLATE2(benchmark_omp_reduce, RAJA::omp_reduce, 8)
+    ->Apply(thread_counts);
+BENCHMARK_TEMPLATE2(benchmark_omp_reduce, RAJA::omp_reduce_padded, 8)
+    ->Apply(thread_counts);
+
+BENCHMARK_MAIN();
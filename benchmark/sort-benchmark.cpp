@@ -0,0 +1,128 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Microbenchmark comparing RAJA::sort and RAJA::sort_pairs on the CPU back
+/// ends against a serial std::sort.
+///
+/// Each iteration restores the same shuffled input (untimed) and sorts it.
+/// Integral keys take the radix path in the parallel back ends, double keys
+/// the merge sort. Sizes run from 1e4 to 1e9 elements; the largest sizes
+/// need several GB of memory, use --benchmark_filter to skip them.
+///
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+template <typename T>
+static std::vector<T> make_keys(std::size_t n)
+{
+  std::mt19937_64 gen{12345};
+  std::vector<T> keys(n);
+  for (auto& k : keys) {
+    k = static_cast<T>(gen() >> 16);
+  }
+  return keys;
+}
+
+struct std_sort {
+};
+
+template <typename T, typename ExecPolicy>
+struct sorter {
+  static void sort(std::vector<T>& keys)
+  {
+    RAJA::sort(ExecPolicy{}, keys);
+  }
+};
+
+template <typename T>
+struct sorter<T, std_sort> {
+  static void sort(std::vector<T>& keys)
+  {
+    std::sort(keys.begin(), keys.end());
+  }
+};
+
+template <typename ExecPolicy, typename T>
+static void benchmark_sort(benchmark::State& state)
+{
+  const std::size_t n = static_cast<std::size_t>(state.range(0));
+  const std::vector<T> input = make_keys<T>(n);
+  std::vector<T> keys(n);
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    std::copy(input.begin(), input.end(), keys.begin());
+    state.ResumeTiming();
+
+    sorter<T, ExecPolicy>::sort(keys);
+  }
+  benchmark::DoNotOptimize(keys.data());
+
+  state.SetItemsProcessed(state.iterations() * n);
+  state.SetBytesProcessed(state.iterations() * n * sizeof(T));
+}
+
+template <typename ExecPolicy, typename T>
+static void benchmark_sort_pairs(benchmark::State& state)
+{
+  const std::size_t n = static_cast<std::size_t>(state.range(0));
+  const std::vector<T> input = make_keys<T>(n);
+  std::vector<T> keys(n);
+  std::vector<int> vals(n);
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    std::copy(input.begin(), input.end(), keys.begin());
+    for (std::size_t i = 0; i < n; ++i) {
+      vals[i] = static_cast<int>(i);
+    }
+    state.ResumeTiming();
+
+    RAJA::sort_pairs(ExecPolicy{}, keys, vals);
+  }
+  benchmark::DoNotOptimize(vals.data());
+
+  state.SetItemsProcessed(state.iterations() * n);
+  state.SetBytesProcessed(state.iterations() * n * (sizeof(T) + sizeof(int)));
+}
+
+static void sizes(benchmark::internal::Benchmark* b)
+{
+  b->RangeMultiplier(10)->Range(10000, 1000000000);
+  b->Unit(benchmark::kMillisecond);
+}
+
+BENCHMARK_TEMPLATE2(benchmark_sort, std_sort, int)->Apply(sizes);
+BENCHMARK_TEMPLATE2(benchmark_sort, RAJA::seq_exec, int)->Apply(sizes);
+BENCHMARK_TEMPLATE2(benchmark_sort, std_sort, double)->Apply(sizes);
+BENCHMARK_TEMPLATE2(benchmark_sort, RAJA::seq_exec, double)->Apply(sizes);
+BENCHMARK_TEMPLATE2(benchmark_sort_pairs, RAJA::seq_exec, int)->Apply(sizes);
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE2(benchmark_sort, RAJA::omp_parallel_for_exec, int)
+    ->Apply(sizes);
+BENCHMARK_TEMPLATE2(benchmark_sort, RAJA::omp_parallel_for_exec, double)
+    ->Apply(sizes);
+BENCHMARK_TEMPLATE2(benchmark_sort_pairs, RAJA::omp_parallel_for_exec, int)
+    ->Apply(sizes);
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE2(benchmark_sort, RAJA::tbb_for_exec, int)->Apply(sizes);
+BENCHMARK_TEMPLATE2(benchmark_sort, RAJA::tbb_for_exec, double)->Apply(sizes);
+BENCHMARK_TEMPLATE2(benchmark_sort_pairs, RAJA::tbb_for_exec, int)
+    ->Apply(sizes);
+#endif
+
+BENCHMARK_MAIN();
@@ -29,6 +29,19 @@ if (ENABLE_TBB)
   endif()
 endif ()
 
+if (ENABLE_THREADS)
+  find_package(Threads)
+  if(Threads_FOUND)
+    blt_register_library(
+      NAME threads
+      LIBRARIES ${CMAKE_THREAD_LIBS_INIT})
+    message(STATUS "Thread pool Enabled")
+  else()
+    message(WARNING "Threads NOT FOUND")
+    set(ENABLE_THREADS Off)
+  endif()
+endif ()
+
 if (ENABLE_CHAI)
   message(STATUS "CHAI enabled")
   find_package(umpire)
@@ -57,6 +57,7 @@ check_symbol_exists(_mm_malloc "" RAJA_HAVE_MM_MALLOC)
 set(RAJA_ENABLE_OPENMP ${ENABLE_OPENMP})
 set(RAJA_ENABLE_TARGET_OPENMP ${ENABLE_TARGET_OPENMP})
 set(RAJA_ENABLE_TBB ${ENABLE_TBB})
+set(RAJA_ENABLE_THREADS ${ENABLE_THREADS})
 set(RAJA_ENABLE_CUDA ${ENABLE_CUDA})
 set(RAJA_ENABLE_CLANG_CUDA ${ENABLE_CLANG_CUDA})
 set(RAJA_ENABLE_CHAI ${ENABLE_CHAI})
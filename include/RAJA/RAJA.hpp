@@ -29,6 +29,9 @@
 #include "RAJA/config.hpp"
 
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/Profiler.hpp"
+#include "RAJA/util/TileScratch.hpp"
+#include "RAJA/util/TileTuner.hpp"
 #include "RAJA/util/basic_mempool.hpp"
 #include "RAJA/util/camp_aliases.hpp"
 #include "RAJA/util/macros.hpp"
@@ -62,6 +65,10 @@
 #include "RAJA/policy/tbb.hpp"
 #endif
 
+#if defined(RAJA_ENABLE_THREADS)
+#include "RAJA/policy/threads.hpp"
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
 #include "RAJA/policy/cuda.hpp"
 #endif
@@ -128,6 +135,11 @@
 //
 #include "RAJA/pattern/synchronize.hpp"
 
+//
+// Asynchronous host execution
+//
+#include "RAJA/pattern/async.hpp"
+
 //
 //////////////////////////////////////////////////////////////////////
 //
@@ -147,4 +159,10 @@
 
 #include "RAJA/pattern/scan.hpp"
 
+#include "RAJA/pattern/sort.hpp"
+
+#include "RAJA/pattern/permute_copy.hpp"
+
+#include "RAJA/util/first_touch.hpp"
+
 #endif  // closing endif for header file include guard
@@ -20,10 +20,15 @@
 
 #include "RAJA/config.hpp"
 
+#include <memory>
+#include <new>
+
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
+#include "RAJA/internal/DepGraphNode.hpp"
 #include "RAJA/internal/Iterators.hpp"
+#include "RAJA/internal/MemUtils_CPU.hpp"
 #include "RAJA/internal/RAJAVec.hpp"
 
 #include "RAJA/policy/PolicyBase.hpp"
@@ -483,10 +488,17 @@ public:
   //! Set [begin, end) interval of segments identified by interval_id
   void setSegmentInterval(size_t interval_id, int begin, int end)
   {
+    if (interval_id >= m_seg_interval_begin.size()) {
+      m_seg_interval_begin.resize(interval_id + 1, 0);
+      m_seg_interval_end.resize(interval_id + 1, 0);
+    }
     m_seg_interval_begin[interval_id] = begin;
     m_seg_interval_end[interval_id] = end;
   }
 
+  //! get number of segment intervals that have been set
+  size_t getNumSegmentIntervals() const { return m_seg_interval_begin.size(); }
+
   //! get lower bound of segment identified with interval_id
   int getSegmentIntervalBegin(size_t interval_id) const
   {
@@ -589,11 +601,12 @@ public:
   //! create empty TypedIndexSet
   RAJA_INLINE TypedIndexSet() : m_len(0) {}
 
-  //! dtor cleans up segements that we own (none)
+  //! dtor cleans up segements that we own (none) and dependency graph
   RAJA_INLINE
-  ~TypedIndexSet() {}
+  ~TypedIndexSet() { freeDependencyGraph(); }
 
-  //! Copy-constructor.
+  //! Copy-constructor; the copy shares the dependency graph, which is
+  //! freed with the last index set holding it (a move also copies)
   RAJA_INLINE
   TypedIndexSet(TypedIndexSet const &c)
   {
@@ -601,6 +614,8 @@ public:
     segment_offsets = c.segment_offsets;
     segment_icounts = c.segment_icounts;
     m_len = c.m_len;
+    m_dep_graph = c.m_dep_graph;
+    m_dep_graph_size = c.m_dep_graph_size;
   }
 
   //! Swap function for copy-and-swap idiom (deep copy).
@@ -611,6 +626,78 @@ public:
     swap(segment_offsets, other.segment_offsets);
     swap(segment_icounts, other.segment_icounts);
     swap(m_len, other.m_len);
+    swap(m_dep_graph, other.m_dep_graph);
+    swap(m_dep_graph_size, other.m_dep_graph_size);
+  }
+
+  //!  @name Segment dependency graph methods
+  ///
+  /// The dependency graph holds one DepGraphNode per segment and is used
+  /// by task-graph segment iteration policies. It must be built after all
+  /// segments have been added to the index set:
+  ///
+  ///   iset.initDependencyGraph();
+  ///   iset.getSegmentDepGraphNode(i)->addDepTask(j);  // j waits for i
+  ///   ...
+  ///   iset.finalizeDependencyGraph();
+  ///
+
+  //! Allocate one (empty) dependency graph node per segment.
+  void initDependencyGraph()
+  {
+    freeDependencyGraph();
+    const size_t size = segment_types.size();
+    DepGraphNode *nodes = RAJA::allocate_aligned_type<DepGraphNode>(
+        alignof(DepGraphNode), size * sizeof(DepGraphNode));
+    for (size_t i = 0; i < size; ++i) {
+      new (&nodes[i]) DepGraphNode();
+    }
+    m_dep_graph.reset(nodes, [size](DepGraphNode *graph) {
+      for (size_t i = 0; i < size; ++i) {
+        graph[i].~DepGraphNode();
+      }
+      RAJA::free_aligned(graph);
+    });
+    m_dep_graph_size = size;
+  }
+
+  ///
+  /// Set the semaphore (reload) value of each node to the number of
+  /// segments it depends on, and ready the graph for execution.
+  ///
+  void finalizeDependencyGraph()
+  {
+    DepGraphNode *graph = m_dep_graph.get();
+    int num_ready = 0;
+    for (size_t i = 0; i < m_dep_graph_size; ++i) {
+      graph[i].semaphoreReloadValue() = 0;
+    }
+    for (size_t i = 0; i < m_dep_graph_size; ++i) {
+      DepGraphNode &task = graph[i];
+      for (int ii = 0; ii < task.numDepTasks(); ++ii) {
+        size_t dep = static_cast<size_t>(task.depTaskNum(ii));
+        if (dep >= m_dep_graph_size) {
+          RAJA_ABORT_OR_THROW("IndexSet dependency graph: invalid segment");
+        }
+        ++graph[dep].semaphoreReloadValue();
+      }
+    }
+    for (size_t i = 0; i < m_dep_graph_size; ++i) {
+      graph[i].reset();
+      num_ready += (graph[i].semaphoreReloadValue() == 0);
+    }
+    if (m_dep_graph_size > 0 && num_ready == 0) {
+      RAJA_ABORT_OR_THROW("IndexSet dependency graph: no ready segment");
+    }
+  }
+
+  //! Returns true if a dependency graph has been built for this index set.
+  bool dependencyGraphSet() const { return m_dep_graph != nullptr; }
+
+  //! Get the dependency graph node for the given segment.
+  DepGraphNode *getSegmentDepGraphNode(int segid) const
+  {
+    return &m_dep_graph.get()[segid];
   }
 
 protected:
@@ -746,6 +833,19 @@ private:
 
   //! Total length of all TypedIndexSet segments.
   Index_type m_len;
+
+  //! Segment dependency graph nodes:    seg_index -> node; shared by
+  //! copies of the index set
+  std::shared_ptr<DepGraphNode> m_dep_graph;
+
+  //! Number of nodes in the dependency graph
+  size_t m_dep_graph_size = 0;
+
+  void freeDependencyGraph()
+  {
+    m_dep_graph.reset();
+    m_dep_graph_size = 0;
+  }
 };
 
 
@@ -70,6 +70,11 @@ void buildTypedIndexSetAligned(IndexSet& hiset,
  * The method chunks a fastDim x midDim x slowDim mesh into blocks that can
  * be dependency-scheduled, removing need for lock constructs.
  *
+ * For 3d meshes (slowDim > 0) the segments are slabs of slowDim planes and
+ * the index set dependency graph is built so that no two neighboring slabs
+ * execute concurrently; use with a task-graph segment iteration policy,
+ * e.g., RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::loop_exec>.
+ *
  * Note: Method assumes TypedIndexSet reference refers to an empty index set.
  *
  ******************************************************************************
@@ -78,9 +83,9 @@ void buildLockFreeBlockIndexset(
     RAJA::TypedIndexSet<RAJA::RangeSegment,
                         RAJA::ListSegment,
                         RAJA::RangeStrideSegment>& iset,
-    int fastDim,
-    int midDim,
-    int slowDim);
+    Index_type fastDim,
+    Index_type midDim,
+    Index_type slowDim);
 
 /*
  ******************************************************************************
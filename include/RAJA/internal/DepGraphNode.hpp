@@ -26,6 +26,8 @@
 #include <iosfwd>
 #include <thread>
 
+#include "RAJA/internal/RAJAVec.hpp"
+
 #include "RAJA/util/types.hpp"
 
 namespace RAJA
@@ -42,16 +44,6 @@ namespace RAJA
 class RAJA_ALIGNED_ATTR(256) DepGraphNode
 {
 public:
-  ///
-  /// Constants for total number of allowable dependent tasks
-  /// and alignment of semaphore value (should match cache
-  /// coherence page size?).
-  ///
-  /// These values may need to be set differently for different
-  /// algorithms and platforms. We haven't determined the best defaults yet!
-  ///
-  static const int _MaxDepTasks_ = 8;
-
   ///
   /// Default ctor initializes node to default state.
   ///
@@ -78,14 +70,12 @@ public:
   void reset() { m_semaphore_value.store(m_semaphore_reload_value); }
 
   ///
-  /// Satisfy one incoming dependency
+  /// Satisfy one incoming dependency.
   ///
-  void satisfyOne()
-  {
-    if (m_semaphore_value > 0) {
-      --m_semaphore_value;
-    }
-  }
+  /// Returns true if this call satisfied the last outstanding dependency,
+  /// i.e., the caller is responsible for launching the task.
+  ///
+  bool satisfyOne() { return m_semaphore_value.fetch_sub(1) == 1; }
 
   ///
   /// Wait for all dependencies to be satisfied
@@ -110,7 +100,23 @@ public:
   /// index for this task. This is used to notify the appropriate external
   /// dependencies when this task completes.
   ///
-  int& depTaskNum(int tidx) { return m_dep_task[tidx]; }
+  int& depTaskNum(int tidx)
+  {
+    if (static_cast<size_t>(tidx) >= m_dep_task.size()) {
+      m_dep_task.resize(tidx + 1);
+    }
+    return m_dep_task[tidx];
+  }
+
+  ///
+  /// Get the forward dependency task number associated with the given index.
+  ///
+  int depTaskNum(int tidx) const { return m_dep_task[tidx]; }
+
+  ///
+  /// Append a forward dependency task number to this task.
+  ///
+  void addDepTask(int task_num) { depTaskNum(m_num_dep_tasks++) = task_num; }
 
   ///
   /// Print task graph object node data to given output stream.
@@ -118,7 +124,7 @@ public:
   void print(std::ostream& os) const;
 
 private:
-  int m_dep_task[_MaxDepTasks_];
+  RAJAVec<int> m_dep_task;
   int m_num_dep_tasks;
   int m_semaphore_reload_value;
   std::atomic<int> m_semaphore_value;
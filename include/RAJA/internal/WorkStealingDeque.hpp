@@ -0,0 +1,152 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a bounded work-stealing deque used to
+ *          schedule ready tasks across CPU threads.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_WorkStealingDeque_HPP
+#define RAJA_WorkStealingDeque_HPP
+
+#include "RAJA/config.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Bounded lock-free work-stealing deque (Chase-Lev).
+ *
+ *         The owning thread pushes and pops at the bottom; any other thread
+ *         may steal from the top. The deque does not grow, so the capacity
+ *         must be at least the total number of pushes made between calls
+ *         to clear(). T must be trivially copyable.
+ *
+ ******************************************************************************
+ */
+template <typename T>
+class WorkStealingDeque
+{
+public:
+  WorkStealingDeque() : m_top(0), m_bottom(0), m_capacity(0) {}
+
+  WorkStealingDeque(const WorkStealingDeque&) = delete;
+  WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+  ///
+  /// Allocate storage for the given number of items and empty the deque.
+  ///
+  void reserve(std::ptrdiff_t capacity)
+  {
+    if (capacity > m_capacity) {
+      m_data.reset(new std::atomic<T>[capacity]);
+      m_capacity = capacity;
+    }
+    clear();
+  }
+
+  ///
+  /// Empty the deque; must not be called concurrently with other methods.
+  ///
+  void clear()
+  {
+    m_top.store(0, std::memory_order_relaxed);
+    m_bottom.store(0, std::memory_order_relaxed);
+  }
+
+  ///
+  /// Push an item at the bottom (owner only).
+  ///
+  void push(T const& item)
+  {
+    std::ptrdiff_t b = m_bottom.load(std::memory_order_relaxed);
+    m_data[b % m_capacity].store(item, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_bottom.store(b + 1, std::memory_order_relaxed);
+  }
+
+  ///
+  /// Pop an item from the bottom (owner only). Returns false if empty.
+  ///
+  bool pop(T& item)
+  {
+    std::ptrdiff_t b = m_bottom.load(std::memory_order_relaxed) - 1;
+    m_bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::ptrdiff_t t = m_top.load(std::memory_order_relaxed);
+
+    if (t > b) {
+      m_bottom.store(b + 1, std::memory_order_relaxed);
+      return false;
+    }
+
+    item = m_data[b % m_capacity].load(std::memory_order_relaxed);
+    if (t == b) {
+      // last item, race against thieves
+      bool won = m_top.compare_exchange_strong(t,
+                                               t + 1,
+                                               std::memory_order_seq_cst,
+                                               std::memory_order_relaxed);
+      m_bottom.store(b + 1, std::memory_order_relaxed);
+      return won;
+    }
+    return true;
+  }
+
+  ///
+  /// Steal an item from the top (any thread). Returns false if the deque
+  /// is empty or the steal lost a race with another thread.
+  ///
+  bool steal(T& item)
+  {
+    std::ptrdiff_t t = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::ptrdiff_t b = m_bottom.load(std::memory_order_acquire);
+
+    if (t >= b) {
+      return false;
+    }
+
+    item = m_data[t % m_capacity].load(std::memory_order_relaxed);
+    return m_top.compare_exchange_strong(t,
+                                         t + 1,
+                                         std::memory_order_seq_cst,
+                                         std::memory_order_relaxed);
+  }
+
+private:
+  // top and bottom are written by different threads; keep them apart
+  static constexpr size_t pad_size = 64 - sizeof(std::atomic<std::ptrdiff_t>);
+
+  std::atomic<std::ptrdiff_t> m_top;
+  char m_pad0[pad_size];
+  std::atomic<std::ptrdiff_t> m_bottom;
+  std::unique_ptr<std::atomic<T>[]> m_data;
+  std::ptrdiff_t m_capacity;
+  char m_pad1[pad_size];
+};
+
+}  // namespace internal
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
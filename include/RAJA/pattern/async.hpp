@@ -0,0 +1,331 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing asynchronous host execution: resources
+ *          that run loops in order on their own thread, and events that
+ *          mark their completion.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_async_HPP
+#define RAJA_pattern_async_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "camp/camp.hpp"
+#include "camp/tuple.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/kernel.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! completion flag shared by an event and the work it marks
+struct event_state {
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool done = false;
+  std::exception_ptr error;
+
+  void signal(std::exception_ptr e)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      error = e;
+      done = true;
+    }
+    cv.notify_all();
+  }
+
+  void wait()
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [this]() { return done; });
+  }
+};
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Completion of work launched on a RAJA::host_resource.
+ *
+ *         Events are cheap to copy; all copies refer to the same work. A
+ *         default-constructed event is already complete.
+ *
+ ******************************************************************************
+ */
+class event
+{
+public:
+  event() = default;
+
+  //! true once the work is done; never blocks
+  bool query() const
+  {
+    if (!state) return true;
+    std::lock_guard<std::mutex> lock(state->mutex);
+    return state->done;
+  }
+
+  //! block until the work is done, rethrowing anything it threw
+  void wait() const
+  {
+    if (!state) return;
+    state->wait();
+    if (state->error) std::rethrow_exception(state->error);
+  }
+
+private:
+  friend class host_resource;
+
+  explicit event(std::shared_ptr<detail::event_state> s) : state(std::move(s))
+  {
+  }
+
+  std::shared_ptr<detail::event_state> state;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  In-order queue of host work with its own thread.
+ *
+ *         Work launched on a resource runs in launch order on the
+ *         resource's thread, while the launching thread carries on. Work on
+ *         different resources runs at the same time unless ordered with
+ *         wait_for():
+ *
+ *           RAJA::host_resource comm, comp;
+ *           RAJA::event packed = RAJA::forall<pol>(comm, halo, pack);
+ *           RAJA::forall<pol>(comp, interior, update);
+ *           comp.wait_for(packed);
+ *           RAJA::event done = RAJA::forall<pol>(comp, halo, unpack);
+ *           done.wait();
+ *
+ *         Any execution policy can be used; an OpenMP or thread pool loop
+ *         is parallel within itself as usual. The thread pool runs one
+ *         loop at a time, so a threads policy loop that starts while
+ *         another resource's is running executes on the resource's thread
+ *         alone.
+ *
+ *         The destructor finishes all launched work.
+ *
+ ******************************************************************************
+ */
+class host_resource
+{
+public:
+  host_resource() : worker([this]() { work(); }) {}
+
+  host_resource(const host_resource&) = delete;
+  host_resource& operator=(const host_resource&) = delete;
+
+  ~host_resource()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+    cv.notify_one();
+    worker.join();
+  }
+
+  /*!
+   * \brief Queue fn() behind the work already launched.
+   *
+   * fn is destroyed on the resource's thread before the returned event is
+   * signaled, so reducers captured by value have merged by then. An
+   * exception thrown by fn is rethrown by the event's wait().
+   */
+  template <typename Fn>
+  event launch(Fn&& fn)
+  {
+    auto state = std::make_shared<detail::event_state>();
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      queue.push_back(item{std::function<void()>(std::forward<Fn>(fn)),
+                           state});
+    }
+    cv.notify_one();
+    return event(std::move(state));
+  }
+
+  //! work launched from now on starts only after e is complete
+  void wait_for(event const& e)
+  {
+    if (e.query()) return;
+    std::shared_ptr<detail::event_state> dep = e.state;
+    launch([dep]() { dep->wait(); });
+  }
+
+  //! an event complete once all work launched so far is done
+  event record() { return launch([]() {}); }
+
+  //! block until all work launched so far is done
+  void wait() { record().wait(); }
+
+private:
+  struct item {
+    std::function<void()> fn;
+    std::shared_ptr<detail::event_state> done;
+  };
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::deque<item> queue;
+  bool stopping = false;
+  std::thread worker;
+
+  void work()
+  {
+    for (;;) {
+      item next;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this]() { return stopping || !queue.empty(); });
+        if (queue.empty()) return;
+        next = std::move(queue.front());
+        queue.pop_front();
+      }
+      std::exception_ptr error;
+      try {
+        next.fn();
+      } catch (...) {
+        error = std::current_exception();
+      }
+      next.fn = nullptr;
+      next.done->signal(error);
+    }
+  }
+};
+
+namespace detail
+{
+
+//! a launch's arguments, copied so they outlive the launching call
+template <typename Launcher, typename... Args>
+struct async_call {
+  camp::tuple<camp::decay<Args>...> args;
+
+  void operator()() { call(camp::make_idx_seq_t<sizeof...(Args)>{}); }
+
+  template <camp::idx_t... Is>
+  void call(camp::idx_seq<Is...>)
+  {
+    Launcher::launch(camp::get<Is>(args)...);
+  }
+};
+
+template <typename ExecutionPolicy>
+struct async_forall {
+  template <typename... Args>
+  static void launch(Args&... args)
+  {
+    RAJA::forall<ExecutionPolicy>(args...);
+  }
+};
+
+template <typename PolicyType>
+struct async_kernel {
+  template <typename... Args>
+  static void launch(Args&... args)
+  {
+    RAJA::kernel<PolicyType>(args...);
+  }
+};
+
+template <typename PolicyType>
+struct async_kernel_param {
+  template <typename... Args>
+  static void launch(Args&... args)
+  {
+    RAJA::kernel_param<PolicyType>(args...);
+  }
+};
+
+template <typename Launcher, typename... Args>
+RAJA_INLINE event async_launch(host_resource& res, Args&&... args)
+{
+  return res.launch(async_call<Launcher, Args...>{
+      camp::tuple<camp::decay<Args>...>{std::forward<Args>(args)...}});
+}
+
+}  // namespace detail
+
+/*!
+ * \brief forall launched on a resource; returns its completion event.
+ *
+ * The segment, loop body and any other arguments are copied, as for the
+ * synchronous forall they are passed on to unchanged.
+ */
+template <typename ExecutionPolicy, typename... Args>
+RAJA_INLINE event forall(host_resource& res, Args&&... args)
+{
+  return detail::async_launch<detail::async_forall<ExecutionPolicy>>(
+      res, std::forward<Args>(args)...);
+}
+
+//! kernel launched on a resource; returns its completion event
+template <typename PolicyType, typename SegmentTuple, typename... Bodies>
+RAJA_INLINE event kernel(host_resource& res,
+                         SegmentTuple&& segments,
+                         Bodies&&... bodies)
+{
+  return detail::async_launch<detail::async_kernel<PolicyType>>(
+      res,
+      std::forward<SegmentTuple>(segments),
+      std::forward<Bodies>(bodies)...);
+}
+
+//! kernel_param launched on a resource; returns its completion event
+template <typename PolicyType,
+          typename SegmentTuple,
+          typename ParamTuple,
+          typename... Bodies>
+RAJA_INLINE event kernel_param(host_resource& res,
+                               SegmentTuple&& segments,
+                               ParamTuple&& params,
+                               Bodies&&... bodies)
+{
+  return detail::async_launch<detail::async_kernel_param<PolicyType>>(
+      res,
+      std::forward<SegmentTuple>(segments),
+      std::forward<ParamTuple>(params),
+      std::forward<Bodies>(bodies)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREADS)
+
+#endif  // closing endif for header file include guard
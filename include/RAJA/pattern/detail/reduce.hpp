@@ -18,7 +18,14 @@
 #ifndef RAJA_PATTERN_DETAIL_REDUCE_HPP
 #define RAJA_PATTERN_DETAIL_REDUCE_HPP
 
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/SuperAccumulator.hpp"
+#include "RAJA/util/VectorIndex.hpp"
+#include "RAJA/util/mutex.hpp"
 #include "RAJA/util/types.hpp"
 
 #define RAJA_DECLARE_REDUCER(OP, POL, COMBINER)               \
@@ -110,6 +117,50 @@ struct DefaultLoc<T, true>
   RAJA_HOST_DEVICE constexpr T value() { return -1; }
 };
 
+//! whether IndexType has an operator< that can break ties between values
+template <typename IndexType, typename = void>
+struct loc_is_ordered : std::false_type {
+};
+
+template <typename IndexType>
+struct loc_is_ordered<IndexType,
+                      decltype(void(std::declval<IndexType const &>()
+                                    < std::declval<IndexType const &>()))>
+    : std::true_type {
+};
+
+template <typename IndexType>
+RAJA_HOST_DEVICE constexpr bool loc_before(IndexType const &a,
+                                           IndexType const &b,
+                                           std::true_type)
+{
+  return a < b;
+}
+
+template <typename IndexType>
+RAJA_HOST_DEVICE constexpr bool loc_before(IndexType const &,
+                                           IndexType const &,
+                                           std::false_type)
+{
+  return false;
+}
+
+//! true if location a is preferred over b when their values are equal
+template <typename IndexType>
+RAJA_HOST_DEVICE constexpr bool loc_before(IndexType const &a,
+                                           IndexType const &b)
+{
+  return loc_before(a, b, loc_is_ordered<IndexType>{});
+}
+
+/*!
+ * Value and location of a MinLoc/MaxLoc reduction.
+ *
+ * Values are ordered by value and then, for equal values, so that the
+ * smaller location compares as the better one (when IndexType has an
+ * operator<). The order is total, so a reduction returns the same value
+ * and location whatever order thread-private results are combined in.
+ */
 template <typename T, typename IndexType, bool doing_min = true>
 class ValueLoc
 {
@@ -132,11 +183,95 @@ public:
   RAJA_HOST_DEVICE IndexType getLoc() { return loc; }
   RAJA_HOST_DEVICE bool operator<(ValueLoc const &rhs) const
   {
-    return val < rhs.val;
+    return val < rhs.val
+           || (val == rhs.val
+               && (doing_min ? loc_before(loc, rhs.loc)
+                             : loc_before(rhs.loc, loc)));
   }
   RAJA_HOST_DEVICE bool operator>(ValueLoc const &rhs) const
   {
-    return val > rhs.val;
+    return rhs < *this;
+  }
+};
+
+/*!
+ * Lanes of the vector minloc()/maxloc() accumulators: the widest run a
+ * vector_exec body may pass, so that narrower runs rotate through several
+ * banks of lanes. This costs 16 * (sizeof(T) + sizeof(IndexType)) bytes in
+ * each MinLoc/MaxLoc reducer, 256 for double and Index_type, which is
+ * small next to the cost of making a thread-private copy; copies do not
+ * copy the lanes but start with them inactive.
+ */
+constexpr camp::idx_t loc_lanes_max = 16;
+
+/*!
+ * Per-lane value and location accumulators for MinLoc/MaxLoc reducers fed
+ * a run of values at a time by vector_exec loop bodies.
+ *
+ * An update blends a whole run into the lanes with the ValueLoc order, so
+ * the loop carries no scalar compare-and-branch; the lanes are folded into
+ * a single ValueLoc only when the reducer is read or destroyed.
+ */
+template <typename T, typename IndexType, bool doing_min>
+struct ValueLocLanes {
+  using value_type = ValueLoc<T, IndexType, doing_min>;
+
+  // zeroed so that no path reads them uninitialized; they hold the
+  // identity from the first update on
+  T val[loc_lanes_max]{};
+  IndexType loc[loc_lanes_max]{};
+  bool active = false;
+
+  template <typename VIndex, camp::idx_t Width>
+  RAJA_INLINE void update(simd_register<T, Width> const &v,
+                          vector_index<VIndex, Width> const &idx)
+  {
+    static_assert(Width <= loc_lanes_max,
+                  "vector loc reductions support at most 16 lanes");
+    static_assert(std::is_arithmetic<IndexType>::value,
+                  "vector loc reductions need an arithmetic IndexType");
+    if (!active) {
+      const value_type identity;
+      for (camp::idx_t k = 0; k < loc_lanes_max; ++k) {
+        val[k] = identity.val;
+        loc[k] = identity.loc;
+      }
+      active = true;
+    }
+
+    // consecutive runs go to different banks of Width lanes, so updates
+    // do not wait on the lanes stored by the previous call
+    constexpr camp::idx_t banks = loc_lanes_max / Width;
+    const IndexType first = static_cast<IndexType>(stripIndexType(idx.first));
+    const camp::idx_t bank = static_cast<camp::idx_t>(
+        static_cast<std::size_t>(first) / Width % banks);
+    T* bval = val + bank * Width;
+    IndexType* bloc = loc + bank * Width;
+
+    T in[Width];
+    v.store(in);
+    const camp::idx_t n = idx.size();
+    RAJA_SIMD
+    for (camp::idx_t k = 0; k < Width; ++k) {
+      const IndexType l = first + static_cast<IndexType>(k);
+      // bitwise, not short-circuit, operators keep the body branch free
+      const bool better = doing_min ? in[k] < bval[k] : bval[k] < in[k];
+      const bool take =
+          (k < n) & (better | ((in[k] == bval[k]) & (l < bloc[k])));
+      bval[k] = take ? in[k] : bval[k];
+      bloc[k] = take ? l : bloc[k];
+    }
+  }
+
+  //! the best lane; only meaningful when active
+  RAJA_INLINE value_type fold() const
+  {
+    value_type res(val[0], loc[0]);
+    for (camp::idx_t k = 1; k < loc_lanes_max; ++k) {
+      const value_type lane(val[k], loc[k]);
+      if (doing_min ? lane < res : res < lane) res = lane;
+    }
+    return res;
   }
 };
 
@@ -172,6 +307,7 @@ class BaseReduce
 public:
   using value_type = T;
   using reduce_type = Reduce;
+  using combiner_type = Combiner_t;
 
   RAJA_SUPPRESS_HD_WARN
   RAJA_HOST_DEVICE
@@ -214,6 +350,13 @@ public:
 
   T &local() const { return c.local(); }
 
+  //! fold the accumulator of a reduce_params loop into this reducer
+  template <typename Param>
+  void merge_param(Param const &param) const
+  {
+    param.merge_into(c);
+  }
+
   //! Get the calculated reduced value
   operator T() const { return c.get(); }
 
@@ -292,6 +435,236 @@ private:
   Derived &derived() { return *(static_cast<Derived *>(this)); }
 };
 
+/*!
+ * Partial result of a deterministic reduction. Min, max and the loc
+ * reductions, and sums of integers, are exact in any order already.
+ */
+template <typename T, typename Reduce, typename Enable = void>
+struct DeterministicPartial {
+  T value;
+
+  static constexpr bool exact_sum = false;
+
+  explicit DeterministicPartial(T const &identity) : value(identity) {}
+
+  void set(T const &init_val) { value = init_val; }
+
+  RAJA_INLINE void add(T const &v) { Reduce{}(value, v); }
+
+  void merge(DeterministicPartial const &other)
+  {
+    Reduce{}(value, other.value);
+  }
+
+  T get() const { return value; }
+};
+
+/*!
+ * float and double sums are accumulated exactly and rounded once. The
+ * accumulator only covers the double range, so long double sums are kept
+ * in long double like the other reductions, and are not reproducible.
+ */
+template <typename T>
+struct DeterministicPartial<
+    T,
+    RAJA::reduce::sum<T>,
+    typename std::enable_if<std::is_same<T, float>::value ||
+                            std::is_same<T, double>::value>::type> {
+  static constexpr bool exact_sum = true;
+
+  super_accumulator acc;
+
+  explicit DeterministicPartial(T const &) {}
+
+  void set(T const &init_val)
+  {
+    acc.clear();
+    acc.add(init_val);
+  }
+
+  RAJA_INLINE void add(T const &v) { acc.add(v); }
+
+  void merge(DeterministicPartial const &other) { acc.add(other.acc); }
+
+  T get() const { return acc.get<T>(); }
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Combiner giving bitwise reproducible results for any number of
+ *         threads and any schedule.
+ *
+ *         Each thread-private copy accumulates its own partial result and
+ *         merges it into the root reducer, under Mutex, when destroyed.
+ *         Floating-point sums are kept exact (see super_accumulator), so
+ *         neither the way iterations are split between threads nor the
+ *         order the copies merge in changes the rounded result.
+ *
+ ******************************************************************************
+ */
+template <typename T, typename Reduce, typename Mutex>
+class BaseDeterministicCombinable
+{
+  using Partial = DeterministicPartial<T, Reduce>;
+
+  BaseDeterministicCombinable const *parent = nullptr;
+  T identity;
+  Partial mutable partial;
+  Mutex mutable mutex;
+
+public:
+  //! whether partial sums are kept exact, see merge_exact
+  static constexpr bool exact_sum = Partial::exact_sum;
+
+  BaseDeterministicCombinable(T init_val, T identity_)
+      : identity{identity_}, partial{identity_}
+  {
+    partial.set(init_val);
+  }
+
+  BaseDeterministicCombinable(BaseDeterministicCombinable const &other)
+      : parent{other.parent ? other.parent : &other},
+        identity{other.identity},
+        partial{other.identity}
+  {
+  }
+
+  ~BaseDeterministicCombinable()
+  {
+    if (parent) {
+      RAJA::lock_guard<Mutex> lock(parent->mutex);
+      parent->partial.merge(partial);
+    }
+  }
+
+  void reset(T init_val, T identity_)
+  {
+    identity = identity_;
+    partial = Partial{identity_};
+    partial.set(init_val);
+  }
+
+  RAJA_INLINE void combine(T const &other) { partial.add(other); }
+
+  //! add an exact partial sum; only for float and double sums
+  void merge_exact(super_accumulator const &other) { partial.acc.add(other); }
+
+  //! the reduced value; complete once all copies have been destroyed
+  T get() const { return parent ? parent->get() : partial.get(); }
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Thread-local accumulators handed to the body of a forall given
+ *         RAJA::reduce_params (see RAJA/pattern/reduce_params.hpp).
+ *
+ *         They are plain values with the update interface of the matching
+ *         reducer, so the compiler can keep them in registers; each is
+ *         folded into its reducer once per thread with merge_into.
+ *
+ ******************************************************************************
+ */
+template <typename T, typename Reduce>
+struct ParamValue {
+  T value;
+
+  ParamValue() : value(Reduce::identity()) {}
+
+  template <typename Combiner>
+  void merge_into(Combiner &c) const
+  {
+    c.combine(value);
+  }
+};
+
+template <typename T>
+struct ParamSum : ParamValue<T, RAJA::reduce::sum<T>> {
+  RAJA_INLINE ParamSum &operator+=(T rhs)
+  {
+    this->value += rhs;
+    return *this;
+  }
+};
+
+template <typename T>
+struct ParamMin : ParamValue<T, RAJA::reduce::min<T>> {
+  RAJA_INLINE ParamMin &min(T rhs)
+  {
+    RAJA::reduce::min<T>{}(this->value, rhs);
+    return *this;
+  }
+};
+
+template <typename T>
+struct ParamMax : ParamValue<T, RAJA::reduce::max<T>> {
+  RAJA_INLINE ParamMax &max(T rhs)
+  {
+    RAJA::reduce::max<T>{}(this->value, rhs);
+    return *this;
+  }
+};
+
+//! ties keep the smaller index, as the MinLoc reducers do
+template <typename T, typename IndexType>
+struct ParamMinLoc
+    : ParamValue<ValueLoc<T, IndexType>,
+                 RAJA::reduce::min<ValueLoc<T, IndexType>>> {
+  RAJA_INLINE ParamMinLoc &minloc(T rhs, IndexType loc)
+  {
+    const ValueLoc<T, IndexType> v(rhs, loc);
+    if (v < this->value) this->value = v;
+    return *this;
+  }
+};
+
+template <typename T, typename IndexType>
+struct ParamMaxLoc
+    : ParamValue<ValueLoc<T, IndexType, false>,
+                 RAJA::reduce::max<ValueLoc<T, IndexType, false>>> {
+  RAJA_INLINE ParamMaxLoc &maxloc(T rhs, IndexType loc)
+  {
+    const ValueLoc<T, IndexType, false> v(rhs, loc);
+    if (this->value < v) this->value = v;
+    return *this;
+  }
+};
+
+//! float or double sum for a deterministic reducer, kept exact until merged
+template <typename T>
+struct ParamExactSum {
+  super_accumulator acc;
+
+  RAJA_INLINE ParamExactSum &operator+=(T rhs)
+  {
+    acc.add(rhs);
+    return *this;
+  }
+
+  template <typename Combiner>
+  void merge_into(Combiner &c) const
+  {
+    c.merge_exact(acc);
+  }
+};
+
+template <typename Combiner, typename Enable = void>
+struct combines_exact_sum : std::false_type {
+};
+
+template <typename Combiner>
+struct combines_exact_sum<
+    Combiner,
+    typename std::enable_if<Combiner::exact_sum>::type> : std::true_type {
+};
+
+template <typename T, typename Combiner>
+using param_sum_type =
+    typename std::conditional<combines_exact_sum<Combiner>::value,
+                              ParamExactSum<T>,
+                              ParamSum<T>>::type;
+
 /*!
  ******************************************************************************
  *
@@ -307,6 +680,7 @@ class BaseReduceMin : public BaseReduce<T, RAJA::reduce::min, Combiner>
 public:
   using Base = BaseReduce<T, RAJA::reduce::min, Combiner>;
   using Base::Base;
+  using param_type = ParamMin<T>;
 
   //! reducer function; updates the current instance's state
   const BaseReduceMin &min(T rhs) const
@@ -331,14 +705,27 @@ public:
   using Base = BaseReduce<ValueLoc<T, IndexType>, RAJA::reduce::min, Combiner>;
   using value_type = typename Base::value_type;
   using Base::Base;
+  using param_type = ParamMinLoc<T, IndexType>;
 
-  constexpr BaseReduceMinLoc() : Base(value_type(T(), IndexType())) {}
+  BaseReduceMinLoc() : Base(value_type(T(), IndexType())) {}
 
-  constexpr BaseReduceMinLoc(T init_val, IndexType init_idx)
+  BaseReduceMinLoc(T init_val, IndexType init_idx)
       : Base(value_type(init_val, init_idx))
   {
   }
 
+  //! copies start with empty vector lanes
+  BaseReduceMinLoc(const BaseReduceMinLoc &copy) : Base(copy) {}
+
+  ~BaseReduceMinLoc() { flush(); }
+
+  void reset(value_type init_val,
+             value_type identity_ = Base::reduce_type::identity())
+  {
+    lanes.active = false;
+    Base::reset(init_val, identity_);
+  }
+
   /// \brief reducer function; updates the current instance's state
   const BaseReduceMinLoc &minloc(T rhs, IndexType loc) const
   {
@@ -346,11 +733,45 @@ public:
     return *this;
   }
 
+  /// \brief reducer function for a run of values from a vector_exec loop
+  template <typename VIndex, camp::idx_t Width>
+  const BaseReduceMinLoc &minloc(simd_register<T, Width> const &rhs,
+                                 vector_index<VIndex, Width> const &loc) const
+  {
+    lanes.update(rhs, loc);
+    return *this;
+  }
+
+  template <typename U, typename VIndex, camp::idx_t Width>
+  const BaseReduceMinLoc &minloc(vector_ref<U, Width> const &rhs,
+                                 vector_index<VIndex, Width> const &loc) const
+  {
+    return minloc(rhs.load(), loc);
+  }
+
+  //! Get the calculated reduced value
+  value_type get() const
+  {
+    flush();
+    return Base::get();
+  }
+
   //! Get the calculated reduced value
-  IndexType getLoc() const { return Base::get().getLoc(); }
+  IndexType getLoc() const { return get().getLoc(); }
 
   //! Get the calculated reduced value
-  operator T() const { return Base::get(); }
+  operator T() const { return get(); }
+
+private:
+  ValueLocLanes<T, IndexType, true> mutable lanes;
+
+  void flush() const
+  {
+    if (lanes.active) {
+      lanes.active = false;
+      this->combine(lanes.fold());
+    }
+  }
 };
 
 /*!
@@ -366,6 +787,7 @@ class BaseReduceMax : public BaseReduce<T, RAJA::reduce::max, Combiner>
 public:
   using Base = BaseReduce<T, RAJA::reduce::max, Combiner>;
   using Base::Base;
+  using param_type = ParamMax<T>;
 
   //! reducer function; updates the current instance's state
   const BaseReduceMax &max(T rhs) const
@@ -388,6 +810,7 @@ class BaseReduceSum : public BaseReduce<T, RAJA::reduce::sum, Combiner>
 public:
   using Base = BaseReduce<T, RAJA::reduce::sum, Combiner>;
   using Base::Base;
+  using param_type = param_sum_type<T, typename Base::combiner_type>;
 
   //! reducer function; updates the current instance's state
   RAJA_SUPPRESS_HD_WARN
@@ -414,14 +837,27 @@ public:
   using Base = BaseReduce<ValueLoc<T, IndexType, false>, RAJA::reduce::max, Combiner>;
   using value_type = typename Base::value_type;
   using Base::Base;
+  using param_type = ParamMaxLoc<T, IndexType>;
 
-  constexpr BaseReduceMaxLoc() : Base(value_type(T(), IndexType())) {}
+  BaseReduceMaxLoc() : Base(value_type(T(), IndexType())) {}
 
-  constexpr BaseReduceMaxLoc(T init_val, IndexType init_idx)
+  BaseReduceMaxLoc(T init_val, IndexType init_idx)
       : Base(value_type(init_val, init_idx))
   {
   }
 
+  //! copies start with empty vector lanes
+  BaseReduceMaxLoc(const BaseReduceMaxLoc &copy) : Base(copy) {}
+
+  ~BaseReduceMaxLoc() { flush(); }
+
+  void reset(value_type init_val,
+             value_type identity_ = Base::reduce_type::identity())
+  {
+    lanes.active = false;
+    Base::reset(init_val, identity_);
+  }
+
   //! reducer function; updates the current instance's state
   const BaseReduceMaxLoc &maxloc(T rhs, IndexType loc) const
   {
@@ -429,11 +865,45 @@ public:
     return *this;
   }
 
+  //! reducer function for a run of values from a vector_exec loop
+  template <typename VIndex, camp::idx_t Width>
+  const BaseReduceMaxLoc &maxloc(simd_register<T, Width> const &rhs,
+                                 vector_index<VIndex, Width> const &loc) const
+  {
+    lanes.update(rhs, loc);
+    return *this;
+  }
+
+  template <typename U, typename VIndex, camp::idx_t Width>
+  const BaseReduceMaxLoc &maxloc(vector_ref<U, Width> const &rhs,
+                                 vector_index<VIndex, Width> const &loc) const
+  {
+    return maxloc(rhs.load(), loc);
+  }
+
+  //! Get the calculated reduced value
+  value_type get() const
+  {
+    flush();
+    return Base::get();
+  }
+
   //! Get the calculated reduced value
-  IndexType getLoc() const { return Base::get().getLoc(); }
+  IndexType getLoc() const { return get().getLoc(); }
 
   //! Get the calculated reduced value
-  operator T() const { return Base::get(); }
+  operator T() const { return get(); }
+
+private:
+  ValueLocLanes<T, IndexType, false> mutable lanes;
+
+  void flush() const
+  {
+    if (lanes.active) {
+      lanes.active = false;
+      this->combine(lanes.fold());
+    }
+  }
 };
 
 }  // namespace detail
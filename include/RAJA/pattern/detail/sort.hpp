@@ -0,0 +1,650 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Internal header providing the back-end independent pieces of the
+ *          RAJA sort implementations (parallel merge sort and LSD radix sort).
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_DETAIL_SORT_HPP
+#define RAJA_PATTERN_DETAIL_SORT_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+namespace detail
+{
+
+//! smallest number of elements worth giving to a separate task
+constexpr std::ptrdiff_t sort_min_chunk = 1 << 12;
+
+//! smallest range for which the radix sort beats the merge sort
+constexpr std::ptrdiff_t radix_min_size = 1 << 16;
+
+//! bits per radix digit and the matching number of buckets
+constexpr int radix_digit_bits = 8;
+constexpr int radix_size = 1 << radix_digit_bits;
+
+RAJA_INLINE
+std::ptrdiff_t chunk_begin(std::ptrdiff_t n, int p, int c)
+{
+  return static_cast<std::ptrdiff_t>((static_cast<size_t>(n) * c) / p);
+}
+
+/*!
+        \brief number of chunks to split n elements into given the number of
+   tasks a back end can run concurrently
+*/
+RAJA_INLINE
+int num_chunks(int max_tasks, std::ptrdiff_t n)
+{
+  const std::ptrdiff_t by_size = n / sort_min_chunk;
+  return static_cast<int>(
+      std::max(std::ptrdiff_t(1),
+               std::min(by_size, static_cast<std::ptrdiff_t>(max_tasks))));
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Describes whether Key ordered by Compare can be sorted by its bits.
+ *
+ *         Integral keys compared with less or greater map to unsigned bit
+ *         patterns that order the same way, which is what the radix sort
+ *         works on. Everything else falls back to the merge sort.
+ *
+ ******************************************************************************
+ */
+template <typename Key, bool = std::is_integral<Key>::value>
+struct radix_key {
+  static constexpr bool value = false;
+  using bits_type = unsigned char;
+};
+
+template <typename Key>
+struct radix_key<Key, true> {
+  static constexpr bool value = !std::is_same<Key, bool>::value;
+  using bits_type = typename std::make_unsigned<Key>::type;
+
+  RAJA_INLINE static bits_type bits(Key k)
+  {
+    // flip the sign bit so negative values order before positive ones
+    return std::is_signed<Key>::value
+               ? static_cast<bits_type>(
+                     static_cast<bits_type>(k)
+                     ^ (bits_type(1) << (sizeof(Key) * CHAR_BIT - 1)))
+               : static_cast<bits_type>(k);
+  }
+};
+
+template <typename Key, typename Compare>
+struct radix_ordering {
+  static constexpr bool value = false;
+};
+
+template <typename Key, bool Descending>
+struct radix_ordering_base {
+  static constexpr bool value = radix_key<Key>::value;
+  using bits_type = typename radix_key<Key>::bits_type;
+
+  RAJA_INLINE static bits_type bits(Key k)
+  {
+    return Descending ? static_cast<bits_type>(~radix_key<Key>::bits(k))
+                      : radix_key<Key>::bits(k);
+  }
+};
+
+template <typename Key>
+struct radix_ordering<Key, operators::less<Key>>
+    : radix_ordering_base<Key, false> {
+};
+template <typename Key>
+struct radix_ordering<Key, std::less<Key>> : radix_ordering_base<Key, false> {
+};
+template <typename Key>
+struct radix_ordering<Key, operators::greater<Key>>
+    : radix_ordering_base<Key, true> {
+};
+template <typename Key>
+struct radix_ordering<Key, std::greater<Key>>
+    : radix_ordering_base<Key, true> {
+};
+
+/*!
+        \brief serial sort of [begin, end), stable or not
+*/
+template <bool Stable, typename Iter, typename Compare>
+RAJA_INLINE void serial_sort(Iter begin, Iter end, Compare comp)
+{
+  if (Stable) {
+    std::stable_sort(begin, end, comp);
+  } else {
+    std::sort(begin, end, comp);
+  }
+}
+
+/*!
+        \brief merge path split: the number of elements of a taken by the
+   first diag outputs of a stable merge of a[0, na) and b[0, nb)
+*/
+template <typename IterA, typename IterB, typename Compare>
+RAJA_INLINE std::ptrdiff_t merge_split(IterA a,
+                                       std::ptrdiff_t na,
+                                       IterB b,
+                                       std::ptrdiff_t nb,
+                                       std::ptrdiff_t diag,
+                                       Compare comp)
+{
+  std::ptrdiff_t lo = std::max(std::ptrdiff_t(0), diag - nb);
+  std::ptrdiff_t hi = std::min(diag, na);
+  while (lo < hi) {
+    const std::ptrdiff_t mid = lo + (hi - lo) / 2;
+    // on ties the element of a goes first, which keeps the merge stable
+    if (comp(b[diag - mid - 1], a[mid])) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+  return lo;
+}
+
+/*!
+        \brief merge the part [d0, d1) of the merged output of the sorted runs
+   src[lo, mid) and src[mid, hi) into dst[lo + d0, lo + d1)
+*/
+template <typename SrcIter, typename DstIter, typename Compare>
+RAJA_INLINE void merge_part(SrcIter src,
+                            DstIter dst,
+                            std::ptrdiff_t lo,
+                            std::ptrdiff_t mid,
+                            std::ptrdiff_t hi,
+                            std::ptrdiff_t d0,
+                            std::ptrdiff_t d1,
+                            Compare comp)
+{
+  SrcIter a = src + lo;
+  SrcIter b = src + mid;
+  const std::ptrdiff_t na = mid - lo;
+  const std::ptrdiff_t nb = hi - mid;
+  const std::ptrdiff_t i0 = merge_split(a, na, b, nb, d0, comp);
+  const std::ptrdiff_t i1 = merge_split(a, na, b, nb, d1, comp);
+  std::merge(std::make_move_iterator(a + i0),
+             std::make_move_iterator(a + i1),
+             std::make_move_iterator(b + (d0 - i0)),
+             std::make_move_iterator(b + (d1 - i1)),
+             dst + lo + d0,
+             comp);
+}
+
+template <typename SrcIter, typename DstIter>
+RAJA_INLINE void move_part(SrcIter src,
+                           DstIter dst,
+                           std::ptrdiff_t i0,
+                           std::ptrdiff_t i1)
+{
+  std::move(src + i0, src + i1, dst + i0);
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Parallel merge sort of n elements starting at begin.
+ *
+ *         Exec is a back-end adapter providing max_tasks() and
+ *         for_each_task(ntasks, f), which calls f(t) for t in [0, ntasks)
+ *         in parallel. The range is cut into one chunk per task and the
+ *         chunks are sorted serially; the sorted runs are then merged
+ *         pairwise, with every merge split along its merge path so all
+ *         tasks stay busy in each round.
+ *
+ ******************************************************************************
+ */
+template <bool Stable, typename Exec, typename Iter, typename Compare>
+void merge_sort(Exec const& exec, Iter begin, std::ptrdiff_t n, Compare comp)
+{
+  using Value = typename std::iterator_traits<Iter>::value_type;
+
+  const int p = num_chunks(exec.max_tasks(), n);
+  if (p <= 1) {
+    serial_sort<Stable>(begin, begin + n, comp);
+    return;
+  }
+
+  exec.for_each_task(p, [=](int c) {
+    serial_sort<Stable>(begin + chunk_begin(n, p, c),
+                        begin + chunk_begin(n, p, c + 1),
+                        comp);
+  });
+
+  std::vector<Value> buffer(n);
+  Value* buf = buffer.data();
+  bool in_buffer = false;
+
+  for (int width = 1; width < p; width *= 2) {
+    const int merges = (p + 2 * width - 1) / (2 * width);
+    const int parts = std::max(1, p / merges);
+    exec.for_each_task(merges * parts, [=](int t) {
+      const int m = t / parts;
+      const int k = t % parts;
+      const int c0 = 2 * m * width;
+      const std::ptrdiff_t lo = chunk_begin(n, p, c0);
+      const std::ptrdiff_t mid = chunk_begin(n, p, std::min(c0 + width, p));
+      const std::ptrdiff_t hi = chunk_begin(n, p, std::min(c0 + 2 * width, p));
+      const std::ptrdiff_t d0 = chunk_begin(hi - lo, parts, k);
+      const std::ptrdiff_t d1 = chunk_begin(hi - lo, parts, k + 1);
+      if (in_buffer) {
+        merge_part(buf, begin, lo, mid, hi, d0, d1, comp);
+      } else {
+        merge_part(begin, buf, lo, mid, hi, d0, d1, comp);
+      }
+    });
+    in_buffer = !in_buffer;
+  }
+
+  if (in_buffer) {
+    exec.for_each_task(p, [=](int c) {
+      move_part(buf, begin, chunk_begin(n, p, c), chunk_begin(n, p, c + 1));
+    });
+  }
+}
+
+/*!
+        \brief placeholder for the values of a keys-only radix sort
+*/
+struct no_values {
+  no_values operator+(std::ptrdiff_t) const { return *this; }
+};
+
+template <typename ValIter>
+struct radix_value_buffer {
+  using value_type = typename std::iterator_traits<ValIter>::value_type;
+  std::vector<value_type> data;
+  explicit radix_value_buffer(std::ptrdiff_t n) : data(n) {}
+  value_type* begin() { return data.data(); }
+};
+
+template <>
+struct radix_value_buffer<no_values> {
+  explicit radix_value_buffer(std::ptrdiff_t) {}
+  no_values begin() { return no_values{}; }
+};
+
+template <typename SrcIter, typename DstIter>
+RAJA_INLINE void radix_move(SrcIter src,
+                            DstIter dst,
+                            std::ptrdiff_t i,
+                            std::ptrdiff_t j)
+{
+  dst[j] = std::move(src[i]);
+}
+
+RAJA_INLINE void radix_move(no_values,
+                            no_values,
+                            std::ptrdiff_t,
+                            std::ptrdiff_t)
+{
+}
+
+/*!
+        \brief count the digits at shift of the keys in [i0, i1) into the
+   column c of the digit-major table counts
+*/
+template <typename Ordering, typename KeyIter>
+RAJA_INLINE void radix_count(KeyIter keys,
+                             std::ptrdiff_t i0,
+                             std::ptrdiff_t i1,
+                             int shift,
+                             std::ptrdiff_t* counts,
+                             int p,
+                             int c)
+{
+  std::ptrdiff_t local[radix_size] = {0};
+  for (std::ptrdiff_t i = i0; i < i1; ++i) {
+    ++local[(Ordering::bits(keys[i]) >> shift) & (radix_size - 1)];
+  }
+  for (int d = 0; d < radix_size; ++d) {
+    counts[d * p + c] = local[d];
+  }
+}
+
+/*!
+        \brief stable scatter of the keys (and values) in [i0, i1) to the
+   offsets held in column c of the scanned digit-major table counts
+*/
+template <typename Ordering,
+          typename SrcKeys,
+          typename SrcVals,
+          typename DstKeys,
+          typename DstVals>
+RAJA_INLINE void radix_scatter(SrcKeys src_keys,
+                               SrcVals src_vals,
+                               DstKeys dst_keys,
+                               DstVals dst_vals,
+                               std::ptrdiff_t i0,
+                               std::ptrdiff_t i1,
+                               int shift,
+                               const std::ptrdiff_t* counts,
+                               int p,
+                               int c)
+{
+  std::ptrdiff_t offset[radix_size];
+  for (int d = 0; d < radix_size; ++d) {
+    offset[d] = counts[d * p + c];
+  }
+  for (std::ptrdiff_t i = i0; i < i1; ++i) {
+    const std::ptrdiff_t j =
+        offset[(Ordering::bits(src_keys[i]) >> shift) & (radix_size - 1)]++;
+    dst_keys[j] = std::move(src_keys[i]);
+    radix_move(src_vals, dst_vals, i, j);
+  }
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Parallel LSD radix sort of n integral keys, optionally carrying
+ *         values along.
+ *
+ *         Each pass counts the digits of every chunk into a digit-major
+ *         table, turns the table into scatter offsets with the back end's
+ *         exclusive scan (Exec::exclusive_scan) and then scatters every
+ *         chunk stably. Passes in which all keys share a digit are skipped.
+ *         The sort is stable.
+ *
+ ******************************************************************************
+ */
+template <typename Ordering, typename Exec, typename KeyIter, typename ValIter>
+void radix_sort(Exec const& exec, KeyIter keys, std::ptrdiff_t n, ValIter vals)
+{
+  using Key = typename std::iterator_traits<KeyIter>::value_type;
+  using Bits = typename Ordering::bits_type;
+
+  const int p = num_chunks(exec.max_tasks(), n);
+
+  std::vector<Key> key_buffer(n);
+  Key* kbuf = key_buffer.data();
+  radix_value_buffer<ValIter> val_buffer(n);
+  auto vbuf = val_buffer.begin();
+  std::vector<std::ptrdiff_t> table(radix_size * p);
+  std::ptrdiff_t* counts = table.data();
+
+  bool in_buffer = false;
+  for (int shift = 0; shift < static_cast<int>(sizeof(Bits) * CHAR_BIT);
+       shift += radix_digit_bits) {
+
+    exec.for_each_task(p, [=](int c) {
+      const std::ptrdiff_t i0 = chunk_begin(n, p, c);
+      const std::ptrdiff_t i1 = chunk_begin(n, p, c + 1);
+      if (in_buffer) {
+        radix_count<Ordering>(kbuf, i0, i1, shift, counts, p, c);
+      } else {
+        radix_count<Ordering>(keys, i0, i1, shift, counts, p, c);
+      }
+    });
+
+    const int d0 = static_cast<int>(
+        (Ordering::bits(in_buffer ? kbuf[0] : Key(keys[0])) >> shift)
+        & (radix_size - 1));
+    std::ptrdiff_t same = 0;
+    for (int c = 0; c < p; ++c) {
+      same += counts[d0 * p + c];
+    }
+    if (same == n) {
+      continue;
+    }
+
+    exec.exclusive_scan(counts, counts + radix_size * p);
+
+    exec.for_each_task(p, [=](int c) {
+      const std::ptrdiff_t i0 = chunk_begin(n, p, c);
+      const std::ptrdiff_t i1 = chunk_begin(n, p, c + 1);
+      if (in_buffer) {
+        radix_scatter<Ordering>(
+            kbuf, vbuf, keys, vals, i0, i1, shift, counts, p, c);
+      } else {
+        radix_scatter<Ordering>(
+            keys, vals, kbuf, vbuf, i0, i1, shift, counts, p, c);
+      }
+    });
+    in_buffer = !in_buffer;
+  }
+
+  if (in_buffer) {
+    exec.for_each_task(p, [=](int c) {
+      const std::ptrdiff_t i0 = chunk_begin(n, p, c);
+      const std::ptrdiff_t i1 = chunk_begin(n, p, c + 1);
+      for (std::ptrdiff_t i = i0; i < i1; ++i) {
+        keys[i] = std::move(kbuf[i]);
+        radix_move(vbuf, vals, i, i);
+      }
+    });
+  }
+}
+
+/*!
+        \brief orders (key, value) pairs by key only
+*/
+template <typename Compare>
+struct pair_key_compare {
+  Compare comp;
+  template <typename Pair>
+  RAJA_INLINE bool operator()(Pair const& a, Pair const& b) const
+  {
+    return comp(a.first, b.first);
+  }
+};
+
+/*!
+        \brief sort n keys, choosing the radix sort when Key and Compare
+   allow it and the range is large enough
+*/
+template <bool Stable, typename Exec, typename Iter, typename Compare>
+RAJA_INLINE void parallel_sort(Exec const& exec,
+                               Iter begin,
+                               std::ptrdiff_t n,
+                               Compare comp,
+                               std::true_type)
+{
+  using Key = typename std::iterator_traits<Iter>::value_type;
+  if (n >= radix_min_size) {
+    radix_sort<radix_ordering<Key, Compare>>(exec, begin, n, no_values{});
+  } else {
+    merge_sort<Stable>(exec, begin, n, comp);
+  }
+}
+
+template <bool Stable, typename Exec, typename Iter, typename Compare>
+RAJA_INLINE void parallel_sort(Exec const& exec,
+                               Iter begin,
+                               std::ptrdiff_t n,
+                               Compare comp,
+                               std::false_type)
+{
+  merge_sort<Stable>(exec, begin, n, comp);
+}
+
+template <bool Stable, typename Exec, typename Iter, typename Compare>
+RAJA_INLINE void parallel_sort(Exec const& exec,
+                               Iter begin,
+                               Iter end,
+                               Compare comp)
+{
+  using Key = typename std::iterator_traits<Iter>::value_type;
+  const std::ptrdiff_t n = end - begin;
+  if (n <= 1) return;
+  parallel_sort<Stable>(
+      exec,
+      begin,
+      n,
+      comp,
+      std::integral_constant<bool, radix_ordering<Key, Compare>::value>{});
+}
+
+/*!
+        \brief sort n keys and their values by zipping them into pairs
+*/
+template <bool Stable,
+          typename Exec,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+void merge_sort_pairs(Exec const& exec,
+                      KeyIter keys,
+                      std::ptrdiff_t n,
+                      ValIter vals,
+                      Compare comp)
+{
+  using Key = typename std::iterator_traits<KeyIter>::value_type;
+  using Val = typename std::iterator_traits<ValIter>::value_type;
+  using Pair = std::pair<Key, Val>;
+
+  const int p = num_chunks(exec.max_tasks(), n);
+  std::vector<Pair> zipped(n);
+  Pair* z = zipped.data();
+
+  exec.for_each_task(p, [=](int c) {
+    for (std::ptrdiff_t i = chunk_begin(n, p, c); i < chunk_begin(n, p, c + 1);
+         ++i) {
+      z[i].first = std::move(keys[i]);
+      z[i].second = std::move(vals[i]);
+    }
+  });
+
+  merge_sort<Stable>(exec, z, n, pair_key_compare<Compare>{comp});
+
+  exec.for_each_task(p, [=](int c) {
+    for (std::ptrdiff_t i = chunk_begin(n, p, c); i < chunk_begin(n, p, c + 1);
+         ++i) {
+      keys[i] = std::move(z[i].first);
+      vals[i] = std::move(z[i].second);
+    }
+  });
+}
+
+template <bool Stable,
+          typename Exec,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+RAJA_INLINE void parallel_sort_pairs(Exec const& exec,
+                                     KeyIter keys,
+                                     std::ptrdiff_t n,
+                                     ValIter vals,
+                                     Compare comp,
+                                     std::true_type)
+{
+  using Key = typename std::iterator_traits<KeyIter>::value_type;
+  if (n >= radix_min_size) {
+    radix_sort<radix_ordering<Key, Compare>>(exec, keys, n, vals);
+  } else {
+    merge_sort_pairs<Stable>(exec, keys, n, vals, comp);
+  }
+}
+
+template <bool Stable,
+          typename Exec,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+RAJA_INLINE void parallel_sort_pairs(Exec const& exec,
+                                     KeyIter keys,
+                                     std::ptrdiff_t n,
+                                     ValIter vals,
+                                     Compare comp,
+                                     std::false_type)
+{
+  merge_sort_pairs<Stable>(exec, keys, n, vals, comp);
+}
+
+template <bool Stable,
+          typename Exec,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+RAJA_INLINE void parallel_sort_pairs(Exec const& exec,
+                                     KeyIter keys_begin,
+                                     KeyIter keys_end,
+                                     ValIter vals,
+                                     Compare comp)
+{
+  using Key = typename std::iterator_traits<KeyIter>::value_type;
+  const std::ptrdiff_t n = keys_end - keys_begin;
+  if (n <= 1) return;
+  parallel_sort_pairs<Stable>(
+      exec,
+      keys_begin,
+      n,
+      vals,
+      comp,
+      std::integral_constant<bool, radix_ordering<Key, Compare>::value>{});
+}
+
+/*!
+        \brief serial sort of keys and values through a zipped copy
+*/
+template <bool Stable, typename KeyIter, typename ValIter, typename Compare>
+void serial_sort_pairs(KeyIter keys_begin,
+                       KeyIter keys_end,
+                       ValIter vals,
+                       Compare comp)
+{
+  using Key = typename std::iterator_traits<KeyIter>::value_type;
+  using Val = typename std::iterator_traits<ValIter>::value_type;
+  using Pair = std::pair<Key, Val>;
+
+  const std::ptrdiff_t n = keys_end - keys_begin;
+  if (n <= 1) return;
+
+  std::vector<Pair> zipped;
+  zipped.reserve(n);
+  for (std::ptrdiff_t i = 0; i < n; ++i) {
+    zipped.emplace_back(std::move(keys_begin[i]), std::move(vals[i]));
+  }
+  serial_sort<Stable>(zipped.begin(),
+                      zipped.end(),
+                      pair_key_compare<Compare>{comp});
+  for (std::ptrdiff_t i = 0; i < n; ++i) {
+    keys_begin[i] = std::move(zipped[i].first);
+    vals[i] = std::move(zipped[i].second);
+  }
+}
+
+}  // namespace detail
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif /* RAJA_PATTERN_DETAIL_SORT_HPP */
@@ -76,8 +76,13 @@
 
 #include "RAJA/pattern/detail/forall.hpp"
 #include "RAJA/pattern/detail/privatizer.hpp"
+#include "RAJA/pattern/reduce_params.hpp"
 
 #include "RAJA/util/chai_support.hpp"
+#include "RAJA/util/launch_hooks.hpp"
+
+#include "camp/camp.hpp"
+#include "camp/tuple.hpp"
 
 
 namespace RAJA
@@ -128,6 +133,28 @@ struct icount_adapter {
   }
 };
 
+/// Loop body that runs several loop bodies, in order, for each index
+template <typename... Bodies>
+struct fused_body {
+  camp::tuple<Bodies...> bodies;
+
+  RAJA_SUPPRESS_HD_WARN
+  template <typename... Args>
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(Args&&... args) const
+  {
+    call(camp::make_idx_seq_t<sizeof...(Bodies)>{}, args...);
+  }
+
+  RAJA_SUPPRESS_HD_WARN
+  template <camp::idx_t... Is, typename... Args>
+  RAJA_HOST_DEVICE RAJA_INLINE void call(camp::idx_seq<Is...>,
+                                         Args&... args) const
+  {
+    using expand = int[];
+    (void)expand{0, (camp::get<Is>(bodies)(args...), 0)...};
+  }
+};
+
 struct CallForall {
   template <typename T, typename ExecPol, typename Body>
   RAJA_INLINE void operator()(T const&, ExecPol, Body) const;
@@ -176,6 +203,31 @@ forall(ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
               body);
 }
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Generic dispatch over containers with reducers passed as parameters
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy,
+          typename Container,
+          typename... Reducers,
+          typename LoopBody>
+RAJA_INLINE void forall(ExecutionPolicy&& p,
+                        Container&& c,
+                        reduce_param_pack<Reducers...> const& params,
+                        LoopBody&& loop_body)
+{
+  using RAJA::internal::trigger_updates_before;
+  auto body = trigger_updates_before(loop_body);
+
+  forall_param_impl(std::forward<ExecutionPolicy>(p),
+                    std::forward<Container>(c),
+                    params,
+                    body);
+}
+
 /*!
  ******************************************************************************
  *
@@ -273,11 +325,14 @@ RAJA_INLINE void forall_Icount(ExecutionPolicy&& p,
                 "TypedIndexSet policy by mistake?");
 
   detail::setChaiExecutionSpace<ExecutionPolicy>();
+  util::detail::callPreLaunchHooks<ExecutionPolicy>(util::launch_kind::forall);
 
   wrap::forall_Icount(std::forward<ExecutionPolicy>(p),
                       std::forward<IdxSet>(c),
                       std::forward<LoopBody>(loop_body));
 
+  util::detail::callPostLaunchHooks<ExecutionPolicy>(
+      util::launch_kind::forall);
   detail::clearChaiExecutionSpace();
 }
 
@@ -299,11 +354,14 @@ forall(ExecutionPolicy&& p, IdxSet&& c, LoopBody&& loop_body)
                 "TypedIndexSet policy by mistake?");
 
   detail::setChaiExecutionSpace<ExecutionPolicy>();
+  util::detail::callPreLaunchHooks<ExecutionPolicy>(util::launch_kind::forall);
 
   wrap::forall(std::forward<ExecutionPolicy>(p),
                std::forward<IdxSet>(c),
                std::forward<LoopBody>(loop_body));
 
+  util::detail::callPostLaunchHooks<ExecutionPolicy>(
+      util::launch_kind::forall);
   detail::clearChaiExecutionSpace();
 }
 
@@ -329,12 +387,15 @@ forall_Icount(ExecutionPolicy&& p,
                 "Container does not model RandomAccessIterator");
 
   detail::setChaiExecutionSpace<ExecutionPolicy>();
+  util::detail::callPreLaunchHooks<ExecutionPolicy>(util::launch_kind::forall);
 
   wrap::forall_Icount(std::forward<ExecutionPolicy>(p),
                       std::forward<Container>(c),
                       icount,
                       std::forward<LoopBody>(loop_body));
 
+  util::detail::callPostLaunchHooks<ExecutionPolicy>(
+      util::launch_kind::forall);
   detail::clearChaiExecutionSpace();
 }
 
@@ -356,14 +417,84 @@ forall(ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
                 "Container does not model RandomAccessIterator");
 
   detail::setChaiExecutionSpace<ExecutionPolicy>();
+  util::detail::callPreLaunchHooks<ExecutionPolicy>(util::launch_kind::forall);
 
   wrap::forall(std::forward<ExecutionPolicy>(p),
                std::forward<Container>(c),
                std::forward<LoopBody>(loop_body));
 
+  util::detail::callPostLaunchHooks<ExecutionPolicy>(
+      util::launch_kind::forall);
   detail::clearChaiExecutionSpace();
 }
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Generic dispatch over containers with reducers passed as parameters
+ *
+ *         The loop body takes the index followed by one accumulator for each
+ *         reducer given to RAJA::reduce_params; see reduce_param_pack.
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy,
+          typename Container,
+          typename... Reducers,
+          typename LoopBody>
+RAJA_INLINE concepts::enable_if<
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    type_traits::is_range<Container>>
+forall(ExecutionPolicy&& p,
+       Container&& c,
+       reduce_param_pack<Reducers...> const& params,
+       LoopBody&& loop_body)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container does not model RandomAccessIterator");
+
+  detail::setChaiExecutionSpace<ExecutionPolicy>();
+  util::detail::callPreLaunchHooks<ExecutionPolicy>(util::launch_kind::forall);
+
+  wrap::forall(std::forward<ExecutionPolicy>(p),
+               std::forward<Container>(c),
+               params,
+               std::forward<LoopBody>(loop_body));
+
+  util::detail::callPostLaunchHooks<ExecutionPolicy>(
+      util::launch_kind::forall);
+  detail::clearChaiExecutionSpace();
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Generic dispatch of several loop bodies in one traversal
+ *
+ *         forall_fused(p, c, body0, body1, ...) visits each index of c once,
+ *         in a single loop under policy p, and runs body0, body1, ... for
+ *         it in that order, so a body sees what the bodies before it wrote
+ *         at the same index while it is still in cache. This gives the
+ *         same result as a forall per body when the bodies only
+ *         communicate through data at the same index: no body may read or
+ *         write a location that another body writes at a different index.
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy, typename Container, typename... LoopBodies>
+RAJA_INLINE void forall_fused(ExecutionPolicy&& p,
+                              Container&& c,
+                              LoopBodies&&... loop_bodies)
+{
+  static_assert(sizeof...(LoopBodies) > 0,
+                "forall_fused needs at least one loop body");
+  using body_type = detail::fused_body<camp::decay<LoopBodies>...>;
+  forall(std::forward<ExecutionPolicy>(p),
+         std::forward<Container>(c),
+         body_type{camp::tuple<camp::decay<LoopBodies>...>{
+             std::forward<LoopBodies>(loop_bodies)...}});
+}
+
 //
 //////////////////////////////////////////////////////////////////////
 //
@@ -392,11 +523,14 @@ forall(ExecutionPolicy&& p,
        LoopBody&& loop_body)
 {
   detail::setChaiExecutionSpace<ExecutionPolicy>();
+  util::detail::callPreLaunchHooks<ExecutionPolicy>(util::launch_kind::forall);
 
   wrap::forall(std::forward<ExecutionPolicy>(p),
                TypedListSegment<ArrayIdxType>(idx, len, Unowned),
                std::forward<LoopBody>(loop_body));
 
+  util::detail::callPostLaunchHooks<ExecutionPolicy>(
+      util::launch_kind::forall);
   detail::clearChaiExecutionSpace();
 }
 
@@ -473,6 +607,16 @@ RAJA_INLINE void forall_Icount(Args&&... args)
   detail::clearChaiExecutionSpace();
 }
 
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * forall_fused
+ */
+template <typename ExecutionPolicy, typename... Args>
+RAJA_INLINE void forall_fused(Args&&... args)
+{
+  forall_fused(ExecutionPolicy(), std::forward<Args>(args)...);
+}
+
 namespace detail
 {
 
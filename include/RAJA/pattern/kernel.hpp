@@ -33,6 +33,7 @@
 #include "RAJA/pattern/kernel/internal.hpp"
 
 #include "RAJA/util/chai_support.hpp"
+#include "RAJA/util/launch_hooks.hpp"
 
 namespace RAJA
 {
@@ -108,6 +109,7 @@ RAJA_INLINE void kernel_param(SegmentTuple &&segments,
 {
 
   detail::setChaiExecutionSpace<PolicyType>();
+  util::detail::callPreLaunchHooks<PolicyType>(util::launch_kind::kernel);
 
   // TODO: test that all policy members model the Executor policy concept
   // TODO: add a static_assert for functors which cannot be invoked with
@@ -141,6 +143,7 @@ RAJA_INLINE void kernel_param(SegmentTuple &&segments,
   internal::execute_statement_list<PolicyType>(loop_data);
 
 
+  util::detail::callPostLaunchHooks<PolicyType>(util::launch_kind::kernel);
   detail::clearChaiExecutionSpace();
 }
 
@@ -160,6 +163,7 @@ RAJA_INLINE void kernel(SegmentTuple &&segments, Bodies &&... bodies)
 #include "RAJA/pattern/kernel/Conditional.hpp"
 #include "RAJA/pattern/kernel/For.hpp"
 #include "RAJA/pattern/kernel/ForICount.hpp"
+#include "RAJA/pattern/kernel/Fuse.hpp"
 #include "RAJA/pattern/kernel/Hyperplane.hpp"
 #include "RAJA/pattern/kernel/InitLocalMem.hpp"
 #include "RAJA/pattern/kernel/Lambda.hpp"
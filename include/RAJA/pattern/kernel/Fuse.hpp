@@ -0,0 +1,159 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for loop fusion in kernel.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_Fuse_HPP
+#define RAJA_pattern_kernel_Fuse_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/pattern/kernel/For.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+namespace RAJA
+{
+
+namespace statement
+{
+
+/*!
+ * A RAJA::kernel statement that fuses loops.
+ *
+ * Fuse<EnclosedStmts...> runs like the statement list EnclosedStmts...,
+ * except that adjacent For statements over the same argument with the
+ * same execution policy become one For, which runs the statements of each
+ * in turn for every iterate. The statements of a fused loop are fused in
+ * the same way, so
+ *
+ *   Fuse<For<1, omp_parallel_for_exec, For<0, loop_exec, Lambda<0>>>,
+ *        For<1, omp_parallel_for_exec, For<0, loop_exec, Lambda<1>>>>
+ *
+ * runs as
+ *
+ *   For<1, omp_parallel_for_exec, For<0, loop_exec, Lambda<0>, Lambda<1>>>
+ *
+ * which is one parallel loop, and Lambda<1> reads what Lambda<0> wrote
+ * while it is still in cache. The result is the same as without Fuse when
+ * the lambdas only communicate through data at the same iterate: no
+ * lambda may read or write a location that another writes at a different
+ * iterate.
+ */
+template <typename... EnclosedStmts>
+struct Fuse : public internal::Statement<camp::nil, EnclosedStmts...> {
+};
+
+}  // end namespace statement
+
+namespace internal
+{
+
+template <typename StmtList>
+struct FuseStatements;
+
+/*!
+ * Fuse a statement list: Done holds the statements already fused, Last
+ * the loop being grown and Todo the statements that follow.
+ */
+template <typename Done, typename Last, typename Todo>
+struct FuseLoops;
+
+//! a For statement whose enclosed statements are fused
+template <typename Stmt>
+struct FuseEnclosed {
+  using type = Stmt;
+};
+
+template <camp::idx_t ArgumentId, typename ExecPolicy, typename StmtList>
+struct MakeFor;
+
+template <camp::idx_t ArgumentId, typename ExecPolicy, typename... Stmts>
+struct MakeFor<ArgumentId, ExecPolicy, camp::list<Stmts...>> {
+  using type = statement::For<ArgumentId, ExecPolicy, Stmts...>;
+};
+
+template <camp::idx_t ArgumentId, typename ExecPolicy, typename... Stmts>
+struct FuseEnclosed<statement::For<ArgumentId, ExecPolicy, Stmts...>> {
+  using type = typename MakeFor<
+      ArgumentId,
+      ExecPolicy,
+      typename FuseStatements<camp::list<Stmts...>>::type>::type;
+};
+
+// no statements left
+template <typename... Done, typename Last>
+struct FuseLoops<camp::list<Done...>, Last, camp::list<>> {
+  using type = camp::list<typename FuseEnclosed<Done>::type...,
+                          typename FuseEnclosed<Last>::type>;
+};
+
+// Next cannot be fused with Last
+template <typename... Done, typename Last, typename Next, typename... Todo>
+struct FuseLoops<camp::list<Done...>, Last, camp::list<Next, Todo...>>
+    : FuseLoops<camp::list<Done..., Last>, Next, camp::list<Todo...>> {
+};
+
+// two loops over the same argument with the same policy
+template <typename... Done,
+          camp::idx_t ArgumentId,
+          typename ExecPolicy,
+          typename... LastStmts,
+          typename... NextStmts,
+          typename... Todo>
+struct FuseLoops<
+    camp::list<Done...>,
+    statement::For<ArgumentId, ExecPolicy, LastStmts...>,
+    camp::list<statement::For<ArgumentId, ExecPolicy, NextStmts...>, Todo...>>
+    : FuseLoops<
+          camp::list<Done...>,
+          statement::For<ArgumentId, ExecPolicy, LastStmts..., NextStmts...>,
+          camp::list<Todo...>> {
+};
+
+template <>
+struct FuseStatements<camp::list<>> {
+  using type = camp::list<>;
+};
+
+template <typename Stmt, typename... Stmts>
+struct FuseStatements<camp::list<Stmt, Stmts...>>
+    : FuseLoops<camp::list<>, Stmt, camp::list<Stmts...>> {
+};
+
+/*!
+ * A RAJA::kernel statement executor for statement::Fuse: the fused
+ * statement list is worked out at compile time and run in its place.
+ */
+template <typename... EnclosedStmts>
+struct StatementExecutor<statement::Fuse<EnclosedStmts...>> {
+
+  using fused_statements =
+      typename FuseStatements<camp::list<EnclosedStmts...>>::type;
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    execute_statement_list<fused_statements>(std::forward<Data>(data));
+  }
+};
+
+}  // end namespace internal
+}  // end namespace RAJA
+
+#endif /* RAJA_pattern_kernel_Fuse_HPP */
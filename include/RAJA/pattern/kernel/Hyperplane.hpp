@@ -42,7 +42,7 @@ namespace statement
  * Given segments S0, S1, ...
  * and iterates i0, i1, ... that range from 0 to Ni, where Ni = length(Si),
  * hyperplanes are defined as h = i0 + i1 + i2 + ...
- * For h = 0 ... sum(Ni)
+ * For h = 0 ... sum(Ni - 1)
  *
  * The iteration is advanced for
  *
@@ -51,30 +51,33 @@ namespace statement
  * Where HpArg is the argument id for i0, and Args define the arguments ids for
  * i1, i2, ...
  *
- *
- *
+ * Only the points that lie in the box are visited: on hyperplane h each of
+ * i1, i2, ... runs over the exact range that leaves a valid value for the
+ * indices after it, so no iterations are generated and thrown away.
  *
  * The implemented loop pattern looks like:
  *
  *  RAJA::forall<HpExecPolicy>(RangeSegment(0, Nh), [=](RAJA::Index_type h){
  *
- *     RAJA::kernel::forall<Collapse<ExecPolicy, ArgList<1,2,...>, Lambda<0>>>(
- *        RAJA::make_tuple(S1, S2, ...),
- *        [=](RAJA::Index_type i1, RAJA::Index_type i2, ...){
+ *     // points of hyperplane h, split between threads along i1
+ *     RAJA::forall<ExecPolicy>(RangeSegment(i1_begin(h), i1_end(h)),
+ *       [=](RAJA::Index_type i1){
  *
- *          // Compute i0
- *          RAJA::Index_type i0 = h - sum(i1, i2, ...);
+ *         for (i2 = i2_begin(h, i1); i2 < i2_end(h, i1); ++i2) {
+ *           ...
+ *             // Compute i0, always in [0, N0)
+ *             RAJA::Index_type i0 = h - sum(i1, i2, ...);
  *
- *          // Check if h is in bounds
- *          if(h >= 0 && h < Nh){
+ *             loop_body(i0, i1, i2, ...);
+ *         }
  *
-              loop_body(i0, i1, i2, ...);
- *          }
- *
- *        });
+ *       });
  *
  *  });
  *
+ * ExecPolicy may be any forall policy, or one of the OpenMP or TBB collapse
+ * policies, which run the hyperplanes in order themselves (the OpenMP ones
+ * in a single parallel region) and ignore HpExecPolicy.
  */
 template <camp::idx_t HpArgumentId,
           typename HpExecPolicy,
@@ -91,12 +94,101 @@ struct Hyperplane
 namespace internal
 {
 
+/*!
+ * Exact range [begin, end) of one argument on a hyperplane.
+ *
+ * s is the part of h left after the arguments before this one, and rest
+ * the largest sum the arguments after it can take, the hyperplane
+ * argument included.
+ */
+RAJA_INLINE void hyperplane_range(Index_type s,
+                                  Index_type rest,
+                                  Index_type len,
+                                  Index_type &begin,
+                                  Index_type &end)
+{
+  begin = s > rest ? s - rest : 0;
+  end = (s < len - 1 ? s : len - 1) + 1;
+}
+
+//! largest sum of the arguments Args plus the hyperplane argument
+template <camp::idx_t HpArgumentId, camp::idx_t... Args, typename Data>
+RAJA_INLINE Index_type hyperplane_rest(Data const &data, ArgList<Args...>)
+{
+  const Index_type lens[] = {
+      static_cast<Index_type>(segment_length<HpArgumentId>(data)),
+      static_cast<Index_type>(segment_length<Args>(data))...};
+  Index_type rest = 0;
+  for (Index_type len : lens) {
+    rest += len - 1;
+  }
+  return rest;
+}
+
+//! h less the arguments Args that are already set
+template <camp::idx_t HpArgumentId, camp::idx_t... Args, typename Data>
+RAJA_INLINE Index_type hyperplane_remainder(Data const &data,
+                                            ArgList<Args...>)
+{
+  const Index_type taken[] = {
+      0, static_cast<Index_type>(camp::get<Args>(data.offset_tuple))...};
+  Index_type s = camp::get<HpArgumentId>(data.offset_tuple);
+  for (Index_type t : taken) {
+    s -= t;
+  }
+  return s;
+}
 
-template <camp::idx_t HpArgumentId, typename ArgList, typename... EnclosedStmts>
+/*!
+ * Runs the points of the hyperplane h, held in argument HpArgumentId, that
+ * have the arguments in Done already set, enumerating those in Todo in
+ * order.
+ */
+template <camp::idx_t HpArgumentId,
+          typename Done,
+          typename Todo,
+          typename... EnclosedStmts>
 struct HyperplaneInner
     : public internal::Statement<camp::nil, EnclosedStmts...> {
 };
 
+/*!
+ * Runs the points of the hyperplane h, held in argument HpArgumentId,
+ * split between threads along the first of Args by ExecPolicy.
+ */
+template <camp::idx_t HpArgumentId,
+          typename ExecPolicy,
+          typename Args,
+          typename... EnclosedStmts>
+struct HyperplanePlane
+    : public internal::Statement<ExecPolicy, EnclosedStmts...> {
+};
+
+//! the statement running the points with Arg set, and Rest left to do
+template <camp::idx_t HpArgumentId,
+          camp::idx_t Arg,
+          typename Rest,
+          typename... EnclosedStmts>
+using HyperplaneRows =
+    HyperplaneInner<HpArgumentId, ArgList<Arg>, Rest, EnclosedStmts...>;
+
+/*!
+ * Number of hyperplanes of the box, or 0 if any of its arguments is empty.
+ */
+template <camp::idx_t HpArgumentId, camp::idx_t... Args, typename Data>
+RAJA_INLINE Index_type hyperplane_count(Data const &data, ArgList<Args...>)
+{
+  const Index_type lens[] = {
+      static_cast<Index_type>(segment_length<HpArgumentId>(data)),
+      static_cast<Index_type>(segment_length<Args>(data))...};
+  Index_type count = 1;
+  for (Index_type len : lens) {
+    if (len <= 0) return 0;
+    count += len - 1;
+  }
+  return count;
+}
+
 
 template <camp::idx_t HpArgumentId,
           typename HpExecPolicy,
@@ -109,6 +201,8 @@ struct StatementExecutor<statement::Hyperplane<HpArgumentId,
                                                ExecPolicy,
                                                EnclosedStmts...>> {
 
+  static_assert(sizeof...(Args) > 0,
+                "Hyperplane needs at least one argument besides HpArgumentId");
 
   template <typename Data>
   static RAJA_INLINE void exec(Data &data)
@@ -119,70 +213,124 @@ struct StatementExecutor<statement::Hyperplane<HpArgumentId,
     using idx_t =
         camp::tuple_element_t<HpArgumentId, typename data_t::offset_tuple_t>;
 
-    // Add a Collapse policy around our enclosed statements that will handle
-    // the inner hyperplane loop's execution
-    using kernel_policy = statement::Collapse<
-        ExecPolicy,
-        ArgList<Args...>,
-        HyperplaneInner<HpArgumentId, ArgList<Args...>, EnclosedStmts...>>;
+    // The plane statement enumerates the points of the hyperplane h that
+    // the outer loop stores in argument HpArgumentId
+    using plane_stmt = HyperplanePlane<HpArgumentId,
+                                       ExecPolicy,
+                                       ArgList<Args...>,
+                                       EnclosedStmts...>;
 
     // Create a For-loop wrapper for the outer loop
-    ForWrapper<HpArgumentId, Data, kernel_policy> outer_wrapper(data);
-
-    // compute manhattan distance of iteration space to determine
-    // as:  hp_len = l0 + l1 + l2 + ...
-    idx_t hp_len = segment_length<HpArgumentId>(data) +
-                   VarOps::foldl(RAJA::operators::plus<idx_t>(),
-                                 segment_length<Args>(data)...);
-
-    /* Execute the outer loop over hyperplanes
-     *
-     * This will store h in the index_tuple as argument HpArgumentId, so that
-     * later, the HyperplaneInner executor can pull it out, and calculate that
-     * arguments actual value (and restrict to valid hyperplane indices)
-     */
+    ForWrapper<HpArgumentId, Data, plane_stmt> outer_wrapper(data);
+
+    // hyperplanes run from h = 0 to the sum of (l - 1) over the arguments
+    const Index_type hp_len =
+        hyperplane_count<HpArgumentId>(data, ArgList<Args...>{});
+
+    // Execute the outer loop over hyperplanes
     forall_impl(HpExecPolicy{},
-                TypedRangeSegment<idx_t>(0, hp_len),
+                TypedRangeSegment<idx_t>(0, static_cast<idx_t>(hp_len)),
                 outer_wrapper);
   }
 };
 
 
 template <camp::idx_t HpArgumentId,
-          camp::idx_t... Args,
+          typename ExecPolicy,
+          camp::idx_t Arg,
+          camp::idx_t... Rest,
           typename... EnclosedStmts>
-struct StatementExecutor<
-    HyperplaneInner<HpArgumentId, ArgList<Args...>, EnclosedStmts...>> {
+struct StatementExecutor<HyperplanePlane<HpArgumentId,
+                                         ExecPolicy,
+                                         ArgList<Arg, Rest...>,
+                                         EnclosedStmts...>> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
+    using data_t = camp::decay<Data>;
+    using idx_t = camp::tuple_element_t<Arg, typename data_t::offset_tuple_t>;
+    using rows_stmt = HyperplaneRows<HpArgumentId,
+                                     Arg,
+                                     ArgList<Rest...>,
+                                     EnclosedStmts...>;
+
+    Index_type begin, end;
+    hyperplane_range(camp::get<HpArgumentId>(data.offset_tuple),
+                     hyperplane_rest<HpArgumentId>(data, ArgList<Rest...>{}),
+                     segment_length<Arg>(data),
+                     begin,
+                     end);
+
+    ForWrapper<Arg, Data, rows_stmt> rows_wrapper(data);
+    forall_impl(ExecPolicy{},
+                TypedRangeSegment<idx_t>(static_cast<idx_t>(begin),
+                                         static_cast<idx_t>(end)),
+                rows_wrapper);
+  }
+};
 
 
+template <camp::idx_t HpArgumentId,
+          camp::idx_t... Done,
+          camp::idx_t Arg,
+          camp::idx_t... Rest,
+          typename... EnclosedStmts>
+struct StatementExecutor<HyperplaneInner<HpArgumentId,
+                                         ArgList<Done...>,
+                                         ArgList<Arg, Rest...>,
+                                         EnclosedStmts...>> {
+
   template <typename Data>
   static RAJA_INLINE void exec(Data &data)
   {
+    using next_stmt = HyperplaneInner<HpArgumentId,
+                                      ArgList<Done..., Arg>,
+                                      ArgList<Rest...>,
+                                      EnclosedStmts...>;
+
+    Index_type begin, end;
+    hyperplane_range(
+        hyperplane_remainder<HpArgumentId>(data, ArgList<Done...>{}),
+        hyperplane_rest<HpArgumentId>(data, ArgList<Rest...>{}),
+        segment_length<Arg>(data),
+        begin,
+        end);
+
+    for (Index_type i = begin; i < end; ++i) {
+      data.template assign_offset<Arg>(i);
+      execute_statement_list<StatementList<next_stmt>>(data);
+    }
+  }
+};
 
-    // get h value
-    auto h = camp::get<HpArgumentId>(data.offset_tuple);
-    using idx_t = decltype(h);
 
-    // compute actual iterate for HpArgumentId
-    // as:  i0 = h - (i1 + i2 + i3 + ...)
-    idx_t i = h - VarOps::foldl(RAJA::operators::plus<idx_t>(),
-                                camp::get<Args>(data.offset_tuple)...);
+template <camp::idx_t HpArgumentId,
+          camp::idx_t... Done,
+          typename... EnclosedStmts>
+struct StatementExecutor<HyperplaneInner<HpArgumentId,
+                                         ArgList<Done...>,
+                                         ArgList<>,
+                                         EnclosedStmts...>> {
 
-    // get length of Hp indexed argument
-    auto len = segment_length<HpArgumentId>(data);
 
-    // check bounds
-    if (i >= 0 && i < len) {
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
 
-      // store in tuple
-      data.template assign_offset<HpArgumentId>(i);
+    // get h value
+    auto h = camp::get<HpArgumentId>(data.offset_tuple);
 
-      // execute enclosed statements
-      execute_statement_list<StatementList<EnclosedStmts...>>(data);
+    // compute actual iterate for HpArgumentId
+    // as:  i0 = h - (i1 + i2 + i3 + ...), in range by construction
+    data.template assign_offset<HpArgumentId>(
+        hyperplane_remainder<HpArgumentId>(data, ArgList<Done...>{}));
 
-      // reset h for next iteration
-      data.template assign_offset<HpArgumentId>(h);
-    }
+    // execute enclosed statements
+    execute_statement_list<StatementList<EnclosedStmts...>>(data);
+
+    // reset h for next iteration
+    data.template assign_offset<HpArgumentId>(h);
   }
 };
 
@@ -23,6 +23,8 @@
 #include <iostream>
 #include <type_traits>
 
+#include "RAJA/util/TileScratch.hpp"
+
 namespace RAJA
 {
 
@@ -59,12 +61,15 @@ namespace internal
 {
 
 //Statement executor to initalize RAJA local array
+//Arrays are taken from the thread's TileScratch arena, so they are cache
+//line aligned, may be larger than the stack, and reuse the same memory
+//each time the statement runs
 template<camp::idx_t... Indices, typename... EnclosedStmts>
 struct StatementExecutor<statement::InitLocalMem<RAJA::cpu_tile_mem,camp::idx_seq<Indices...>, EnclosedStmts...> >{
   
   //Execute statement list
   template<class Data>
-  static void RAJA_INLINE initMem(Data && data)
+  static void RAJA_INLINE initMem(Data && data, TileScratch &)
   {
     execute_statement_list<camp::list<EnclosedStmts...>>(data);
   }
@@ -72,14 +77,15 @@ struct StatementExecutor<statement::InitLocalMem<RAJA::cpu_tile_mem,camp::idx_se
   //Intialize local array
   //Identifies type + number of elements needed
   template<camp::idx_t Pos, camp::idx_t... others, class Data>
-  static void RAJA_INLINE initMem(Data && data)
+  static void RAJA_INLINE initMem(Data && data, TileScratch &scratch)
   {
     using varType = typename camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::element_t;
     const camp::idx_t NumElem = camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::NumElem;
     
-    varType Array[NumElem];
+    varType *Array = scratch.template construct<varType>(NumElem);
     camp::get<Pos>(data.param_tuple).m_arrayPtr = Array;
-    initMem<others...>(data);
+    initMem<others...>(data, scratch);
+    TileScratch::destroy(Array, NumElem);
   }
   
   //Set pointer to null
@@ -97,7 +103,9 @@ struct StatementExecutor<statement::InitLocalMem<RAJA::cpu_tile_mem,camp::idx_se
   static RAJA_INLINE void exec(Data &&data)
   {
     //Initalize local arrays + execute statements
-    initMem<Indices...>(data);
+    //The arrays are given back to the arena when scope ends
+    TileScratchScope scope;
+    initMem<Indices...>(data, scope.scratch());
     
     //set array pointers to null
     setPtrToNull<Indices...>(data);
@@ -37,6 +37,12 @@ namespace statement
  * This reduces a value down to a "root" thread, and then only executes
  * the enclosed statements on the thread which contains the reduced value.
  *
+ * On the CPU, where parallel loops run their iterations on thread-private
+ * copies of the loop data, the statement instead encloses those loops:
+ * each private copy starts the Param at the operator's identity, and when
+ * the enclosed statements are done the copies' values are combined with
+ * the operator into the Param seen by the statements that follow.
+ *
  */
 template <typename ReducePolicy,
           template <typename...> class ReduceOperator,
@@ -54,6 +60,96 @@ struct Reduce : public internal::Statement<camp::nil, EnclosedStmts...> {
 
 }  // end namespace statement
 
+namespace internal
+{
+
+template <typename Data>
+RAJA_INLINE void reduce_loop_data_view(Data &)
+{
+}
+
+/*!
+ * Loop data inside a CPU statement::Reduce on parameter ParamId.
+ *
+ * Copies made by the privatizers of parallel loops start the parameter at
+ * the identity of ReduceOperator and hand their value to the Partials of
+ * the Reduce when they are destroyed; Partials::merge is only ever called
+ * by the thread that owns the copy.
+ */
+template <typename Data,
+          typename Partials,
+          template <typename...> class ReduceOperator,
+          camp::idx_t ParamId>
+struct ReduceLoopData : public Data {
+  using value_t =
+      camp::at_v<typename Data::param_tuple_t::TList, ParamId>;
+  using op_t = ReduceOperator<value_t>;
+
+  Partials *partials;
+  bool is_copy;
+
+  RAJA_INLINE ReduceLoopData(Data const &data, Partials &p)
+      : Data(data), partials(&p), is_copy(false)
+  {
+    // inside another Reduce, Data's copy constructor has made this a
+    // private copy of that one; it is a view of the same data instead
+    reduce_loop_data_view(static_cast<Data &>(*this));
+    this->param_tuple = data.param_tuple;
+  }
+
+  RAJA_INLINE ReduceLoopData(ReduceLoopData const &o)
+      : Data(static_cast<Data const &>(o)), partials(o.partials), is_copy(true)
+  {
+    camp::get<ParamId>(this->param_tuple) = op_t::identity();
+  }
+
+  ReduceLoopData &operator=(ReduceLoopData const &) = delete;
+
+  RAJA_INLINE ~ReduceLoopData()
+  {
+    if (is_copy) partials->merge(camp::get<ParamId>(this->param_tuple));
+  }
+};
+
+//! make d, and the loop data it extends, no longer merge when destroyed
+template <typename Data,
+          typename Partials,
+          template <typename...> class ReduceOperator,
+          camp::idx_t ParamId>
+RAJA_INLINE void reduce_loop_data_view(
+    ReduceLoopData<Data, Partials, ReduceOperator, ParamId> &d)
+{
+  d.is_copy = false;
+  reduce_loop_data_view(static_cast<Data &>(d));
+}
+
+/*!
+ * Runs EnclosedStmts on a ReduceLoopData view of data, then combines the
+ * values of the private copies into parameter ParamId of data.
+ */
+template <typename Partials,
+          template <typename...> class ReduceOperator,
+          camp::idx_t ParamId,
+          typename... EnclosedStmts,
+          typename Data>
+RAJA_INLINE void execute_cpu_reduce(Data &data)
+{
+  using reduce_data_t =
+      ReduceLoopData<Data, Partials, ReduceOperator, ParamId>;
+  using op_t = typename reduce_data_t::op_t;
+
+  Partials partials;
+  {
+    reduce_data_t reduce_data(data, partials);
+    execute_statement_list<StatementList<EnclosedStmts...>>(reduce_data);
+    // keeps what the enclosed statements did to the other parameters too
+    data.param_tuple = reduce_data.param_tuple;
+  }
+  camp::get<ParamId>(data.param_tuple) =
+      op_t{}(camp::get<ParamId>(data.param_tuple), partials.combine());
+}
+
+}  // end namespace internal
 
 }  // end namespace RAJA
 
@@ -56,11 +56,49 @@ struct tile_fixed {
   static constexpr camp::idx_t chunk_size = chunk_size_;
 };
 
+/*!
+ * Tag for a tiling loop whose tile size is read at run time from kernel
+ * parameter ParamId, so that it can be chosen per machine or problem, for
+ * example with RAJA::TileTuner.
+ */
+template <camp::idx_t ParamId>
+struct tile_dynamic {
+  static constexpr camp::idx_t param_id = ParamId;
+};
+
 }  // end namespace statement
 
 namespace internal
 {
 
+/*!
+ * Tile size of a tiling policy: its chunk_size, or for tile_dynamic the
+ * value of its kernel parameter.
+ */
+template <typename TPol>
+struct TileSize {
+  template <typename Data>
+  static constexpr camp::idx_t get(Data const &)
+  {
+    return TPol::chunk_size;
+  }
+};
+
+template <camp::idx_t ParamId>
+struct TileSize<statement::tile_dynamic<ParamId>> {
+  template <typename Data>
+  static RAJA_INLINE camp::idx_t get(Data const &data)
+  {
+    const camp::idx_t chunk_size =
+        static_cast<camp::idx_t>(camp::get<ParamId>(data.param_tuple));
+    if (chunk_size <= 0) {
+      RAJA_ABORT_OR_THROW("RAJA::statement::tile_dynamic: tile size must be "
+                          "positive");
+    }
+    return chunk_size;
+  }
+};
+
 /*!
  * A generic RAJA::kernel forall_impl tile wrapper for statement::For
  * Assigns the tile segment to segment ArgumentId
@@ -213,7 +251,7 @@ struct StatementExecutor<
     auto const &segment = camp::get<ArgumentId>(data.segment_tuple);
 
     // Get the tiling policies chunk size
-    auto chunk_size = TPol::chunk_size;
+    auto chunk_size = TileSize<TPol>::get(data);
 
     // Create a tile iterator, needs to survive until the forall is
     // done executing.
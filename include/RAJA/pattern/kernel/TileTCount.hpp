@@ -111,7 +111,7 @@ struct StatementExecutor<
     auto const &segment = camp::get<ArgumentId>(data.segment_tuple);
 
     // Get the tiling policies chunk size
-    auto chunk_size = TPol::chunk_size;
+    auto chunk_size = TileSize<TPol>::get(data);
 
     // Create a tile iterator, needs to survive until the forall is
     // done executing.
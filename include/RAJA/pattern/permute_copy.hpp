@@ -0,0 +1,312 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA::permute_copy, a copy between Views
+ *          whose layouts order the dimensions differently.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_permute_copy_HPP
+#define RAJA_pattern_permute_copy_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+#include "RAJA/util/View.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! side of the square tiles a transposing copy is split into
+constexpr Index_type permute_tile = 32;
+
+//! elements of a copy without transposition handled by one work item
+constexpr Index_type permute_chunk = 4096;
+
+/*!
+ * Transpose a 4x4 block: row k of the source (4 contiguous values, stride
+ * s_row between rows) becomes column k of the destination (rows contiguous,
+ * stride d_row).
+ */
+template <typename T, typename U>
+struct transpose4 {
+  static RAJA_INLINE void apply(const T* RAJA_RESTRICT s,
+                                Index_type s_row,
+                                U* RAJA_RESTRICT d,
+                                Index_type d_row)
+  {
+    for (Index_type j = 0; j < 4; ++j) {
+      for (Index_type k = 0; k < 4; ++k) {
+        d[j * d_row + k] = static_cast<U>(s[k * s_row + j]);
+      }
+    }
+  }
+};
+
+#if defined(__AVX2__)
+
+//! the 4x4 double transpose done in registers
+template <>
+struct transpose4<double, double> {
+  static RAJA_INLINE void apply(const double* RAJA_RESTRICT s,
+                                Index_type s_row,
+                                double* RAJA_RESTRICT d,
+                                Index_type d_row)
+  {
+    const __m256d r0 = _mm256_loadu_pd(s);
+    const __m256d r1 = _mm256_loadu_pd(s + s_row);
+    const __m256d r2 = _mm256_loadu_pd(s + 2 * s_row);
+    const __m256d r3 = _mm256_loadu_pd(s + 3 * s_row);
+    const __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+    const __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+    const __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+    const __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+    _mm256_storeu_pd(d, _mm256_permute2f128_pd(t0, t2, 0x20));
+    _mm256_storeu_pd(d + d_row, _mm256_permute2f128_pd(t1, t3, 0x20));
+    _mm256_storeu_pd(d + 2 * d_row, _mm256_permute2f128_pd(t0, t2, 0x31));
+    _mm256_storeu_pd(d + 3 * d_row, _mm256_permute2f128_pd(t1, t3, 0x31));
+  }
+};
+
+#endif
+
+/*!
+ * How a permute_copy is split into independent work items.
+ *
+ * Dimension a is the source's fastest-moving one and b the destination's.
+ * When they differ, the (a, b) plane is cut into square tiles that are
+ * transposed in cache, so both arrays are walked along their contiguous
+ * dimension; when they are the same, each item copies a chunk of a.
+ * The remaining dimensions are walked in the destination's order.
+ */
+template <size_t Rank>
+struct permute_plan {
+  Index_type na = 1, nb = 1;
+  Index_type sa = 0, sb = 0, da = 0, db = 0;
+  Index_type ta = 1, tb = 1;
+  int nouter = 0;
+  Index_type outer_sizes[Rank];
+  Index_type outer_src[Rank];
+  Index_type outer_dst[Rank];
+
+  Index_type work_items() const
+  {
+    Index_type n = ta * tb;
+    for (int d = 0; d < nouter; ++d) {
+      n *= outer_sizes[d];
+    }
+    return n;
+  }
+
+  template <typename T, typename U>
+  RAJA_INLINE void operator()(Index_type w, const T* src, U* dst) const
+  {
+    const Index_type tile_b = w % tb;
+    w /= tb;
+    const Index_type tile_a = w % ta;
+    w /= ta;
+    for (int d = nouter - 1; d >= 0; --d) {
+      const Index_type i = w % outer_sizes[d];
+      w /= outer_sizes[d];
+      src += i * outer_src[d];
+      dst += i * outer_dst[d];
+    }
+
+    if (nb == 1) {
+      const Index_type a0 = tile_a * permute_chunk;
+      const Index_type a1 = std::min(a0 + permute_chunk, na);
+      copy_run(src + a0 * sa, dst + a0 * da, a1 - a0);
+    } else {
+      const Index_type a0 = tile_a * permute_tile;
+      const Index_type b0 = tile_b * permute_tile;
+      copy_tile(src + a0 * sa + b0 * sb,
+                dst + a0 * da + b0 * db,
+                std::min(permute_tile, na - a0),
+                std::min(permute_tile, nb - b0));
+    }
+  }
+
+private:
+  template <typename T, typename U>
+  RAJA_INLINE void copy_run(const T* RAJA_RESTRICT s,
+                            U* RAJA_RESTRICT d,
+                            Index_type n) const
+  {
+    if (sa == 1 && da == 1) {
+      for (Index_type i = 0; i < n; ++i) {
+        d[i] = static_cast<U>(s[i]);
+      }
+    } else {
+      for (Index_type i = 0; i < n; ++i) {
+        d[i * da] = static_cast<U>(s[i * sa]);
+      }
+    }
+  }
+
+  template <typename T, typename U>
+  RAJA_INLINE void copy_tile(const T* RAJA_RESTRICT s,
+                             U* RAJA_RESTRICT d,
+                             Index_type n_a,
+                             Index_type n_b) const
+  {
+    Index_type b = 0;
+    if (sa == 1 && db == 1) {
+      for (; b + 4 <= n_b; b += 4) {
+        Index_type a = 0;
+        for (; a + 4 <= n_a; a += 4) {
+          transpose4<T, U>::apply(s + a + b * sb, sb, d + a * da + b, da);
+        }
+        for (; a < n_a; ++a) {
+          for (Index_type k = b; k < b + 4; ++k) {
+            d[a * da + k] = static_cast<U>(s[a + k * sb]);
+          }
+        }
+      }
+    }
+    for (; b < n_b; ++b) {
+      for (Index_type a = 0; a < n_a; ++a) {
+        d[a * da + b * db] = static_cast<U>(s[a * sa + b * sb]);
+      }
+    }
+  }
+};
+
+//! the dimension with the smallest stride among those longer than 1
+template <size_t Rank>
+RAJA_INLINE int fastest_dim(Index_type const (&extents)[Rank],
+                            Index_type const (&strides)[Rank])
+{
+  int fastest = -1;
+  for (int d = 0; d < static_cast<int>(Rank); ++d) {
+    if (extents[d] > 1
+        && (fastest < 0 || strides[d] < strides[fastest])) {
+      fastest = d;
+    }
+  }
+  return fastest;
+}
+
+template <size_t Rank, typename SrcLayout, typename DstLayout>
+RAJA_INLINE permute_plan<Rank> make_permute_plan(SrcLayout const& src,
+                                                 DstLayout const& dst)
+{
+  // a zero-sized dimension is projected out and holds a single element
+  Index_type extents[Rank], s_strides[Rank], d_strides[Rank];
+  for (size_t d = 0; d < Rank; ++d) {
+    const Index_type n = src.sizes[d] ? src.sizes[d] : 1;
+    if (n != (dst.sizes[d] ? dst.sizes[d] : 1)) {
+      RAJA_ABORT_OR_THROW("RAJA::permute_copy: views have different sizes");
+    }
+    extents[d] = n;
+    s_strides[d] = src.strides[d];
+    d_strides[d] = dst.strides[d];
+  }
+
+  permute_plan<Rank> plan;
+  const int a = fastest_dim(extents, s_strides);
+  const int b = fastest_dim(extents, d_strides);
+  if (a < 0) return plan;
+
+  plan.na = extents[a];
+  plan.sa = s_strides[a];
+  plan.da = d_strides[a];
+  if (b == a) {
+    plan.ta = (plan.na + permute_chunk - 1) / permute_chunk;
+  } else {
+    plan.nb = extents[b];
+    plan.sb = s_strides[b];
+    plan.db = d_strides[b];
+    plan.ta = (plan.na + permute_tile - 1) / permute_tile;
+    plan.tb = (plan.nb + permute_tile - 1) / permute_tile;
+  }
+
+  // the other dimensions, by decreasing destination stride
+  for (int d = 0; d < static_cast<int>(Rank); ++d) {
+    if (d == a || d == b || extents[d] == 1) continue;
+    int pos = plan.nouter++;
+    for (; pos > 0 && plan.outer_dst[pos - 1] < d_strides[d]; --pos) {
+      plan.outer_sizes[pos] = plan.outer_sizes[pos - 1];
+      plan.outer_src[pos] = plan.outer_src[pos - 1];
+      plan.outer_dst[pos] = plan.outer_dst[pos - 1];
+    }
+    plan.outer_sizes[pos] = extents[d];
+    plan.outer_src[pos] = s_strides[d];
+    plan.outer_dst[pos] = d_strides[d];
+  }
+  return plan;
+}
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Copy src into dst element by element, dst(i, j, ...) =
+ *         src(i, j, ...), where the two Views have the same sizes but may
+ *         have different layouts, for example two permutations made with
+ *         make_permuted_layout.
+ *
+ *         A plain loop over the indices reads one of the arrays with a
+ *         large stride when the layouts disagree on the stride-1
+ *         dimension. permute_copy looks at both layouts' strides and, in
+ *         that case, copies square tiles of the plane spanned by the two
+ *         stride-1 dimensions, transposing each in cache (4x4 blocks in
+ *         AVX2 registers for double), so both arrays are read and written
+ *         along cache lines. When the stride-1 dimensions agree it copies
+ *         contiguous runs.
+ *
+ *         The tiles or runs are independent and are distributed by
+ *         RAJA::forall with the given execution policy. The Views must
+ *         use Layout or TypedLayout, and must not overlap.
+ *
+ ******************************************************************************
+ */
+template <typename ExecPolicy,
+          typename T,
+          typename SrcLayout,
+          typename SrcPointer,
+          typename U,
+          typename DstLayout,
+          typename DstPointer>
+RAJA_INLINE void permute_copy(View<T, SrcLayout, SrcPointer> const& src,
+                              View<U, DstLayout, DstPointer> const& dst)
+{
+  static_assert(SrcLayout::n_dims == DstLayout::n_dims,
+                "permute_copy views must have the same number of dimensions");
+  constexpr size_t rank = SrcLayout::n_dims;
+  const detail::permute_plan<rank> plan =
+      detail::make_permute_plan<rank>(src.layout, dst.layout);
+  const T* s = src.data;
+  U* d = dst.data;
+  RAJA::forall<ExecPolicy>(RangeSegment(0, plan.work_items()),
+                           [=](Index_type w) { plan(w, s, d); });
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,165 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA::reduce_params, reducers passed to
+ *          forall as a parameter rather than captured by the loop body.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_reduce_params_HPP
+#define RAJA_pattern_reduce_params_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+#include <utility>
+
+#include "camp/camp.hpp"
+#include "camp/tuple.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  The reducers of a RAJA::reduce_params loop.
+ *
+ *         A lambda that captures reducers copies each of them for every
+ *         thread or chunk of iterations, and every update goes through the
+ *         copy's combiner. With
+ *
+ *           RAJA::forall<pol>(seg, RAJA::reduce_params(sum, maxloc),
+ *             [=](int i, auto &s, auto &m) { s += x[i]; m.maxloc(x[i], i); });
+ *
+ *         the body instead gets one plain accumulator per reducer, in the
+ *         order given, after the loop index. Each thread owns its own set,
+ *         which the compiler can keep in registers, and folds it into the
+ *         reducers once when its part of the loop is done.
+ *
+ *         The accumulator types are the reducers' param_type; they have the
+ *         same update functions as the reducers (+=, min, max, minloc,
+ *         maxloc).
+ *
+ ******************************************************************************
+ */
+template <typename... Reducers>
+struct reduce_param_pack {
+  using locals_type = camp::tuple<typename Reducers::param_type...>;
+
+  camp::tuple<Reducers const *...> reducers;
+
+  //! a fresh set of accumulators, each at its reducer's identity
+  locals_type make_locals() const { return locals_type{}; }
+
+  //! fold one thread's accumulators into the reducers
+  void merge(locals_type const &locals) const
+  {
+    merge(locals, camp::make_idx_seq_t<sizeof...(Reducers)>{});
+  }
+
+private:
+  template <camp::idx_t... Is>
+  void merge(locals_type const &locals, camp::idx_seq<Is...>) const
+  {
+    // a copy of each reducer made by this thread merges the way the body's
+    // copies would, so every reduction policy works unchanged
+    camp::sink((merge_one(*camp::get<Is>(reducers), camp::get<Is>(locals)),
+                0)...);
+  }
+
+  template <typename Reducer, typename Param>
+  static void merge_one(Reducer const &reducer, Param const &param)
+  {
+    Reducer copy(reducer);
+    copy.merge_param(param);
+  }
+};
+
+//! pass reducers to forall as accumulator parameters of the loop body
+template <typename... Reducers>
+RAJA_INLINE reduce_param_pack<Reducers...> reduce_params(
+    Reducers const &... reducers)
+{
+  return reduce_param_pack<Reducers...>{
+      camp::tuple<Reducers const *...>{&reducers...}};
+}
+
+namespace type_traits
+{
+
+template <typename T>
+struct is_reduce_param_pack : std::false_type {
+};
+
+template <typename... Reducers>
+struct is_reduce_param_pack<reduce_param_pack<Reducers...>> : std::true_type {
+};
+
+}  // namespace type_traits
+
+namespace detail
+{
+
+//! calls body(args..., accumulators...) for one thread's accumulators
+template <typename Body, typename Locals, typename Seq>
+struct ParamBody;
+
+template <typename Body, typename... Params, camp::idx_t... Is>
+struct ParamBody<Body, camp::tuple<Params...>, camp::idx_seq<Is...>> {
+  Body &body;
+  camp::tuple<Params...> &locals;
+
+  template <typename... Args>
+  RAJA_INLINE void operator()(Args &&... args) const
+  {
+    body(std::forward<Args>(args)..., camp::get<Is>(locals)...);
+  }
+};
+
+template <typename Body, typename... Params>
+RAJA_INLINE ParamBody<Body,
+                      camp::tuple<Params...>,
+                      camp::make_idx_seq_t<sizeof...(Params)>>
+make_param_body(Body &body, camp::tuple<Params...> &locals)
+{
+  return {body, locals};
+}
+
+/*!
+ * \brief reduce_params loop run by a single thread: one set of accumulators
+ *        for the whole iteration space.
+ */
+template <typename ExecPolicy,
+          typename Iterable,
+          typename ParamPack,
+          typename Func>
+RAJA_INLINE void forall_param_serial(ExecPolicy const &p,
+                                     Iterable &&iter,
+                                     ParamPack const &params,
+                                     Func &&loop_body)
+{
+  auto locals = params.make_locals();
+  forall_impl(p,
+              std::forward<Iterable>(iter),
+              make_param_body(loop_body, locals));
+  params.merge(locals);
+}
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
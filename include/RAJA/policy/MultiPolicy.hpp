@@ -20,14 +20,21 @@
 
 #include "RAJA/config.hpp"
 
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <limits>
 #include <tuple>
+#include <type_traits>
 
 #include "RAJA/internal/LegacyCompatibility.hpp"
 
 #include "RAJA/policy/PolicyBase.hpp"
 
+#include "RAJA/util/Timer.hpp"
 #include "RAJA/util/chai_support.hpp"
 #include "RAJA/util/concepts.hpp"
+#include "RAJA/util/mutex.hpp"
 
 namespace RAJA
 {
@@ -36,7 +43,72 @@ namespace detail
 {
 template <size_t index, size_t size, typename Policy, typename... rest>
 struct policy_invoker;
+
+//! number of size buckets an auto-tuned call site keeps, one per power of 2
+static constexpr int auto_tune_buckets = 64;
+
+//! bucket of a launch over n iterates: 0 for empty, else 1 + floor(log2(n))
+inline int auto_tune_bucket(size_t n)
+{
+  int b = 0;
+  while (n != 0 && b < auto_tune_buckets - 1) {
+    n >>= 1;
+    ++b;
+  }
+  return b;
+}
+
+/*!
+ * Tuning state of one call site and size bucket.
+ *
+ * chosen is -1 while candidates are sampled and the index of the fastest
+ * candidate once locked in; the locked path only reads it.
+ */
+template <size_t NumPolicies>
+struct auto_tune_record {
+  std::atomic<int> chosen{-1};
+  std::atomic<long> since_lock{0};
+#if defined(RAJA_ENABLE_OPENMP)
+  omp::mutex mutex;
+#endif
+  int handed_out = 0;
+  int measured = 0;
+  //! best observed seconds per iterate of each candidate
+  double best[NumPolicies];
+
+  auto_tune_record() { restart(); }
+
+  void restart()
+  {
+    handed_out = 0;
+    measured = 0;
+    for (auto& b : best) {
+      b = std::numeric_limits<double>::max();
+    }
+  }
+
+  int fastest() const
+  {
+    int f = 0;
+    for (int p = 1; p < static_cast<int>(NumPolicies); ++p) {
+      if (best[p] < best[f]) f = p;
+    }
+    return f;
+  }
+};
+
+/*!
+ * Tuning state of every size bucket of a call site. There is one table per
+ * AutoTunedPolicy type and loop body type; each lambda has its own type, so
+ * a lambda body identifies its call site.
+ */
+template <typename Tuner, typename Body>
+auto_tune_record<Tuner::num_policies>* auto_tune_table()
+{
+  static auto_tune_record<Tuner::num_policies> table[auto_tune_buckets];
+  return table;
 }
+}  // namespace detail
 
 namespace policy
 {
@@ -65,9 +137,9 @@ public:
   template <typename Iterable, typename Body>
   int invoke(Iterable &&i, Body &&b)
   {
-    size_t index = s(i);
+    const int index = s(i);
     _policies.invoke(index, i, b);
-    return s(i);
+    return index;
   }
 
   detail::
@@ -91,9 +163,145 @@ RAJA_INLINE void forall_impl(MultiPolicy<Selector, Policies...> p,
   p.invoke(iter, body);
 }
 
+/// AutoTunedPolicy - Meta-policy that picks the fastest of a compile-time
+/// list of policies by timing them
+///
+/// The first launches of each call site and size bucket (powers of 2 of the
+/// iteration count) run the candidates in turn, samples launches each. The
+/// candidate with the best time per iterate is then used for every launch of
+/// that call site and bucket. With a nonzero resample_interval, the
+/// candidates are sampled again after that many launches, to follow changes
+/// in load or data.
+///
+/// Call sites are told apart by the loop body type, which is unique for
+/// every lambda. Timing assumes the candidates run synchronously, as the
+/// host policies do.
+///
+/// \tparam Policies Variadic pack of candidate policies, numbered from 0
+template <typename... Policies>
+class AutoTunedPolicy
+{
+public:
+  static constexpr size_t num_policies = sizeof...(Policies);
+
+  AutoTunedPolicy(int samples = 3, long resample_interval = 0)
+      : _samples(samples < 1 ? 1 : samples),
+        _resample_interval(resample_interval),
+        _policies(Policies{}...)
+  {
+  }
+
+  AutoTunedPolicy(int samples, long resample_interval, Policies... policies)
+      : _samples(samples < 1 ? 1 : samples),
+        _resample_interval(resample_interval),
+        _policies(policies...)
+  {
+  }
+
+  /// run b over i with the tuned policy, returning the index of the policy
+  template <typename Iterable, typename Body>
+  int invoke(Iterable &&i, Body &&b)
+  {
+    using std::begin;
+    using std::distance;
+    using std::end;
+    using body_type = typename std::decay<Body>::type;
+    const size_t n = static_cast<size_t>(distance(begin(i), end(i)));
+    auto &rec = detail::auto_tune_table<AutoTunedPolicy, body_type>()
+        [detail::auto_tune_bucket(n)];
+
+    int index = rec.chosen.load(std::memory_order_acquire);
+    if (index >= 0 && !resample_due(rec)) {
+      _policies.invoke(index, i, b);
+      return index;
+    }
+
+    bool sample = false;
+    {
+#if defined(RAJA_ENABLE_OPENMP)
+      lock_guard<RAJA::omp::mutex> lock(rec.mutex);
+#endif
+      index = rec.chosen.load(std::memory_order_relaxed);
+      if (index < 0) {
+        sample = true;
+        index = rec.handed_out++ % static_cast<int>(num_policies);
+      }
+    }
+    if (!sample) {
+      // locked in by another thread meanwhile
+      _policies.invoke(index, i, b);
+      return index;
+    }
+
+    Timer timer;
+    timer.start();
+    _policies.invoke(index, i, b);
+    timer.stop();
+    const double per_iterate = timer.elapsed() / (n ? n : 1);
+
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<RAJA::omp::mutex> lock(rec.mutex);
+#endif
+    if (rec.chosen.load(std::memory_order_relaxed) < 0) {
+      if (per_iterate < rec.best[index]) rec.best[index] = per_iterate;
+      if (++rec.measured >= _samples * static_cast<int>(num_policies)) {
+        rec.since_lock.store(0, std::memory_order_relaxed);
+        rec.chosen.store(rec.fastest(), std::memory_order_release);
+      }
+    }
+    return index;
+  }
+
+  /// policy locked in for body b over n iterates, -1 while sampling
+  template <typename Body>
+  static int selected(const Body &, size_t n)
+  {
+    using body_type = typename std::decay<Body>::type;
+    return detail::auto_tune_table<AutoTunedPolicy, body_type>()
+        [detail::auto_tune_bucket(n)]
+            .chosen.load(std::memory_order_acquire);
+  }
+
+private:
+  //! true if this launch restarts sampling; the caller then samples
+  bool resample_due(detail::auto_tune_record<num_policies> &rec) const
+  {
+    if (_resample_interval <= 0 ||
+        rec.since_lock.fetch_add(1, std::memory_order_relaxed) + 1 <
+            _resample_interval) {
+      return false;
+    }
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<RAJA::omp::mutex> lock(rec.mutex);
+#endif
+    if (rec.chosen.load(std::memory_order_relaxed) >= 0) {
+      rec.restart();
+      rec.chosen.store(-1, std::memory_order_relaxed);
+    }
+    return true;
+  }
+
+  int _samples;
+  long _resample_interval;
+  detail::
+      policy_invoker<sizeof...(Policies) - 1, sizeof...(Policies), Policies...>
+          _policies;
+};
+
+/// forall_impl - AutoTunedPolicy specialization, times the candidate
+/// policies and dispatches to the fastest
+template <typename Iterable, typename Body, typename... Policies>
+RAJA_INLINE void forall_impl(AutoTunedPolicy<Policies...> p,
+                             Iterable &&iter,
+                             Body &&body)
+{
+  p.invoke(iter, body);
+}
+
 }  // end namespace multi
 }  // end namespace policy
 
+using policy::multi::AutoTunedPolicy;
 using policy::multi::MultiPolicy;
 
 namespace detail
@@ -150,6 +358,11 @@ template <typename SELECTOR, typename... POLICIES>
 struct get_platform<RAJA::MultiPolicy<SELECTOR, POLICIES...>> {
   static constexpr Platform value = Platform::undefined;
 };
+
+template <typename... POLICIES>
+struct get_platform<RAJA::AutoTunedPolicy<POLICIES...>> {
+  static constexpr Platform value = Platform::undefined;
+};
 #endif
 
 
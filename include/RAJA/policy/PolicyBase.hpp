@@ -33,7 +33,8 @@ enum class Policy {
   openmp,
   target_openmp,
   cuda,
-  tbb
+  tbb,
+  threads
 };
 
 enum class Pattern {
@@ -113,6 +114,12 @@ namespace reduce
 struct ordered {
 };
 
+struct padded {
+};
+
+struct deterministic {
+};
+
 }  // namespace reduce
 
 
@@ -168,6 +175,9 @@ template <typename Pol>
 struct is_tbb_policy : RAJA::policy_is<Pol, RAJA::Policy::tbb> {
 };
 template <typename Pol>
+struct is_threads_policy : RAJA::policy_is<Pol, RAJA::Policy::threads> {
+};
+template <typename Pol>
 struct is_target_openmp_policy
     : RAJA::policy_is<Pol, RAJA::Policy::target_openmp> {
 };
@@ -32,6 +32,8 @@
 
 #include "RAJA/internal/fault_tolerance.hpp"
 
+#include "RAJA/pattern/reduce_params.hpp"
+
 using RAJA::concepts::enable_if;
 
 namespace RAJA
@@ -61,6 +63,19 @@ RAJA_INLINE void forall_impl(const loop_exec &, Iterable &&iter, Func &&body)
   }
 }
 
+//! a loop given RAJA::reduce_params keeps one set of accumulators
+template <typename Iterable, typename ParamPack, typename Func>
+RAJA_INLINE void forall_param_impl(const loop_exec &p,
+                                   Iterable &&iter,
+                                   ParamPack const &params,
+                                   Func &&loop_body)
+{
+  RAJA::detail::forall_param_serial(p,
+                                    std::forward<Iterable>(iter),
+                                    params,
+                                    loop_body);
+}
+
 }  // namespace loop
 
 }  // namespace policy
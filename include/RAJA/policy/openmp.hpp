@@ -36,6 +36,7 @@
 #include "RAJA/policy/openmp/reduce.hpp"
 #include "RAJA/policy/openmp/region.hpp"
 #include "RAJA/policy/openmp/scan.hpp"
+#include "RAJA/policy/openmp/sort.hpp"
 #include "RAJA/policy/openmp/synchronize.hpp"
 
 #endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
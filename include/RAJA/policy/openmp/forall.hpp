@@ -25,13 +25,18 @@
 
 #if defined(RAJA_ENABLE_OPENMP)
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <memory>
+#include <thread>
 #include <type_traits>
 
 #include <omp.h>
 
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/internal/WorkStealingDeque.hpp"
 #include "RAJA/internal/fault_tolerance.hpp"
 
 #include "RAJA/index/IndexSet.hpp"
@@ -41,6 +46,7 @@
 #include "RAJA/policy/openmp/policy.hpp"
 
 #include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/reduce_params.hpp"
 #include "RAJA/pattern/region.hpp"
 
 
@@ -68,6 +74,32 @@ RAJA_INLINE void forall_impl(const omp_parallel_exec<InnerPolicy>&,
   });
 }
 
+///
+/// OpenMP parallel for with RAJA::reduce_params: each thread runs its share
+/// of the loop with its own accumulators and merges them once at the end
+///
+
+template <typename Iterable,
+          typename ParamPack,
+          typename Func,
+          typename InnerPolicy>
+RAJA_INLINE void forall_param_impl(const omp_parallel_exec<InnerPolicy>&,
+                                   Iterable&& iter,
+                                   ParamPack const& params,
+                                   Func&& loop_body)
+{
+  RAJA::region<RAJA::omp_parallel_region>([&]() {
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(loop_body);
+    auto& body = privatizer.get_priv();
+    auto locals = params.make_locals();
+    forall_impl(InnerPolicy{},
+                iter,
+                RAJA::detail::make_param_body(body, locals));
+    params.merge(locals);
+  });
+}
+
 ///
 /// OpenMP for nowait policy implementation
 ///
@@ -104,7 +136,7 @@ RAJA_INLINE void forall_impl(const omp_for_exec&,
 /// OpenMP parallel for static policy implementation
 ///
 
-template <typename Iterable, typename Func, size_t ChunkSize>
+template <typename Iterable, typename Func, unsigned int ChunkSize>
 RAJA_INLINE void forall_impl(const omp_for_static<ChunkSize>&,
                              Iterable&& iter,
                              Func&& loop_body)
@@ -116,6 +148,61 @@ RAJA_INLINE void forall_impl(const omp_for_static<ChunkSize>&,
   }
 }
 
+namespace detail
+{
+
+//! index value of the first iterate of a unit-stride range
+template <typename T>
+RAJA_INLINE Index_type affinity_origin(const TypedRangeSegment<T>& r)
+{
+  return r.size() ? static_cast<Index_type>(*r.begin()) : 0;
+}
+
+//! other iterables are mapped by position
+template <typename Iterable>
+RAJA_INLINE Index_type affinity_origin(const Iterable&)
+{
+  return 0;
+}
+
+//! floor(a / b) for b > 0
+RAJA_INLINE Index_type floor_div(Index_type a, Index_type b)
+{
+  return (a >= 0) ? a / b : -((-a + b - 1) / b);
+}
+
+}  // namespace detail
+
+///
+/// OpenMP affinity-stable static policy implementation
+///
+
+template <typename Iterable, typename Func, unsigned int ChunkSize>
+RAJA_INLINE void forall_impl(const omp_for_affinity_static<ChunkSize>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  static_assert(ChunkSize > 0, "omp_for_affinity_static needs a chunk size");
+  RAJA_EXTRACT_BED_IT(iter);
+  const Index_type chunk = ChunkSize;
+  const Index_type nthreads = omp_get_num_threads();
+  const Index_type tid = omp_get_thread_num();
+  const Index_type lo = detail::affinity_origin(iter);
+  const Index_type hi = lo + static_cast<Index_type>(distance_it);
+
+  // absolute chunks owned by this thread: c with c % nthreads == tid
+  const Index_type first = detail::floor_div(lo, chunk);
+  Index_type c = first + (tid - first % nthreads + nthreads) % nthreads;
+  for (; c * chunk < hi; c += nthreads) {
+    const Index_type begin = std::max(c * chunk, lo) - lo;
+    const Index_type end = std::min((c + 1) * chunk, hi) - lo;
+    for (Index_type i = begin; i < end; ++i) {
+      loop_body(begin_it[i]);
+    }
+  }
+#pragma omp barrier
+}
+
 //
 //////////////////////////////////////////////////////////////////////
 //
@@ -126,30 +213,26 @@ RAJA_INLINE void forall_impl(const omp_for_static<ChunkSize>&,
 //////////////////////////////////////////////////////////////////////
 //
 
+namespace detail
+{
+
 /*!
  ******************************************************************************
  *
- * \brief  Iterate over index set segments using an omp parallel loop and
- *         segment dependency graph. Individual segment execution will use
- *         execution policy template parameter.
+ * \brief  Execute index set segments in dependency order.
  *
- *         This method assumes that a task dependency graph has been
- *         properly set up for each segment in the index set.
+ *         Each thread owns a work-stealing deque of ready segments. A thread
+ *         that completes a segment satisfies one dependency of each of its
+ *         dependent segments and pushes those that became ready onto its
+ *         own deque; idle threads steal from the other deques. Segments with
+ *         no dependencies are seeded on the thread given by seg_owner.
  *
  ******************************************************************************
  */
-
-/*
- * TODO: Fix this!!!
- */
-
-/*
-template <typename SEG_EXEC_POLICY_T, typename LOOP_BODY, typename ...
-SEG_TYPES>
-RAJA_INLINE void forall(
-    ExecPolicy<omp_taskgraph_segit, SEG_EXEC_POLICY_T>,
-    const IndexSet<SEG_TYPES ...>& iset,
-    LOOP_BODY loop_body)
+template <typename Func, typename SegOwner, typename... SegmentTypes>
+RAJA_INLINE void forall_taskgraph(const TypedIndexSet<SegmentTypes...>& iset,
+                                  Func&& loop_body,
+                                  SegOwner&& seg_owner)
 {
   if (!iset.dependencyGraphSet()) {
     std::cerr << "\n RAJA IndexSet dependency graph not set , "
@@ -157,36 +240,110 @@ RAJA_INLINE void forall(
     RAJA_ABORT_OR_THROW("IndexSet dependency graph");
   }
 
-  IndexSet& ncis = (*const_cast<IndexSet*>(&iset));
+  const int num_seg = iset.getNumSegments();
+  const int max_threads = omp_get_max_threads();
 
-  int num_seg = ncis.getNumSegments();
+  using RAJA::internal::WorkStealingDeque;
+  std::unique_ptr<WorkStealingDeque<int>[]> ready(
+      new WorkStealingDeque<int>[max_threads]);
+  for (int t = 0; t < max_threads; ++t) {
+    ready[t].reserve(num_seg);
+  }
+  std::atomic<int> num_remaining(num_seg);
+
+  RAJA::region<RAJA::omp_parallel_region>([&]() {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
 
-#pragma omp parallel for schedule(static, 1)
-  for (int isi = 0; isi < num_seg; ++isi) {
-    IndexSetSegInfo* seg_info = ncis.getSegmentInfo(isi);
-    DepGraphNode* task = seg_info->getDepGraphNode();
+    const int tid = omp_get_thread_num();
+    const int nthreads = omp_get_num_threads();
+    WorkStealingDeque<int>& my_ready = ready[tid];
 
-    task->wait();
+    // seed in reverse so the owner pops ready segments in index order
+    for (int isi = num_seg - 1; isi >= 0; --isi) {
+      DepGraphNode* task = iset.getSegmentDepGraphNode(isi);
+      if (task->semaphoreReloadValue() == 0 && seg_owner(isi, nthreads) == tid) {
+        my_ready.push(isi);
+      }
+    }
 
-    executeRangeList_forall<SEG_EXEC_POLICY_T>(seg_info, loop_body);
+    int isi;
+    while (num_remaining.load(std::memory_order_acquire) > 0) {
+      bool found = my_ready.pop(isi);
+      for (int victim = 1; !found && victim < nthreads; ++victim) {
+        found = ready[(tid + victim) % nthreads].steal(isi);
+      }
+      if (!found) {
+        std::this_thread::yield();
+        continue;
+      }
 
-    task->reset();
+      body.get_priv()(isi);
 
-    if (task->numDepTasks() != 0) {
+      DepGraphNode* task = iset.getSegmentDepGraphNode(isi);
       for (int ii = 0; ii < task->numDepTasks(); ++ii) {
-        // Alternateively, we could get the return value of this call
-        // and actively launch the task if we are the last depedent
-        // task. In that case, we would not need the semaphore spin
-        // loop above.
         int seg = task->depTaskNum(ii);
-        DepGraphNode* dep = ncis.getSegmentInfo(seg)->getDepGraphNode();
-        dep->satisfyOne();
+        if (iset.getSegmentDepGraphNode(seg)->satisfyOne()) {
+          my_ready.push(seg);
+        }
       }
+      task->reset();
+
+      num_remaining.fetch_sub(1, std::memory_order_acq_rel);
     }
+  });
+}
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Iterate over index set segments using OpenMP threads and the
+ *         segment dependency graph. Individual segment execution will use
+ *         execution policy template parameter.
+ *
+ *         This method assumes that a task dependency graph has been
+ *         properly set up for each segment in the index set.
+ *
+ ******************************************************************************
+ */
+template <typename Func, typename... SegmentTypes>
+RAJA_INLINE void forall_impl(const omp_taskgraph_segit&,
+                             const TypedIndexSet<SegmentTypes...>& iset,
+                             Func&& loop_body)
+{
+  detail::forall_taskgraph(iset, loop_body, [](int isi, int nthreads) {
+    return isi % nthreads;
+  });
+}
 
-  }  // iterate over segments of index set
+/*!
+ ******************************************************************************
+ *
+ * \brief  Same as above, but ready segments with no dependencies start on
+ *         the thread whose segment interval (see setSegmentInterval) holds
+ *         them; interval i is assigned to thread i % num_threads. Segments
+ *         outside of every interval are assigned round-robin.
+ *
+ ******************************************************************************
+ */
+template <typename Func, typename... SegmentTypes>
+RAJA_INLINE void forall_impl(const omp_taskgraph_interval_segit&,
+                             const TypedIndexSet<SegmentTypes...>& iset,
+                             Func&& loop_body)
+{
+  const int num_intervals = iset.getNumSegmentIntervals();
+  detail::forall_taskgraph(iset, loop_body, [&](int isi, int nthreads) {
+    for (int ival = 0; ival < num_intervals; ++ival) {
+      if (isi >= iset.getSegmentIntervalBegin(ival)
+          && isi < iset.getSegmentIntervalEnd(ival)) {
+        return ival % nthreads;
+      }
+    }
+    return isi % nthreads;
+  });
 }
-*/
 
 }  // namespace omp
 
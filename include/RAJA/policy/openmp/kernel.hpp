@@ -20,5 +20,7 @@
 #define RAJA_policy_openmp_kernel_HPP
 
 #include "RAJA/policy/openmp/kernel/Collapse.hpp"
+#include "RAJA/policy/openmp/kernel/Hyperplane.hpp"
+#include "RAJA/policy/openmp/kernel/Reduce.hpp"
 
 #endif  // closing endif for header file include guard
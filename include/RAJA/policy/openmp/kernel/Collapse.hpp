@@ -22,8 +22,7 @@
 
 #if defined(RAJA_ENABLE_OPENMP)
 
-#include <cassert>
-#include <climits>
+#include <omp.h>
 
 #include "RAJA/pattern/detail/privatizer.hpp"
 
@@ -37,107 +36,258 @@
 
 #include "RAJA/internal/LegacyCompatibility.hpp"
 
-#if !defined(RAJA_COMPILER_MSVC)
-#define RAJA_COLLAPSE(X) collapse(X)
-#else
-#define RAJA_COLLAPSE(X)
-#endif
-
 namespace RAJA
 {
 
+/*!
+ * Collapse policies for OpenMP.
+ *
+ * The collapsed loops are linearized into one iteration space, which is
+ * split into contiguous blocks of linear iterations.  Each block decodes
+ * its first multi-index once and then steps through the nest, assigning
+ * only the indices that change.
+ *
+ * omp_parallel_collapse_exec gives each thread one contiguous block, as
+ * schedule(static) does.  omp_parallel_collapse_static<ChunkSize> and
+ * omp_parallel_collapse_dynamic<ChunkSize> hand out blocks of ChunkSize
+ * linear iterations as schedule(static, ChunkSize) and
+ * schedule(dynamic, ChunkSize) do; a ChunkSize of 0 for the static policy
+ * means one block per thread.
+ */
 struct omp_parallel_collapse_exec
     : make_policy_pattern_t<RAJA::Policy::openmp,
                             RAJA::Pattern::forall,
                             RAJA::policy::omp::For> {
 };
 
+template <unsigned int ChunkSize>
+struct omp_parallel_collapse_static
+    : make_policy_pattern_t<RAJA::Policy::openmp,
+                            RAJA::Pattern::forall,
+                            RAJA::policy::omp::For,
+                            RAJA::policy::omp::Static<ChunkSize>> {
+};
+
+template <unsigned int ChunkSize = 1>
+struct omp_parallel_collapse_dynamic
+    : make_policy_pattern_t<RAJA::Policy::openmp,
+                            RAJA::Pattern::forall,
+                            RAJA::policy::omp::For,
+                            RAJA::policy::omp::Dynamic<ChunkSize>> {
+};
+
 namespace internal
 {
 
-/////////
-// Collapsing two loops
-/////////
+/*!
+ * Steps the multi-index of a collapsed nest, for the arguments in Args.
+ *
+ * Dim is the position in Args of the index being stepped; idx and len hold
+ * the current multi-index and the extents, in Args order.
+ */
+template <typename Args, camp::idx_t Dim>
+struct OmpCollapseIndex;
 
-template <camp::idx_t Arg0, camp::idx_t Arg1, typename... EnclosedStmts>
-struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
-                                             ArgList<Arg0, Arg1>,
-                                             EnclosedStmts...>> {
+template <camp::idx_t... Args, camp::idx_t Dim>
+struct OmpCollapseIndex<ArgList<Args...>, Dim> {
 
+  static constexpr camp::idx_t arg =
+      camp::at_v<camp::list<camp::num<Args>...>, Dim>::value;
 
+  //! advance index Dim by one, carrying into the outer indices
   template <typename Data>
-  static RAJA_INLINE void exec(Data&& data)
+  static RAJA_INLINE void carry(Data& data,
+                                Index_type* idx,
+                                const Index_type* len)
   {
-    const auto l0 = segment_length<Arg0>(data);
-    const auto l1 = segment_length<Arg1>(data);
-    // NOTE: these are here to avoid a use-after-scope detected by address
-    // sanitizer, probably a false positive, but the result should be
-    // essentially identical
-    auto i0 = l0;
-    auto i1 = l1;
+    if (++idx[Dim] == len[Dim]) {
+      idx[Dim] = 0;
+      OmpCollapseIndex<ArgList<Args...>, Dim - 1>::carry(data, idx, len);
+    }
+    data.template assign_offset<arg>(idx[Dim]);
+  }
+};
 
-    using RAJA::internal::thread_privatize;
-    auto privatizer = thread_privatize(data);
-#pragma omp parallel for private(i0, i1) firstprivate(privatizer) \
-    RAJA_COLLAPSE(2)
-    for (i0 = 0; i0 < l0; ++i0) {
-      for (i1 = 0; i1 < l1; ++i1) {
-        auto& private_data = privatizer.get_priv();
-        private_data.template assign_offset<Arg0>(i0);
-        private_data.template assign_offset<Arg1>(i1);
-        execute_statement_list<camp::list<EnclosedStmts...>>(private_data);
-      }
+template <camp::idx_t... Args>
+struct OmpCollapseIndex<ArgList<Args...>, -1> {
+  template <typename Data>
+  static RAJA_INLINE void carry(Data&, Index_type*, const Index_type*)
+  {
+  }
+};
+
+template <camp::idx_t... Args, camp::idx_t... Dims, typename Data>
+RAJA_INLINE void omp_collapse_assign(Data& data,
+                                     const Index_type* idx,
+                                     ArgList<Args...>,
+                                     camp::idx_seq<Dims...>)
+{
+  camp::sink((data.template assign_offset<Args>(idx[Dims]), 0)...);
+}
+
+/*!
+ * Runs linear iterations [begin, end) of a collapsed nest with extents len.
+ */
+template <camp::idx_t... Args, typename... EnclosedStmts, typename Data>
+RAJA_INLINE void omp_collapse_block(Data& data,
+                                    const Index_type* len,
+                                    Index_type begin,
+                                    Index_type end,
+                                    ArgList<Args...>,
+                                    camp::list<EnclosedStmts...>)
+{
+  constexpr camp::idx_t N = sizeof...(Args);
+  constexpr camp::idx_t inner = N - 1;
+  using args = ArgList<Args...>;
+  using inner_index = OmpCollapseIndex<args, inner>;
+
+  // decode the first multi-index of the block
+  Index_type idx[N];
+  Index_type rest = begin;
+  for (camp::idx_t d = inner; d >= 0; --d) {
+    idx[d] = rest % len[d];
+    rest /= len[d];
+  }
+  omp_collapse_assign(data, idx, args{}, camp::make_idx_seq_t<N>{});
+
+  // run the innermost index as a plain loop, carrying into the outer
+  // indices between rows
+  Index_type remaining = end - begin;
+  while (true) {
+    const Index_type row_begin = idx[inner];
+    const Index_type row_end = len[inner] - row_begin < remaining
+                                   ? len[inner]
+                                   : row_begin + remaining;
+    for (Index_type i = row_begin; i < row_end; ++i) {
+      data.template assign_offset<inner_index::arg>(i);
+      execute_statement_list<camp::list<EnclosedStmts...>>(data);
     }
+    remaining -= row_end - row_begin;
+    if (remaining == 0) break;
+    idx[inner] = 0;
+    OmpCollapseIndex<args, inner - 1>::carry(data, idx, len);
   }
+}
+
+//! schedule of an OpenMP collapse policy
+template <typename ExecPolicy>
+struct OmpCollapseSchedule {
+  static constexpr bool dynamic = false;
+  static constexpr unsigned int chunk_size = 0;
 };
 
+template <unsigned int ChunkSize>
+struct OmpCollapseSchedule<omp_parallel_collapse_static<ChunkSize>> {
+  static constexpr bool dynamic = false;
+  static constexpr unsigned int chunk_size = ChunkSize;
+};
+
+template <unsigned int ChunkSize>
+struct OmpCollapseSchedule<omp_parallel_collapse_dynamic<ChunkSize>> {
+  static constexpr bool dynamic = true;
+  static constexpr unsigned int chunk_size = ChunkSize > 0 ? ChunkSize : 1;
+};
 
-template <camp::idx_t Arg0,
-          camp::idx_t Arg1,
-          camp::idx_t Arg2,
-          typename... EnclosedStmts>
-struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
-                                             ArgList<Arg0, Arg1, Arg2>,
-                                             EnclosedStmts...>> {
+//! Collapse executor shared by the OpenMP collapse policies
+template <typename ExecPolicy, typename Args, typename... EnclosedStmts>
+struct OmpCollapseExecutor;
 
+template <typename ExecPolicy, camp::idx_t... Args, typename... EnclosedStmts>
+struct OmpCollapseExecutor<ExecPolicy, ArgList<Args...>, EnclosedStmts...> {
 
   template <typename Data>
   static RAJA_INLINE void exec(Data&& data)
   {
-    const auto l0 = segment_length<Arg0>(data);
-    const auto l1 = segment_length<Arg1>(data);
-    const auto l2 = segment_length<Arg2>(data);
-    auto i0 = l0;
-    auto i1 = l1;
-    auto i2 = l2;
+    using schedule = OmpCollapseSchedule<ExecPolicy>;
+    using args = ArgList<Args...>;
+    using stmts = camp::list<EnclosedStmts...>;
+
+    const Index_type len[] = {
+        static_cast<Index_type>(segment_length<Args>(data))...};
+    Index_type total = 1;
+    for (Index_type l : len) {
+      total *= l > 0 ? l : 0;
+    }
+    if (total == 0) return;
 
     using RAJA::internal::thread_privatize;
     auto privatizer = thread_privatize(data);
-#pragma omp parallel for private(i0, i1, i2) firstprivate(privatizer) \
-    RAJA_COLLAPSE(3)
-    for (i0 = 0; i0 < l0; ++i0) {
-      for (i1 = 0; i1 < l1; ++i1) {
-        for (i2 = 0; i2 < l2; ++i2) {
-          auto& private_data = privatizer.get_priv();
-          private_data.template assign_offset<Arg0>(i0);
-          private_data.template assign_offset<Arg1>(i1);
-          private_data.template assign_offset<Arg2>(i2);
-          execute_statement_list<camp::list<EnclosedStmts...>>(private_data);
+
+    if (schedule::chunk_size == 0) {
+#pragma omp parallel firstprivate(privatizer)
+      {
+        // one contiguous block per thread, sized as schedule(static)
+        auto& private_data = privatizer.get_priv();
+        const Index_type nthreads = omp_get_num_threads();
+        const Index_type tid = omp_get_thread_num();
+        const Index_type size = total / nthreads;
+        const Index_type extra = total % nthreads;
+        const Index_type begin = tid * size + (tid < extra ? tid : extra);
+        const Index_type end = begin + size + (tid < extra ? 1 : 0);
+        if (begin < end) {
+          omp_collapse_block(private_data, len, begin, end, args{}, stmts{});
+        }
+      }
+      return;
+    }
+
+    const Index_type chunk = schedule::chunk_size;
+    const Index_type nchunks = (total + chunk - 1) / chunk;
+#pragma omp parallel firstprivate(privatizer)
+    {
+      auto& private_data = privatizer.get_priv();
+      if (schedule::dynamic) {
+#pragma omp for schedule(dynamic, 1)
+        for (Index_type c = 0; c < nchunks; ++c) {
+          const Index_type end = c * chunk + chunk < total ? c * chunk + chunk
+                                                           : total;
+          omp_collapse_block(
+              private_data, len, c * chunk, end, args{}, stmts{});
+        }
+      } else {
+#pragma omp for schedule(static, 1)
+        for (Index_type c = 0; c < nchunks; ++c) {
+          const Index_type end = c * chunk + chunk < total ? c * chunk + chunk
+                                                           : total;
+          omp_collapse_block(
+              private_data, len, c * chunk, end, args{}, stmts{});
         }
       }
     }
   }
 };
 
+template <typename Args, typename... EnclosedStmts>
+struct StatementExecutor<
+    statement::Collapse<omp_parallel_collapse_exec, Args, EnclosedStmts...>>
+    : OmpCollapseExecutor<omp_parallel_collapse_exec,
+                          Args,
+                          EnclosedStmts...> {
+};
 
+template <unsigned int ChunkSize, typename Args, typename... EnclosedStmts>
+struct StatementExecutor<
+    statement::Collapse<omp_parallel_collapse_static<ChunkSize>,
+                        Args,
+                        EnclosedStmts...>>
+    : OmpCollapseExecutor<omp_parallel_collapse_static<ChunkSize>,
+                          Args,
+                          EnclosedStmts...> {
+};
 
-
+template <unsigned int ChunkSize, typename Args, typename... EnclosedStmts>
+struct StatementExecutor<
+    statement::Collapse<omp_parallel_collapse_dynamic<ChunkSize>,
+                        Args,
+                        EnclosedStmts...>>
+    : OmpCollapseExecutor<omp_parallel_collapse_dynamic<ChunkSize>,
+                          Args,
+                          EnclosedStmts...> {
+};
 
 }  // namespace internal
 }  // namespace RAJA
 
-#undef RAJA_COLLAPSE
-
 #endif  // closing endif for RAJA_ENABLE_OPENMP guard
 
 #endif  // closing endif for header file include guard
@@ -0,0 +1,191 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the OpenMP hyperplane executor of RAJA::kernel.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_openmp_kernel_Hyperplane_HPP
+#define RAJA_policy_openmp_kernel_Hyperplane_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <omp.h>
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+
+#include "RAJA/pattern/kernel/Hyperplane.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/policy/openmp/kernel/Collapse.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+namespace internal
+{
+
+/*!
+ * Hyperplane executor for the OpenMP collapse policies.
+ *
+ * All hyperplanes run in one parallel region, in order, whatever the
+ * HpExecPolicy. On each one the exact range of the first argument in
+ * Args is shared out as the collapse policy's schedule would, and the
+ * threads meet at a barrier before the next hyperplane.
+ */
+template <typename ExecPolicy,
+          camp::idx_t HpArgumentId,
+          typename Args,
+          typename... EnclosedStmts>
+struct OmpHyperplaneExecutor;
+
+template <typename ExecPolicy,
+          camp::idx_t HpArgumentId,
+          camp::idx_t Arg,
+          camp::idx_t... Rest,
+          typename... EnclosedStmts>
+struct OmpHyperplaneExecutor<ExecPolicy,
+                             HpArgumentId,
+                             ArgList<Arg, Rest...>,
+                             EnclosedStmts...> {
+
+  using rows_stmt = HyperplaneRows<HpArgumentId,
+                                   Arg,
+                                   ArgList<Rest...>,
+                                   EnclosedStmts...>;
+
+  template <typename Data>
+  static RAJA_INLINE void rows(Data& data, Index_type begin, Index_type end)
+  {
+    for (Index_type i = begin; i < end; ++i) {
+      data.template assign_offset<Arg>(i);
+      execute_statement_list<StatementList<rows_stmt>>(data);
+    }
+  }
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    using schedule = OmpCollapseSchedule<ExecPolicy>;
+
+    const Index_type hp_len =
+        hyperplane_count<HpArgumentId>(data, ArgList<Arg, Rest...>{});
+    if (hp_len == 0) return;
+    const Index_type rest =
+        hyperplane_rest<HpArgumentId>(data, ArgList<Rest...>{});
+    const Index_type len = segment_length<Arg>(data);
+
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(data);
+
+#pragma omp parallel firstprivate(privatizer)
+    {
+      auto& private_data = privatizer.get_priv();
+      const Index_type nthreads = omp_get_num_threads();
+      const Index_type tid = omp_get_thread_num();
+
+      for (Index_type h = 0; h < hp_len; ++h) {
+        private_data.template assign_offset<HpArgumentId>(h);
+        Index_type begin, end;
+        hyperplane_range(h, rest, len, begin, end);
+
+        if (schedule::chunk_size == 0) {
+          // one contiguous block per thread, sized as schedule(static)
+          const Index_type total = end - begin;
+          const Index_type size = total / nthreads;
+          const Index_type extra = total % nthreads;
+          const Index_type b =
+              begin + tid * size + (tid < extra ? tid : extra);
+          rows(private_data, b, b + size + (tid < extra ? 1 : 0));
+#pragma omp barrier
+        } else {
+          const Index_type chunk = schedule::chunk_size;
+          const Index_type nchunks = (end - begin + chunk - 1) / chunk;
+          if (schedule::dynamic) {
+#pragma omp for schedule(dynamic, 1)
+            for (Index_type c = 0; c < nchunks; ++c) {
+              const Index_type b = begin + c * chunk;
+              rows(private_data, b, b + chunk < end ? b + chunk : end);
+            }
+          } else {
+#pragma omp for schedule(static, 1)
+            for (Index_type c = 0; c < nchunks; ++c) {
+              const Index_type b = begin + c * chunk;
+              rows(private_data, b, b + chunk < end ? b + chunk : end);
+            }
+          }
+        }
+      }
+    }
+  }
+};
+
+template <camp::idx_t HpArgumentId,
+          typename HpExecPolicy,
+          camp::idx_t... Args,
+          typename... EnclosedStmts>
+struct StatementExecutor<statement::Hyperplane<HpArgumentId,
+                                               HpExecPolicy,
+                                               ArgList<Args...>,
+                                               omp_parallel_collapse_exec,
+                                               EnclosedStmts...>>
+    : OmpHyperplaneExecutor<omp_parallel_collapse_exec,
+                            HpArgumentId,
+                            ArgList<Args...>,
+                            EnclosedStmts...> {
+};
+
+template <camp::idx_t HpArgumentId,
+          typename HpExecPolicy,
+          camp::idx_t... Args,
+          unsigned int ChunkSize,
+          typename... EnclosedStmts>
+struct StatementExecutor<
+    statement::Hyperplane<HpArgumentId,
+                          HpExecPolicy,
+                          ArgList<Args...>,
+                          omp_parallel_collapse_static<ChunkSize>,
+                          EnclosedStmts...>>
+    : OmpHyperplaneExecutor<omp_parallel_collapse_static<ChunkSize>,
+                            HpArgumentId,
+                            ArgList<Args...>,
+                            EnclosedStmts...> {
+};
+
+template <camp::idx_t HpArgumentId,
+          typename HpExecPolicy,
+          camp::idx_t... Args,
+          unsigned int ChunkSize,
+          typename... EnclosedStmts>
+struct StatementExecutor<
+    statement::Hyperplane<HpArgumentId,
+                          HpExecPolicy,
+                          ArgList<Args...>,
+                          omp_parallel_collapse_dynamic<ChunkSize>,
+                          EnclosedStmts...>>
+    : OmpHyperplaneExecutor<omp_parallel_collapse_dynamic<ChunkSize>,
+                            HpArgumentId,
+                            ArgList<Args...>,
+                            EnclosedStmts...> {
+};
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_OPENMP guard
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,134 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the OpenMP statement::Reduce executor of
+ *          RAJA::kernel.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_openmp_kernel_Reduce_HPP
+#define RAJA_policy_openmp_kernel_Reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <omp.h>
+
+#include <vector>
+
+#include "RAJA/pattern/kernel/Reduce.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+namespace internal
+{
+
+/*!
+ * Per-thread partial values of a kernel reduction, one cache line apart.
+ *
+ * A thread of the team directly under the Reduce owns the slot of its
+ * thread number; threads of nested teams share one more value under a
+ * critical section.
+ */
+template <typename T, typename Op>
+struct OmpReducePartials {
+  static constexpr size_t pad = sizeof(T) >= 64 ? 1 : 64 / sizeof(T);
+
+  std::vector<T> slots;
+  T nested;
+  int level;
+
+  OmpReducePartials()
+      : slots(omp_get_max_threads() * pad, Op::identity()),
+        nested(Op::identity()),
+        level(omp_get_level())
+  {
+  }
+
+  void merge(T const &value)
+  {
+    const size_t tid = omp_get_thread_num();
+    if (omp_get_level() <= level + 1 && tid * pad < slots.size()) {
+      slots[tid * pad] = Op{}(slots[tid * pad], value);
+    } else {
+#pragma omp critical(RAJA_kernel_reduce)
+      nested = Op{}(nested, value);
+    }
+  }
+
+  //! the slots combined in thread order, then the nested value
+  T combine() const
+  {
+    T result = Op::identity();
+    for (size_t s = 0; s < slots.size(); s += pad) {
+      result = Op{}(result, slots[s]);
+    }
+    return Op{}(result, nested);
+  }
+};
+
+//
+// Executor that handles reductions for parallel loops run by OpenMP
+// inside the Reduce statement
+//
+template <template <typename...> class ReduceOperator,
+          typename ParamId,
+          typename... EnclosedStmts>
+struct OmpReduceExecutor {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
+    using data_t = camp::decay<Data>;
+    using value_t = camp::at_v<typename data_t::param_tuple_t::TList,
+                               ParamId::param_idx>;
+    using partials_t =
+        OmpReducePartials<value_t, ReduceOperator<value_t>>;
+
+    execute_cpu_reduce<partials_t,
+                       ReduceOperator,
+                       ParamId::param_idx,
+                       EnclosedStmts...>(data);
+  }
+};
+
+template <template <typename...> class ReduceOperator,
+          typename ParamId,
+          typename... EnclosedStmts>
+struct StatementExecutor<
+    statement::Reduce<omp_reduce, ReduceOperator, ParamId, EnclosedStmts...>>
+    : OmpReduceExecutor<ReduceOperator, ParamId, EnclosedStmts...> {
+};
+
+template <template <typename...> class ReduceOperator,
+          typename ParamId,
+          typename... EnclosedStmts>
+struct StatementExecutor<statement::Reduce<omp_reduce_ordered,
+                                           ReduceOperator,
+                                           ParamId,
+                                           EnclosedStmts...>>
+    : OmpReduceExecutor<ReduceOperator, ParamId, EnclosedStmts...> {
+};
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_OPENMP guard
+
+#endif  // closing endif for header file include guard
@@ -46,6 +46,13 @@ template <unsigned int ChunkSize>
 struct Static : std::integral_constant<unsigned int, ChunkSize> {
 };
 
+template <unsigned int ChunkSize>
+struct Dynamic : std::integral_constant<unsigned int, ChunkSize> {
+};
+
+struct Affinity {
+};
+
 
 //
 //////////////////////////////////////////////////////////////////////
@@ -84,6 +91,23 @@ struct omp_for_static : make_policy_pattern_launch_platform_t<Policy::openmp,
                                                               omp::Static<N>> {
 };
 
+///
+/// Static schedule over chunks of absolute index values: chunk c of
+/// ChunkSize indices always runs on thread c % num_threads, whatever the
+/// bounds of the range, so every loop touching an index runs it on the
+/// same thread. Over ranges starting at 0 the mapping is that of
+/// omp_for_static<ChunkSize>.
+///
+template <unsigned int ChunkSize>
+struct omp_for_affinity_static
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::For,
+                                            omp::Static<ChunkSize>,
+                                            omp::Affinity> {
+};
 
 template <typename InnerPolicy>
 struct omp_parallel_exec
@@ -102,6 +126,11 @@ template <unsigned int N>
 struct omp_parallel_for_static : omp_parallel_exec<omp_for_static<N>> {
 };
 
+template <unsigned int N>
+struct omp_parallel_for_affinity_static
+    : omp_parallel_exec<omp_for_affinity_static<N>> {
+};
+
 
 ///
 /// Index set segment iteration policies
@@ -134,6 +163,16 @@ struct omp_reduce_ordered
     : make_policy_pattern_t<Policy::openmp, Pattern::reduce, reduce::ordered> {
 };
 
+struct omp_reduce_padded
+    : make_policy_pattern_t<Policy::openmp, Pattern::reduce, reduce::padded> {
+};
+
+struct omp_reduce_deterministic
+    : make_policy_pattern_t<Policy::openmp,
+                            Pattern::reduce,
+                            reduce::deterministic> {
+};
+
 struct omp_synchronize : make_policy_pattern_launch_t<Policy::openmp,
                                                       Pattern::synchronize,
                                                       Launch::sync> {
@@ -142,17 +181,24 @@ struct omp_synchronize : make_policy_pattern_launch_t<Policy::openmp,
 }  // namespace omp
 }  // namespace policy
 
+using policy::omp::omp_for_affinity_static;
 using policy::omp::omp_for_exec;
 using policy::omp::omp_for_nowait_exec;
 using policy::omp::omp_for_static;
 using policy::omp::omp_parallel_exec;
+using policy::omp::omp_parallel_for_affinity_static;
 using policy::omp::omp_parallel_for_exec;
 using policy::omp::omp_parallel_for_segit;
+using policy::omp::omp_parallel_for_static;
 using policy::omp::omp_parallel_region;
 using policy::omp::omp_parallel_segit;
 using policy::omp::omp_reduce;
+using policy::omp::omp_reduce_deterministic;
 using policy::omp::omp_reduce_ordered;
+using policy::omp::omp_reduce_padded;
 using policy::omp::omp_synchronize;
+using policy::omp::omp_taskgraph_interval_segit;
+using policy::omp::omp_taskgraph_segit;
 
 
 
@@ -26,12 +26,16 @@
 #if defined(RAJA_ENABLE_OPENMP)
 
 #include <memory>
+#include <new>
 #include <vector>
 
 #include <omp.h>
 
+#include "RAJA/util/mutex.hpp"
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
 #include "RAJA/pattern/detail/reduce.hpp"
 #include "RAJA/pattern/reduce.hpp"
 
@@ -65,7 +69,9 @@ public:
 
 }  // namespace detail
 
-RAJA_DECLARE_ALL_REDUCERS(omp_reduce, detail::ReduceOMP)
+RAJA_DECLARE_REDUCER(Sum, omp_reduce, detail::ReduceOMP)
+RAJA_DECLARE_REDUCER(Min, omp_reduce, detail::ReduceOMP)
+RAJA_DECLARE_REDUCER(Max, omp_reduce, detail::ReduceOMP)
 
 ///////////////////////////////////////////////////////////////////////////////
 //
@@ -124,6 +130,176 @@ public:
 
 RAJA_DECLARE_ALL_REDUCERS(omp_reduce_ordered, detail::ReduceOMPOrdered)
 
+///////////////////////////////////////////////////////////////////////////////
+//
+// Padded per-thread reductions are included below.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+
+//! Alignment (bytes) of the per-thread slots; one slot per cache line
+constexpr size_t omp_reduce_slot_align = 64;
+
+template <typename T>
+struct RAJA_ALIGNED_ATTR(omp_reduce_slot_align) ReduceOMPSlot {
+  T value;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  OpenMP combiner that keeps one cache-line aligned slot per thread.
+ *
+ *         Thread-private copies merge into the slot owned by the calling
+ *         thread when they are destroyed, so no lock is taken at loop exit
+ *         and no two threads write to the same cache line. The slots are
+ *         combined pairwise (as a tree) when the value is requested.
+ *
+ *         Copies made on a thread that has no slot (more threads than at
+ *         construction, or a nested parallel region) fall back to a named
+ *         critical section.
+ *
+ ******************************************************************************
+ */
+template <typename T, typename Reduce>
+class ReduceOMPPadded
+    : public reduce::detail::
+          BaseCombinable<T, Reduce, ReduceOMPPadded<T, Reduce>>
+{
+  using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceOMPPadded>;
+  using Slot = ReduceOMPSlot<T>;
+
+  Slot* slots = nullptr;
+  int num_slots = 0;
+
+  const ReduceOMPPadded& root() const
+  {
+    return Base::parent ? *static_cast<const ReduceOMPPadded*>(Base::parent)
+                        : *this;
+  }
+
+  void merge(T const& val) const
+  {
+    int tid = omp_get_thread_num();
+    if (omp_get_level() <= 1 && tid < num_slots) {
+      Reduce{}(slots[tid].value, val);
+    } else {
+#pragma omp critical(ompReducePaddedCritical)
+      Reduce{}(Base::my_data, val);
+    }
+  }
+
+  void allocate_slots()
+  {
+    num_slots = omp_get_max_threads();
+    slots = RAJA::allocate_aligned_type<Slot>(omp_reduce_slot_align,
+                                              num_slots * sizeof(Slot));
+    for (int i = 0; i < num_slots; ++i) {
+      new (&slots[i]) Slot{Base::identity};
+    }
+  }
+
+  void free_slots()
+  {
+    if (slots) {
+      for (int i = 0; i < num_slots; ++i) {
+        slots[i].~Slot();
+      }
+      RAJA::free_aligned(slots);
+      slots = nullptr;
+      num_slots = 0;
+    }
+  }
+
+public:
+  //! prohibit compiler-generated default ctor
+  ReduceOMPPadded() = delete;
+
+  //! constructor requires a default value for the reducer
+  ReduceOMPPadded(T init_val, T identity_) : Base(init_val, identity_)
+  {
+    allocate_slots();
+  }
+
+  //! copies share the slots of the root reducer
+  ReduceOMPPadded(const ReduceOMPPadded& other) : Base(other) {}
+
+  void reset(T init_val, T identity_)
+  {
+    Base::reset(init_val, identity_);
+    if (Base::parent) return;
+    for (int i = 0; i < num_slots; ++i) {
+      slots[i].value = identity_;
+    }
+  }
+
+  ~ReduceOMPPadded()
+  {
+    if (Base::parent) {
+      root().merge(Base::my_data);
+      Base::my_data = Base::identity;
+    } else {
+      free_slots();
+    }
+  }
+
+  T get_combined() const
+  {
+    if (Base::parent) {
+      return root().get_combined();
+    }
+    for (int stride = 1; stride < num_slots; stride *= 2) {
+      for (int i = 0; i + stride < num_slots; i += 2 * stride) {
+        Reduce{}(slots[i].value, slots[i + stride].value);
+        slots[i + stride].value = Base::identity;
+      }
+    }
+    if (num_slots > 0) {
+      Reduce{}(Base::my_data, slots[0].value);
+      slots[0].value = Base::identity;
+    }
+    return Base::my_data;
+  }
+};
+
+}  // namespace detail
+
+RAJA_DECLARE_ALL_REDUCERS(omp_reduce_padded, detail::ReduceOMPPadded)
+
+// Loc reductions under omp_reduce merge into per-thread slots, folded as a
+// tree, rather than serializing every thread through a critical section.
+RAJA_DECLARE_INDEX_REDUCER(MinLoc, omp_reduce, detail::ReduceOMPPadded)
+RAJA_DECLARE_INDEX_REDUCER(MaxLoc, omp_reduce, detail::ReduceOMPPadded)
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Deterministic reductions are included below.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+template <typename T, typename Reduce>
+class ReduceOMPDeterministic
+    : public reduce::detail::
+          BaseDeterministicCombinable<T, Reduce, RAJA::omp::mutex>
+{
+  using Base = reduce::detail::
+      BaseDeterministicCombinable<T, Reduce, RAJA::omp::mutex>;
+
+public:
+  //! prohibit compiler-generated default ctor
+  ReduceOMPDeterministic() = delete;
+
+  using Base::Base;
+};
+}  // namespace detail
+
+RAJA_DECLARE_ALL_REDUCERS(omp_reduce_deterministic,
+                          detail::ReduceOMPDeterministic)
+
 }  // namespace RAJA
 
 #endif  // closing endif for RAJA_ENABLE_OPENMP guard
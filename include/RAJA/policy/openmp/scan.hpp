@@ -21,6 +21,7 @@
 #include "RAJA/config.hpp"
 
 #include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <iterator>
 #include <type_traits>
@@ -39,115 +40,244 @@ namespace scan
 {
 
 RAJA_INLINE
-int firstIndex(int n, int p, int pid)
+std::ptrdiff_t firstIndex(std::ptrdiff_t n, int p, int pid)
 {
-  return (static_cast<size_t>(n) * pid) / p;
+  return static_cast<std::ptrdiff_t>((static_cast<size_t>(n) * pid) / p);
 }
 
+namespace detail
+{
+
+//! number of elements scanned together by the vectorized local scans
+constexpr int scan_block = 8;
+
 /*!
-        \brief explicit inclusive inplace scan given range, function, and
+        \brief per-thread scratch for the partial sums of each thread; kept
+   between calls so that repeated scans do not allocate
+*/
+template <typename Value>
+RAJA_INLINE Value* scan_scratch(int size)
+{
+  static thread_local ::std::vector<Value> scratch;
+  if (scratch.size() < static_cast<size_t>(size)) {
+    scratch.resize(size);
+  }
+  return scratch.data();
+}
+
+/*!
+        \brief inclusive scan of one block of scan_block values held in t
+*/
+template <typename Value, typename BinFn>
+RAJA_INLINE void block_inclusive(Value (&t)[scan_block], BinFn f)
+{
+  for (int s = 1; s < scan_block; s *= 2) {
+    Value u[scan_block];
+    RAJA_SIMD
+    for (int j = 0; j < scan_block; ++j) {
+      u[j] = (j >= s) ? f(t[j - s], t[j]) : t[j];
+    }
+    RAJA_SIMD
+    for (int j = 0; j < scan_block; ++j) {
+      t[j] = u[j];
+    }
+  }
+}
+
+/*!
+        \brief inclusive scan of n values from in to out, starting from carry;
+   returns the last scanned value. in and out may be the same range.
+*/
+template <typename Iter, typename OutIter, typename BinFn, typename Value>
+RAJA_INLINE Value inclusive_local(Iter in,
+                                  std::ptrdiff_t n,
+                                  OutIter out,
+                                  BinFn f,
+                                  Value carry)
+{
+  std::ptrdiff_t i = 0;
+  for (; i + scan_block <= n; i += scan_block) {
+    Value t[scan_block];
+    RAJA_SIMD
+    for (int j = 0; j < scan_block; ++j) {
+      t[j] = in[i + j];
+    }
+    block_inclusive(t, f);
+    RAJA_SIMD
+    for (int j = 0; j < scan_block; ++j) {
+      out[i + j] = f(carry, t[j]);
+    }
+    carry = f(carry, t[scan_block - 1]);
+  }
+  for (; i < n; ++i) {
+    carry = f(carry, in[i]);
+    out[i] = carry;
+  }
+  return carry;
+}
+
+/*!
+        \brief exclusive scan of n values from in to out, starting from carry;
+   returns the combination of carry and all n values. in and out may be the
+   same range.
+*/
+template <typename Iter, typename OutIter, typename BinFn, typename Value>
+RAJA_INLINE Value exclusive_local(Iter in,
+                                  std::ptrdiff_t n,
+                                  OutIter out,
+                                  BinFn f,
+                                  Value carry)
+{
+  std::ptrdiff_t i = 0;
+  for (; i + scan_block <= n; i += scan_block) {
+    Value t[scan_block];
+    RAJA_SIMD
+    for (int j = 0; j < scan_block; ++j) {
+      t[j] = in[i + j];
+    }
+    block_inclusive(t, f);
+    out[i] = carry;
+    RAJA_SIMD
+    for (int j = 1; j < scan_block; ++j) {
+      out[i + j] = f(carry, t[j - 1]);
+    }
+    carry = f(carry, t[scan_block - 1]);
+  }
+  for (; i < n; ++i) {
+    Value t = in[i];
+    out[i] = carry;
+    carry = f(carry, t);
+  }
+  return carry;
+}
+
+/*!
+        \brief apply the offset of the preceding chunks to out[i0, i1)
+*/
+template <typename OutIter, typename BinFn, typename Value>
+RAJA_INLINE void fixup(OutIter out,
+                       std::ptrdiff_t i0,
+                       std::ptrdiff_t i1,
+                       BinFn f,
+                       Value offset)
+{
+  RAJA_SIMD
+  for (std::ptrdiff_t i = i0; i < i1; ++i) {
+    out[i] = f(offset, out[i]);
+  }
+}
+
+}  // namespace detail
+
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
    initial value
+
+   Each thread scans its chunk of the input directly into the output and
+   publishes the chunk total; after one barrier each thread combines the
+   totals of the preceding chunks and applies them to its own chunk. The
+   input is read once and no copy is made.
 */
-template <typename Policy, typename Iter, typename BinFn>
-concepts::enable_if<type_traits::is_openmp_policy<Policy>> inclusive_inplace(
+template <typename Policy, typename Iter, typename OutIter, typename BinFn>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> inclusive(
     const Policy&,
     Iter begin,
     Iter end,
+    OutIter out,
     BinFn f)
 {
   using Value = typename ::std::iterator_traits<Iter>::value_type;
-  const int n = end - begin;
-  const int p0 = std::min(n, omp_get_max_threads());
-  ::std::vector<Value> sums(p0, Value());
+  const std::ptrdiff_t n = end - begin;
+  if (n <= 0) return;
+  const int p0 = static_cast<int>(
+      std::min(n, static_cast<std::ptrdiff_t>(omp_get_max_threads())));
+  Value* sums = detail::scan_scratch<Value>(p0);
 #pragma omp parallel num_threads(p0)
   {
     const int p = omp_get_num_threads();
     const int pid = omp_get_thread_num();
-    const int i0 = firstIndex(n, p, pid);
-    const int i1 = firstIndex(n, p, pid + 1);
-    inclusive_inplace(::RAJA::seq_exec{}, begin + i0, begin + i1, f);
-    sums[pid] = *(begin + i1 - 1);
+    const std::ptrdiff_t i0 = firstIndex(n, p, pid);
+    const std::ptrdiff_t i1 = firstIndex(n, p, pid + 1);
+    sums[pid] = detail::inclusive_local(
+        begin + i0, i1 - i0, out + i0, f, Value(BinFn::identity()));
 #pragma omp barrier
-#pragma omp single
-    exclusive_inplace(
-        ::RAJA::seq_exec{}, sums.data(), sums.data() + p, f, BinFn::identity());
-    for (int i = i0; i < i1; ++i) {
-      *(begin + i) = f(*(begin + i), sums[pid]);
+    if (pid > 0) {
+      Value offset = sums[0];
+      for (int k = 1; k < pid; ++k) {
+        offset = f(offset, sums[k]);
+      }
+      detail::fixup(out, i0, i1, f, offset);
     }
   }
 }
 
 /*!
-        \brief explicit exclusive inplace scan given range, function, and
+        \brief explicit exclusive scan given input range, output, function, and
    initial value
 */
-template <typename Policy, typename Iter, typename BinFn, typename ValueT>
-concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive_inplace(
+template <typename Policy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename ValueT>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive(
     const Policy&,
     Iter begin,
     Iter end,
+    OutIter out,
     BinFn f,
     ValueT v)
 {
   using Value = typename ::std::iterator_traits<Iter>::value_type;
-  const int n = end - begin;
-  const int p0 = std::min(n, omp_get_max_threads());
-  ::std::vector<Value> sums(p0, v);
+  const std::ptrdiff_t n = end - begin;
+  if (n <= 0) return;
+  const int p0 = static_cast<int>(
+      std::min(n, static_cast<std::ptrdiff_t>(omp_get_max_threads())));
+  Value* sums = detail::scan_scratch<Value>(p0);
 #pragma omp parallel num_threads(p0)
   {
     const int p = omp_get_num_threads();
     const int pid = omp_get_thread_num();
-    const int i0 = firstIndex(n, p, pid);
-    const int i1 = firstIndex(n, p, pid + 1);
-    const Value init = ((pid == 0) ? v : *(begin + i0 - 1));
-#pragma omp barrier
-    exclusive_inplace(seq_exec{}, begin + i0, begin + i1, f, init);
-    sums[pid] = *(begin + i1 - 1);
+    const std::ptrdiff_t i0 = firstIndex(n, p, pid);
+    const std::ptrdiff_t i1 = firstIndex(n, p, pid + 1);
+    sums[pid] = detail::exclusive_local(
+        begin + i0, i1 - i0, out + i0, f, Value(BinFn::identity()));
 #pragma omp barrier
-#pragma omp single
-    exclusive_inplace(
-        seq_exec{}, sums.data(), sums.data() + p, f, BinFn::identity());
-    for (int i = i0; i < i1; ++i) {
-      *(begin + i) = f(*(begin + i), sums[pid]);
+    Value offset = v;
+    for (int k = 0; k < pid; ++k) {
+      offset = f(offset, sums[k]);
     }
+    detail::fixup(out, i0, i1, f, offset);
   }
 }
 
 /*!
-        \brief explicit inclusive scan given input range, output, function, and
+        \brief explicit inclusive inplace scan given range, function, and
    initial value
 */
-template <typename Policy, typename Iter, typename OutIter, typename BinFn>
-concepts::enable_if<type_traits::is_openmp_policy<Policy>> inclusive(
+template <typename Policy, typename Iter, typename BinFn>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> inclusive_inplace(
     const Policy& exec,
     Iter begin,
     Iter end,
-    OutIter out,
     BinFn f)
 {
-  ::std::copy(begin, end, out);
-  inclusive_inplace(exec, out, out + (end - begin), f);
+  inclusive(exec, begin, end, begin, f);
 }
 
 /*!
-        \brief explicit exclusive scan given input range, output, function, and
+        \brief explicit exclusive inplace scan given range, function, and
    initial value
 */
-template <typename Policy,
-          typename Iter,
-          typename OutIter,
-          typename BinFn,
-          typename ValueT>
-concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive(
+template <typename Policy, typename Iter, typename BinFn, typename ValueT>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive_inplace(
     const Policy& exec,
     Iter begin,
     Iter end,
-    OutIter out,
     BinFn f,
     ValueT v)
 {
-  ::std::copy(begin, end, out);
-  exclusive_inplace(exec, out, out + (end - begin), f, v);
+  exclusive(exec, begin, end, begin, f, v);
 }
 
 }  // namespace scan
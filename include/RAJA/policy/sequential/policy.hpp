@@ -68,11 +68,21 @@ struct seq_reduce : make_policy_pattern_launch_platform_t<Policy::sequential,
                                                           Launch::undefined,
                                                           Platform::host> {
 };
+
+//! bitwise reproducible reductions, matching the OpenMP and TBB variants
+struct seq_reduce_deterministic
+    : make_policy_pattern_launch_platform_t<Policy::sequential,
+                                            Pattern::reduce,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            reduce::deterministic> {
+};
 }  // namespace sequential
 }  // namespace policy
 
 using policy::sequential::seq_exec;
 using policy::sequential::seq_reduce;
+using policy::sequential::seq_reduce_deterministic;
 using policy::sequential::seq_region;
 using policy::sequential::seq_segit;
 
@@ -23,6 +23,8 @@
 
 #include "RAJA/config.hpp"
 
+#include <mutex>
+
 #include "RAJA/internal/MemUtils_CPU.hpp"
 
 #include "RAJA/pattern/detail/reduce.hpp"
@@ -55,6 +57,26 @@ public:
 
 RAJA_DECLARE_ALL_REDUCERS(seq_reduce, detail::ReduceSeq)
 
+namespace detail
+{
+template <typename T, typename Reduce>
+class ReduceSeqDeterministic
+    : public reduce::detail::BaseDeterministicCombinable<T, Reduce, std::mutex>
+{
+  using Base =
+      reduce::detail::BaseDeterministicCombinable<T, Reduce, std::mutex>;
+
+public:
+  //! prohibit compiler-generated default ctor
+  ReduceSeqDeterministic() = delete;
+
+  using Base::Base;
+};
+}  // namespace detail
+
+RAJA_DECLARE_ALL_REDUCERS(seq_reduce_deterministic,
+                          detail::ReduceSeqDeterministic)
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
@@ -0,0 +1,102 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sort declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_sequential_HPP
+#define RAJA_sort_sequential_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/pattern/detail/sort.hpp"
+
+#include "RAJA/policy/sequential/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+/*!
+        \brief explicit sort given range and comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+unstable(const ExecPolicy &, Iter begin, Iter end, Compare comp)
+{
+  std::sort(begin, end, comp);
+}
+
+/*!
+        \brief explicit stable sort given range and comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+stable(const ExecPolicy &, Iter begin, Iter end, Compare comp)
+{
+  std::stable_sort(begin, end, comp);
+}
+
+/*!
+        \brief explicit sort of keys and values given key range, value range,
+   and comparison function
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+unstable_pairs(const ExecPolicy &,
+               KeyIter keys_begin,
+               KeyIter keys_end,
+               ValIter vals_begin,
+               Compare comp)
+{
+  detail::serial_sort_pairs<false>(keys_begin, keys_end, vals_begin, comp);
+}
+
+/*!
+        \brief explicit stable sort of keys and values given key range, value
+   range, and comparison function
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+stable_pairs(const ExecPolicy &,
+             KeyIter keys_begin,
+             KeyIter keys_end,
+             ValIter vals_begin,
+             Compare comp)
+{
+  detail::serial_sort_pairs<true>(keys_begin, keys_end, vals_begin, comp);
+}
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
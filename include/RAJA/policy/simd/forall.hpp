@@ -31,10 +31,15 @@
 #include <iterator>
 #include <type_traits>
 
+#include "RAJA/util/VectorIndex.hpp"
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/index/RangeSegment.hpp"
+
 #include "RAJA/internal/fault_tolerance.hpp"
 
+#include "RAJA/pattern/reduce_params.hpp"
+
 #include "RAJA/policy/simd/policy.hpp"
 
 namespace RAJA
@@ -59,6 +64,65 @@ RAJA_INLINE void forall_impl(const simd_exec &,
   }
 }
 
+//! a loop given RAJA::reduce_params keeps one set of accumulators
+template <typename Iterable, typename ParamPack, typename Func>
+RAJA_INLINE void forall_param_impl(const simd_exec &p,
+                                   Iterable &&iter,
+                                   ParamPack const &params,
+                                   Func &&loop_body)
+{
+  RAJA::detail::forall_param_serial(p,
+                                    std::forward<Iterable>(iter),
+                                    params,
+                                    loop_body);
+}
+
+namespace detail
+{
+
+//! whether consecutive iterates of Iterable are consecutive indices
+template <typename Iterable>
+struct is_unit_stride : std::false_type {
+};
+
+template <typename StorageT, typename DiffT>
+struct is_unit_stride<TypedRangeSegment<StorageT, DiffT>> : std::true_type {
+};
+
+}  // namespace detail
+
+/*!
+ * Runs loop_body on runs of Width consecutive indices of a range segment,
+ * then once on the remaining indices with a partial run.  Other iterables
+ * have no such runs and are visited one index per call.
+ */
+template <typename Iterable, typename Func, camp::idx_t Width>
+RAJA_INLINE void forall_impl(const vector_exec<Width> &,
+                             Iterable &&iter,
+                             Func &&loop_body)
+{
+  auto begin = std::begin(iter);
+  auto end = std::end(iter);
+  auto distance = std::distance(begin, end);
+  using index_type = camp::decay<decltype(*begin)>;
+  using vector_index_type = vector_index<index_type, Width>;
+
+  if (!detail::is_unit_stride<camp::decay<Iterable>>::value) {
+    for (decltype(distance) i = 0; i < distance; ++i) {
+      loop_body(vector_index_type(*(begin + i), 1));
+    }
+    return;
+  }
+
+  decltype(distance) i = 0;
+  for (; i + Width <= distance; i += Width) {
+    loop_body(vector_index_type(*(begin + i), Width));
+  }
+  if (i < distance) {
+    loop_body(vector_index_type(*(begin + i), distance - i));
+  }
+}
+
 }  // namespace simd
 
 }  // namespace policy
@@ -44,11 +44,25 @@ struct simd_exec : make_policy_pattern_launch_platform_t<Policy::sequential,
                                                          Platform::host> {
 };
 
+///
+/// Runs the loop body on vector_index<IndexType, Width> runs of Width
+/// consecutive indices, with a shorter run for the remainder; Views
+/// indexed by them load and store whole registers.
+///
+template <camp::idx_t Width>
+struct vector_exec : make_policy_pattern_launch_platform_t<Policy::sequential,
+                                                           Pattern::forall,
+                                                           Launch::undefined,
+                                                           Platform::host> {
+  static_assert(Width > 0, "vector_exec needs a positive width");
+};
+
 }  // end of namespace simd
 
 }  // end of namespace policy
 
 using policy::simd::simd_exec;
+using policy::simd::vector_exec;
 
 }  // end of namespace RAJA
 
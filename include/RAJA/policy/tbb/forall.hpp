@@ -37,7 +37,9 @@
 
 #include "RAJA/internal/fault_tolerance.hpp"
 
+#include "RAJA/pattern/detail/forall.hpp"
 #include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/reduce_params.hpp"
 
 
 namespace RAJA
@@ -70,22 +72,25 @@ namespace tbb
  * using the dynamic loop scheduler and the grain size specified in the policy
  * argument.  This should be used for composable parallelism and increased work
  * stealing at the cost of initial start-up overhead for a top-level loop.
+ *
+ * The range is split over iteration offsets rather than iterators, so any
+ * random access iterable works, including the tile iterables used by
+ * RAJA::kernel.
  */
 template <typename Iterable, typename Func>
 RAJA_INLINE void forall_impl(const tbb_for_dynamic& p,
                              Iterable&& iter,
                              Func&& loop_body)
 {
-  using std::begin;
-  using std::end;
-  using brange = ::tbb::blocked_range<decltype(iter.begin())>;
-  ::tbb::parallel_for(brange(begin(iter), end(iter), p.grain_size),
+  RAJA_EXTRACT_BED_IT(iter);
+  using brange = ::tbb::blocked_range<decltype(distance_it)>;
+  ::tbb::parallel_for(brange(0, distance_it, p.grain_size),
                       [=](const brange& r) {
                         using RAJA::internal::thread_privatize;
                         auto privatizer = thread_privatize(loop_body);
                         auto body = privatizer.get_priv();
-                        for (const auto& i : r)
-                          body(i);
+                        for (auto i = r.begin(); i != r.end(); ++i)
+                          body(begin_it[i]);
                       });
 }
 
@@ -114,20 +119,94 @@ RAJA_INLINE void forall_impl(const tbb_for_static<ChunkSize>&,
                              Iterable&& iter,
                              Func&& loop_body)
 {
-  using std::begin;
-  using std::end;
-  using brange = ::tbb::blocked_range<decltype(iter.begin())>;
-  ::tbb::parallel_for(brange(begin(iter), end(iter), ChunkSize),
+  RAJA_EXTRACT_BED_IT(iter);
+  using brange = ::tbb::blocked_range<decltype(distance_it)>;
+  ::tbb::parallel_for(brange(0, distance_it, ChunkSize),
                       [=](const brange& r) {
                         using RAJA::internal::thread_privatize;
                         auto privatizer = thread_privatize(loop_body);
                         auto body = privatizer.get_priv();
-                        for (const auto& i : r)
-                          body(i);
+                        for (auto i = r.begin(); i != r.end(); ++i)
+                          body(begin_it[i]);
                       },
                       tbb_static_partitioner{});
 }
 
+namespace detail
+{
+
+/*!
+ * \brief TBB loop with RAJA::reduce_params
+ *
+ * Accumulators are kept per worker thread rather than per chunk: each chunk
+ * updates its thread's set directly, and every set is merged into the
+ * reducers once after the loop.
+ */
+template <typename Iterable,
+          typename ParamPack,
+          typename Func,
+          typename Partitioner>
+RAJA_INLINE void forall_param_tbb(Iterable&& iter,
+                                  ParamPack const& params,
+                                  Func&& loop_body,
+                                  size_t grain_size,
+                                  Partitioner&& partitioner)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+  using brange = ::tbb::blocked_range<decltype(distance_it)>;
+  using locals_type = typename ParamPack::locals_type;
+  ::tbb::enumerable_thread_specific<locals_type> thread_locals(
+      [&]() { return params.make_locals(); });
+  ::tbb::parallel_for(brange(0, distance_it, grain_size),
+                      [&](const brange& r) {
+                        using RAJA::internal::thread_privatize;
+                        auto privatizer = thread_privatize(loop_body);
+                        auto& body = privatizer.get_priv();
+                        // updated in place: a chunk stolen by this thread
+                        // while the body waits on a nested loop adds to
+                        // the same set, and nothing is written back over it
+                        auto param_body = RAJA::detail::make_param_body(
+                            body, thread_locals.local());
+                        for (auto i = r.begin(); i != r.end(); ++i)
+                          param_body(begin_it[i]);
+                      },
+                      partitioner);
+  for (auto const& locals : thread_locals) {
+    params.merge(locals);
+  }
+}
+
+}  // namespace detail
+
+template <typename Iterable, typename ParamPack, typename Func>
+RAJA_INLINE void forall_param_impl(const tbb_for_dynamic& p,
+                                   Iterable&& iter,
+                                   ParamPack const& params,
+                                   Func&& loop_body)
+{
+  detail::forall_param_tbb(std::forward<Iterable>(iter),
+                           params,
+                           loop_body,
+                           p.grain_size,
+                           ::tbb::auto_partitioner{});
+}
+
+template <typename Iterable,
+          typename ParamPack,
+          typename Func,
+          size_t ChunkSize>
+RAJA_INLINE void forall_param_impl(const tbb_for_static<ChunkSize>&,
+                                   Iterable&& iter,
+                                   ParamPack const& params,
+                                   Func&& loop_body)
+{
+  detail::forall_param_tbb(std::forward<Iterable>(iter),
+                           params,
+                           loop_body,
+                           ChunkSize,
+                           tbb_static_partitioner{});
+}
+
 }  // namespace tbb
 }  // namespace policy
 
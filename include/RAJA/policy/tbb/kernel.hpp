@@ -0,0 +1,26 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file for TBB collapse constructs.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#ifndef RAJA_policy_tbb_kernel_HPP
+#define RAJA_policy_tbb_kernel_HPP
+
+#include "RAJA/policy/tbb/kernel/Collapse.hpp"
+#include "RAJA/policy/tbb/kernel/Hyperplane.hpp"
+#include "RAJA/policy/tbb/kernel/Reduce.hpp"
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,230 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing TBB constructs used to run kernel
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_tbb_kernel_Collapse_HPP
+#define RAJA_policy_tbb_kernel_Collapse_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TBB)
+
+#include <cstddef>
+
+#include <tbb/blocked_range2d.h>
+#include <tbb/blocked_range3d.h>
+#include <tbb/tbb.h>
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+
+#include "RAJA/pattern/kernel/Collapse.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/tbb/policy.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * Collapse policy mapping 2 or 3 nested loops onto a tbb::blocked_range2d or
+ * tbb::blocked_range3d, split by the auto_partitioner.
+ *
+ * The range is bisected along its longest dimension, so the blocks handed to
+ * each task stay close to square whatever the loop extents, which keeps both
+ * the rows and the columns a task touches in cache.
+ */
+struct tbb_collapse_exec
+    : make_policy_pattern_launch_platform_t<Policy::tbb,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+/*!
+ * Collapse policy splitting the nest into fixed tiles, one tile per task.
+ *
+ * Tiles give the largest block size in each collapsed argument, in ArgList
+ * order, and are never split further (tbb::simple_partitioner).  Use this
+ * in place of a Tile nest when the tile sizes are tuned to a cache level.
+ */
+template <std::size_t... Tiles>
+struct tbb_tile_collapse_exec
+    : make_policy_pattern_launch_platform_t<Policy::tbb,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+namespace internal
+{
+
+//! blocked_range grain sizes and partitioner for a TBB collapse policy
+template <typename ExecPolicy, std::size_t N>
+struct TBBCollapseTraits;
+
+template <std::size_t N>
+struct TBBCollapseTraits<tbb_collapse_exec, N> {
+  using partitioner = ::tbb::auto_partitioner;
+
+  static constexpr std::size_t grain(std::size_t) { return 1; }
+};
+
+template <std::size_t... Tiles, std::size_t N>
+struct TBBCollapseTraits<tbb_tile_collapse_exec<Tiles...>, N> {
+  static_assert(sizeof...(Tiles) == N,
+                "tbb_tile_collapse_exec needs one tile size per argument");
+
+  using partitioner = ::tbb::simple_partitioner;
+
+  static std::size_t grain(std::size_t arg)
+  {
+    const std::size_t tiles[] = {Tiles...};
+    return tiles[arg] > 0 ? tiles[arg] : 1;
+  }
+};
+
+//! Collapse executor shared by the TBB collapse policies
+template <typename ExecPolicy, typename Args, typename... EnclosedStmts>
+struct TBBCollapseExecutor;
+
+/////////
+// Collapsing two loops
+/////////
+
+template <typename ExecPolicy,
+          camp::idx_t Arg0,
+          camp::idx_t Arg1,
+          typename... EnclosedStmts>
+struct TBBCollapseExecutor<ExecPolicy,
+                           ArgList<Arg0, Arg1>,
+                           EnclosedStmts...> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    using traits = TBBCollapseTraits<ExecPolicy, 2>;
+
+    const auto l0 = segment_length<Arg0>(data);
+    const auto l1 = segment_length<Arg1>(data);
+    using idx0_t = camp::decay<decltype(l0)>;
+    using idx1_t = camp::decay<decltype(l1)>;
+    using brange = ::tbb::blocked_range2d<idx0_t, idx1_t>;
+
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(data);
+    ::tbb::parallel_for(
+        brange(0, l0, traits::grain(0), 0, l1, traits::grain(1)),
+        [=](const brange& r) {
+          auto my_privatizer = privatizer;
+          auto& private_data = my_privatizer.get_priv();
+          for (auto i0 = r.rows().begin(); i0 != r.rows().end(); ++i0) {
+            private_data.template assign_offset<Arg0>(i0);
+            for (auto i1 = r.cols().begin(); i1 != r.cols().end(); ++i1) {
+              private_data.template assign_offset<Arg1>(i1);
+              execute_statement_list<camp::list<EnclosedStmts...>>(
+                  private_data);
+            }
+          }
+        },
+        typename traits::partitioner{});
+  }
+};
+
+
+/////////
+// Collapsing three loops
+/////////
+
+template <typename ExecPolicy,
+          camp::idx_t Arg0,
+          camp::idx_t Arg1,
+          camp::idx_t Arg2,
+          typename... EnclosedStmts>
+struct TBBCollapseExecutor<ExecPolicy,
+                           ArgList<Arg0, Arg1, Arg2>,
+                           EnclosedStmts...> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    using traits = TBBCollapseTraits<ExecPolicy, 3>;
+
+    const auto l0 = segment_length<Arg0>(data);
+    const auto l1 = segment_length<Arg1>(data);
+    const auto l2 = segment_length<Arg2>(data);
+    using idx0_t = camp::decay<decltype(l0)>;
+    using idx1_t = camp::decay<decltype(l1)>;
+    using idx2_t = camp::decay<decltype(l2)>;
+    using brange = ::tbb::blocked_range3d<idx0_t, idx1_t, idx2_t>;
+
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(data);
+    ::tbb::parallel_for(
+        brange(0,
+               l0,
+               traits::grain(0),
+               0,
+               l1,
+               traits::grain(1),
+               0,
+               l2,
+               traits::grain(2)),
+        [=](const brange& r) {
+          auto my_privatizer = privatizer;
+          auto& private_data = my_privatizer.get_priv();
+          for (auto i0 = r.pages().begin(); i0 != r.pages().end(); ++i0) {
+            private_data.template assign_offset<Arg0>(i0);
+            for (auto i1 = r.rows().begin(); i1 != r.rows().end(); ++i1) {
+              private_data.template assign_offset<Arg1>(i1);
+              for (auto i2 = r.cols().begin(); i2 != r.cols().end(); ++i2) {
+                private_data.template assign_offset<Arg2>(i2);
+                execute_statement_list<camp::list<EnclosedStmts...>>(
+                    private_data);
+              }
+            }
+          }
+        },
+        typename traits::partitioner{});
+  }
+};
+
+
+template <typename Args, typename... EnclosedStmts>
+struct StatementExecutor<
+    statement::Collapse<tbb_collapse_exec, Args, EnclosedStmts...>>
+    : TBBCollapseExecutor<tbb_collapse_exec, Args, EnclosedStmts...> {
+};
+
+template <std::size_t... Tiles, typename Args, typename... EnclosedStmts>
+struct StatementExecutor<statement::Collapse<tbb_tile_collapse_exec<Tiles...>,
+                                             Args,
+                                             EnclosedStmts...>>
+    : TBBCollapseExecutor<tbb_tile_collapse_exec<Tiles...>,
+                          Args,
+                          EnclosedStmts...> {
+};
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_TBB guard
+
+#endif  // closing endif for header file include guard
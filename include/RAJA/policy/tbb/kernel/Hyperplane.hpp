@@ -0,0 +1,141 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the TBB hyperplane executor of RAJA::kernel.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_tbb_kernel_Hyperplane_HPP
+#define RAJA_policy_tbb_kernel_Hyperplane_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TBB)
+
+#include <tbb/tbb.h>
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+
+#include "RAJA/pattern/kernel/Hyperplane.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/policy/tbb/kernel/Collapse.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+namespace internal
+{
+
+/*!
+ * Hyperplane executor for the TBB collapse policies.
+ *
+ * The hyperplanes run in order, whatever the HpExecPolicy. On each one the
+ * exact range of the first argument in Args is split into tasks by a
+ * tbb::parallel_for, with the grain size and partitioner of the collapse
+ * policy for that argument.
+ */
+template <typename ExecPolicy,
+          camp::idx_t HpArgumentId,
+          typename Args,
+          typename... EnclosedStmts>
+struct TBBHyperplaneExecutor;
+
+template <typename ExecPolicy,
+          camp::idx_t HpArgumentId,
+          camp::idx_t Arg,
+          camp::idx_t... Rest,
+          typename... EnclosedStmts>
+struct TBBHyperplaneExecutor<ExecPolicy,
+                             HpArgumentId,
+                             ArgList<Arg, Rest...>,
+                             EnclosedStmts...> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    using traits = TBBCollapseTraits<ExecPolicy, 1 + sizeof...(Rest)>;
+    using rows_stmt = HyperplaneRows<HpArgumentId,
+                                     Arg,
+                                     ArgList<Rest...>,
+                                     EnclosedStmts...>;
+    using brange = ::tbb::blocked_range<Index_type>;
+
+    const Index_type hp_len =
+        hyperplane_count<HpArgumentId>(data, ArgList<Arg, Rest...>{});
+    const Index_type rest =
+        hyperplane_rest<HpArgumentId>(data, ArgList<Rest...>{});
+    const Index_type len = segment_length<Arg>(data);
+
+    for (Index_type h = 0; h < hp_len; ++h) {
+      data.template assign_offset<HpArgumentId>(h);
+      Index_type begin, end;
+      hyperplane_range(h, rest, len, begin, end);
+
+      using RAJA::internal::thread_privatize;
+      auto privatizer = thread_privatize(data);
+      ::tbb::parallel_for(
+          brange(begin, end, traits::grain(0)),
+          [=](const brange& r) {
+            auto my_privatizer = privatizer;
+            auto& private_data = my_privatizer.get_priv();
+            for (Index_type i = r.begin(); i != r.end(); ++i) {
+              private_data.template assign_offset<Arg>(i);
+              execute_statement_list<StatementList<rows_stmt>>(private_data);
+            }
+          },
+          typename traits::partitioner{});
+    }
+  }
+};
+
+template <camp::idx_t HpArgumentId,
+          typename HpExecPolicy,
+          camp::idx_t... Args,
+          typename... EnclosedStmts>
+struct StatementExecutor<statement::Hyperplane<HpArgumentId,
+                                               HpExecPolicy,
+                                               ArgList<Args...>,
+                                               tbb_collapse_exec,
+                                               EnclosedStmts...>>
+    : TBBHyperplaneExecutor<tbb_collapse_exec,
+                            HpArgumentId,
+                            ArgList<Args...>,
+                            EnclosedStmts...> {
+};
+
+template <camp::idx_t HpArgumentId,
+          typename HpExecPolicy,
+          camp::idx_t... Args,
+          std::size_t... Tiles,
+          typename... EnclosedStmts>
+struct StatementExecutor<
+    statement::Hyperplane<HpArgumentId,
+                          HpExecPolicy,
+                          ArgList<Args...>,
+                          tbb_tile_collapse_exec<Tiles...>,
+                          EnclosedStmts...>>
+    : TBBHyperplaneExecutor<tbb_tile_collapse_exec<Tiles...>,
+                            HpArgumentId,
+                            ArgList<Args...>,
+                            EnclosedStmts...> {
+};
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_TBB guard
+
+#endif  // closing endif for header file include guard
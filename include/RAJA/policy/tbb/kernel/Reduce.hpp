@@ -0,0 +1,94 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the TBB statement::Reduce executor of
+ *          RAJA::kernel.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_tbb_kernel_Reduce_HPP
+#define RAJA_policy_tbb_kernel_Reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TBB)
+
+#include <tbb/enumerable_thread_specific.h>
+
+#include "RAJA/pattern/kernel/Reduce.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/policy/tbb/policy.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+namespace internal
+{
+
+//! per-thread partial values of a kernel reduction, in TBB thread storage
+template <typename T, typename Op>
+struct TBBReducePartials {
+  ::tbb::enumerable_thread_specific<T> locals;
+
+  TBBReducePartials() : locals(Op::identity()) {}
+
+  void merge(T const &value)
+  {
+    T &local = locals.local();
+    local = Op{}(local, value);
+  }
+
+  T combine() const
+  {
+    T result = Op::identity();
+    for (T const &local : locals) {
+      result = Op{}(result, local);
+    }
+    return result;
+  }
+};
+
+//
+// Executor that handles reductions for parallel loops run by TBB inside
+// the Reduce statement
+//
+template <template <typename...> class ReduceOperator,
+          typename ParamId,
+          typename... EnclosedStmts>
+struct StatementExecutor<
+    statement::Reduce<tbb_reduce, ReduceOperator, ParamId, EnclosedStmts...>> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
+    using data_t = camp::decay<Data>;
+    using value_t = camp::at_v<typename data_t::param_tuple_t::TList,
+                               ParamId::param_idx>;
+    using partials_t =
+        TBBReducePartials<value_t, ReduceOperator<value_t>>;
+
+    execute_cpu_reduce<partials_t,
+                       ReduceOperator,
+                       ParamId::param_idx,
+                       EnclosedStmts...>(data);
+  }
+};
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_TBB guard
+
+#endif  // closing endif for header file include guard
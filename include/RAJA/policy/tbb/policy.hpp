@@ -37,6 +37,12 @@ namespace tbb
 //////////////////////////////////////////////////////////////////////
 //
 
+struct tbb_region : make_policy_pattern_launch_platform_t<Policy::tbb,
+                                                          Pattern::region,
+                                                          Launch::undefined,
+                                                          Platform::host> {
+};
+
 ///
 /// Segment execution policies
 ///
@@ -79,6 +85,19 @@ struct tbb_reduce : make_policy_pattern_launch_platform_t<Policy::tbb,
                                                           Platform::host> {
 };
 
+struct tbb_reduce_deterministic
+    : make_policy_pattern_launch_platform_t<Policy::tbb,
+                                            Pattern::reduce,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            reduce::deterministic> {
+};
+
+struct tbb_synchronize : make_policy_pattern_launch_t<Policy::tbb,
+                                                      Pattern::synchronize,
+                                                      Launch::sync> {
+};
+
 }  // namespace tbb
 }  // namespace policy
 
@@ -86,7 +105,10 @@ using policy::tbb::tbb_for_dynamic;
 using policy::tbb::tbb_for_exec;
 using policy::tbb::tbb_for_static;
 using policy::tbb::tbb_reduce;
+using policy::tbb::tbb_reduce_deterministic;
+using policy::tbb::tbb_region;
 using policy::tbb::tbb_segit;
+using policy::tbb::tbb_synchronize;
 
 }  // namespace RAJA
 
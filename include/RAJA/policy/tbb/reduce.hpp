@@ -86,6 +86,27 @@ public:
 
 RAJA_DECLARE_ALL_REDUCERS(tbb_reduce, detail::ReduceTBB)
 
+namespace detail
+{
+template <typename T, typename Reduce>
+class ReduceTBBDeterministic
+    : public reduce::detail::
+          BaseDeterministicCombinable<T, Reduce, tbb::spin_mutex>
+{
+  using Base =
+      reduce::detail::BaseDeterministicCombinable<T, Reduce, tbb::spin_mutex>;
+
+public:
+  //! prohibit compiler-generated default ctor
+  ReduceTBBDeterministic() = delete;
+
+  using Base::Base;
+};
+}  // namespace detail
+
+RAJA_DECLARE_ALL_REDUCERS(tbb_reduce_deterministic,
+                          detail::ReduceTBBDeterministic)
+
 }  // namespace RAJA
 
 #endif  // closing endif for RAJA_ENABLE_TBB guard
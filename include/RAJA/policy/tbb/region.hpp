@@ -0,0 +1,64 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_region_tbb_HPP
+#define RAJA_region_tbb_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TBB)
+
+#include <tbb/tbb.h>
+
+#include "RAJA/policy/tbb/policy.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace tbb
+{
+
+/*!
+ * \brief RAJA::region implementation for TBB.
+ *
+ * Runs the body once on the calling thread inside an isolated task region.
+ * Loops launched in the body with TBB policies run in parallel, and a thread
+ * waiting on them only takes tasks spawned within the region, so the region
+ * cannot pick up unrelated work from an enclosing task-based application.
+ *
+ * \code
+ *
+ * RAJA::region<tbb_region>([=](){
+ *
+ *  // region body - may contain multiple loops
+ *
+ *  });
+ *
+ * \endcode
+ *
+ */
+
+template <typename Func>
+RAJA_INLINE void region_impl(const tbb_region &, Func &&body)
+{
+#if TBB_VERSION_MAJOR >= 2018
+  ::tbb::this_task_arena::isolate([&] { body(); });
+#else
+  body();
+#endif
+}
+
+}  // namespace tbb
+
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_TBB)
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,137 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sort declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_tbb_HPP
+#define RAJA_sort_tbb_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+
+#include <tbb/tbb.h>
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/pattern/detail/sort.hpp"
+
+#include "RAJA/policy/tbb/policy.hpp"
+#include "RAJA/policy/tbb/scan.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+
+namespace detail
+{
+
+/*!
+        \brief runs the sort tasks with tbb::parallel_for and the radix
+   offsets through the TBB scan
+*/
+struct tbb_sort_exec {
+  int max_tasks() const { return tbb::this_task_arena::max_concurrency(); }
+
+  template <typename Func>
+  void for_each_task(int ntasks, Func const& f) const
+  {
+    tbb::parallel_for(0, ntasks, [&](int t) { f(t); });
+  }
+
+  template <typename Iter>
+  void exclusive_scan(Iter begin, Iter end) const
+  {
+    using Value = typename std::iterator_traits<Iter>::value_type;
+    ::RAJA::impl::scan::exclusive_inplace(
+        tbb_for_exec{}, begin, end, operators::plus<Value>{}, Value(0));
+  }
+};
+
+}  // namespace detail
+
+/*!
+        \brief explicit sort given range and comparison function
+
+   Integral keys ordered by less or greater use a parallel LSD radix sort,
+   everything else a parallel merge sort.
+*/
+template <typename Policy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_tbb_policy<Policy>> unstable(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  detail::parallel_sort<false>(detail::tbb_sort_exec{}, begin, end, comp);
+}
+
+/*!
+        \brief explicit stable sort given range and comparison function
+*/
+template <typename Policy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_tbb_policy<Policy>> stable(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  detail::parallel_sort<true>(detail::tbb_sort_exec{}, begin, end, comp);
+}
+
+/*!
+        \brief explicit sort of keys and values given key range, value range,
+   and comparison function
+*/
+template <typename Policy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if<type_traits::is_tbb_policy<Policy>> unstable_pairs(
+    const Policy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  detail::parallel_sort_pairs<false>(
+      detail::tbb_sort_exec{}, keys_begin, keys_end, vals_begin, comp);
+}
+
+/*!
+        \brief explicit stable sort of keys and values given key range, value
+   range, and comparison function
+*/
+template <typename Policy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if<type_traits::is_tbb_policy<Policy>> stable_pairs(
+    const Policy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  detail::parallel_sort_pairs<true>(
+      detail::tbb_sort_exec{}, keys_begin, keys_end, vals_begin, comp);
+}
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,53 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for TBB synchronization.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_synchronize_tbb_HPP
+#define RAJA_synchronize_tbb_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TBB)
+
+#include "RAJA/policy/tbb/policy.hpp"
+
+namespace RAJA
+{
+
+namespace policy
+{
+
+namespace tbb
+{
+
+/*!
+ * \brief Synchronize all TBB executions.
+ *
+ * Every TBB forall and kernel returns only once all of its tasks have
+ * finished, so there is no outstanding work to wait for.  Provided so code
+ * written against RAJA::synchronize is portable to the TBB back end.
+ */
+RAJA_INLINE
+void synchronize_impl(const tbb_synchronize&) {}
+
+
+}  // end of namespace tbb
+}  // namespace policy
+}  // end of namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_TBB)
+
+#endif  // RAJA_synchronize_tbb_HPP
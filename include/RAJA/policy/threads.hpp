@@ -0,0 +1,36 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA headers for the thread pool
+ *          execution policies.
+ *
+ *          These methods work on platforms that support C++11 threads.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_threads_HPP
+#define RAJA_threads_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include "RAJA/policy/threads/forall.hpp"
+#include "RAJA/policy/threads/policy.hpp"
+#include "RAJA/policy/threads/reduce.hpp"
+#include "RAJA/policy/threads/region.hpp"
+#include "RAJA/policy/threads/thread_pool.hpp"
+
+#endif
+
+#endif  // closing endif for header file include guard
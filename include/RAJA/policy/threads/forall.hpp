@@ -0,0 +1,210 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA index set and segment iteration
+ *          template methods for the thread pool policies.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_threads_HPP
+#define RAJA_forall_threads_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include <algorithm>
+#include <atomic>
+
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/threads/policy.hpp"
+#include "RAJA/policy/threads/thread_pool.hpp"
+
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/internal/fault_tolerance.hpp"
+
+#include "RAJA/pattern/detail/forall.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/reduce_params.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace threads
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Run task(thread, nthreads, next) for one loop.
+ *
+ * Outside a threads_region the loop is handed to the pool; inside one it
+ * is shared out between the region's threads, which meet at a barrier
+ * when it is done. next is a counter shared by all threads of the loop,
+ * starting at zero, for dynamic scheduling.
+ */
+template <typename Task>
+RAJA_INLINE void launch(Task&& task)
+{
+  thread_pool::thread_state& me = thread_pool::this_thread();
+  if (me.region != nullptr && !me.in_loop) {
+    thread_pool::region_state& region = *me.region;
+    const unsigned k = me.region_loops++;
+    me.in_loop = true;
+    task(me.id, me.team, region.counter(k));
+    me.in_loop = false;
+    region.barrier(me.team, &region.counter(k + 1));
+    return;
+  }
+  std::atomic<Index_type> next{0};
+  thread_pool::get().run([&](int id, int nthreads) { task(id, nthreads, next); });
+}
+
+//! the contiguous block of [0, len) given to thread id of nthreads
+template <typename Len>
+RAJA_INLINE void static_block(int id, int nthreads, Len len, Len& b, Len& e)
+{
+  const Len chunk = len / nthreads;
+  const Len rem = len % nthreads;
+  b = id * chunk + std::min<Len>(id, rem);
+  e = b + chunk + (id < rem ? 1 : 0);
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Thread pool static for implementation
+ *
+ * Each pool thread runs one contiguous block of the iterations.
+ */
+template <typename Iterable, typename Func>
+RAJA_INLINE void forall_impl(const threads_for_exec&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+  using len_t = decltype(distance_it);
+  detail::launch([&](int id, int nthreads, std::atomic<Index_type>&) {
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(loop_body);
+    auto& body = privatizer.get_priv();
+    len_t b, e;
+    detail::static_block(id, nthreads, distance_it, b, e);
+    for (len_t i = b; i < e; ++i) {
+      body(begin_it[i]);
+    }
+  });
+}
+
+/*!
+ * \brief Thread pool dynamic for implementation
+ *
+ * Pool threads take ChunkSize iterations at a time until none are left.
+ */
+template <typename Iterable, typename Func, std::size_t ChunkSize>
+RAJA_INLINE void forall_impl(const threads_for_dynamic<ChunkSize>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+  using len_t = decltype(distance_it);
+  const Index_type len = static_cast<Index_type>(distance_it);
+  const Index_type chunk = ChunkSize > 0 ? ChunkSize : 1;
+  detail::launch([&](int, int, std::atomic<Index_type>& next) {
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(loop_body);
+    auto& body = privatizer.get_priv();
+    for (;;) {
+      const Index_type b = next.fetch_add(chunk, std::memory_order_relaxed);
+      if (b >= len) break;
+      const Index_type e = std::min(b + chunk, len);
+      for (Index_type i = b; i < e; ++i) {
+        body(begin_it[static_cast<len_t>(i)]);
+      }
+    }
+  });
+}
+
+/*!
+ * \brief Thread pool loops with RAJA::reduce_params
+ *
+ * Each pool thread runs its share with its own accumulators and merges
+ * them once at the end.
+ */
+template <typename Iterable, typename ParamPack, typename Func>
+RAJA_INLINE void forall_param_impl(const threads_for_exec&,
+                                   Iterable&& iter,
+                                   ParamPack const& params,
+                                   Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+  using len_t = decltype(distance_it);
+  detail::launch([&](int id, int nthreads, std::atomic<Index_type>&) {
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(loop_body);
+    auto& body = privatizer.get_priv();
+    auto locals = params.make_locals();
+    auto param_body = RAJA::detail::make_param_body(body, locals);
+    len_t b, e;
+    detail::static_block(id, nthreads, distance_it, b, e);
+    for (len_t i = b; i < e; ++i) {
+      param_body(begin_it[i]);
+    }
+    params.merge(locals);
+  });
+}
+
+template <typename Iterable,
+          typename ParamPack,
+          typename Func,
+          std::size_t ChunkSize>
+RAJA_INLINE void forall_param_impl(const threads_for_dynamic<ChunkSize>&,
+                                   Iterable&& iter,
+                                   ParamPack const& params,
+                                   Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+  using len_t = decltype(distance_it);
+  const Index_type len = static_cast<Index_type>(distance_it);
+  const Index_type chunk = ChunkSize > 0 ? ChunkSize : 1;
+  detail::launch([&](int, int, std::atomic<Index_type>& next) {
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(loop_body);
+    auto& body = privatizer.get_priv();
+    auto locals = params.make_locals();
+    auto param_body = RAJA::detail::make_param_body(body, locals);
+    for (;;) {
+      const Index_type b = next.fetch_add(chunk, std::memory_order_relaxed);
+      if (b >= len) break;
+      const Index_type e = std::min(b + chunk, len);
+      for (Index_type i = b; i < e; ++i) {
+        param_body(begin_it[static_cast<len_t>(i)]);
+      }
+    }
+    params.merge(locals);
+  });
+}
+
+}  // namespace threads
+}  // namespace policy
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREADS)
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,103 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA thread pool policy definitions.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef policy_threads_HPP
+#define policy_threads_HPP
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+#include <cstddef>
+
+namespace RAJA
+{
+namespace policy
+{
+namespace threads
+{
+
+//
+//////////////////////////////////////////////////////////////////////
+//
+// Execution policies
+//
+//////////////////////////////////////////////////////////////////////
+//
+
+/*!
+ * Region policy: the region body runs once on every thread of the pool,
+ * and threads_for_exec and threads_for_dynamic loops in it are shared out
+ * between those threads, each ending with a barrier.
+ */
+struct threads_region
+    : make_policy_pattern_launch_platform_t<Policy::threads,
+                                            Pattern::region,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+///
+/// Segment execution policies
+///
+
+//! one contiguous block of iterations per pool thread
+struct threads_for_exec
+    : make_policy_pattern_launch_platform_t<Policy::threads,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+//! pool threads take ChunkSize iterations at a time from a shared counter
+template <std::size_t ChunkSize = 1>
+struct threads_for_dynamic
+    : make_policy_pattern_launch_platform_t<Policy::threads,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+///
+/// Index set segment iteration policies
+///
+using threads_segit = threads_for_exec;
+
+///
+///////////////////////////////////////////////////////////////////////
+///
+/// Reduction execution policies
+///
+///////////////////////////////////////////////////////////////////////
+///
+struct threads_reduce
+    : make_policy_pattern_launch_platform_t<Policy::threads,
+                                            Pattern::reduce,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+}  // namespace threads
+}  // namespace policy
+
+using policy::threads::threads_for_dynamic;
+using policy::threads::threads_for_exec;
+using policy::threads::threads_reduce;
+using policy::threads::threads_region;
+using policy::threads::threads_segit;
+
+}  // namespace RAJA
+
+#endif
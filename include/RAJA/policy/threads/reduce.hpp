@@ -0,0 +1,83 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA reduction templates for the thread
+ *          pool policies.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_threads_reduce_HPP
+#define RAJA_threads_reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include <mutex>
+
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/reduce.hpp"
+
+#include "RAJA/policy/threads/policy.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! lock taken by thread-private reducer copies merging into their root
+inline std::mutex &threads_reduce_mutex()
+{
+  static std::mutex m;
+  return m;
+}
+
+/*!
+ * Each pool thread works on its own copy of the reducer, made when the
+ * loop body is privatized, and merges it into the root once when the copy
+ * is destroyed at the end of the thread's share of the loop.
+ */
+template <typename T, typename Reduce>
+class ReduceThreads
+    : public reduce::detail::
+          BaseCombinable<T, Reduce, ReduceThreads<T, Reduce>>
+{
+  using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceThreads>;
+
+public:
+  using Base::Base;
+  //! prohibit compiler-generated default ctor
+  ReduceThreads() = delete;
+
+  ~ReduceThreads()
+  {
+    if (Base::parent) {
+      std::lock_guard<std::mutex> lock(threads_reduce_mutex());
+      Reduce()(Base::parent->local(), Base::my_data);
+      Base::my_data = Base::identity;
+    }
+  }
+};
+
+}  // namespace detail
+
+RAJA_DECLARE_ALL_REDUCERS(threads_reduce, detail::ReduceThreads)
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_THREADS guard
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,83 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing the region construct for the thread
+ *          pool policies.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_region_threads_HPP
+#define RAJA_region_threads_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include "RAJA/policy/threads/policy.hpp"
+#include "RAJA/policy/threads/thread_pool.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace threads
+{
+
+/*!
+ * \brief RAJA::region implementation for the thread pool.
+ *
+ * Runs a copy of the body on every pool thread, like an OpenMP parallel
+ * region. Loops in the body with threads_for_exec or threads_for_dynamic
+ * are shared out between the threads and end with a barrier, so the
+ * threads stay in step from one loop to the next.
+ *
+ * \code
+ *
+ * RAJA::region<threads_region>([=](){
+ *
+ *  // region body - may contain multiple loops
+ *
+ *  });
+ *
+ * \endcode
+ *
+ */
+template <typename Func>
+RAJA_INLINE void region_impl(const threads_region &, Func &&body)
+{
+  // counters and barrier for this region's loops, shared by its team only
+  thread_pool::region_state region;
+  thread_pool::get().run([&](int id, int nthreads) {
+    thread_pool::thread_state &me = thread_pool::this_thread();
+    const thread_pool::thread_state saved = me;
+    me.id = id;
+    me.team = nthreads;
+    me.region = &region;
+    me.in_loop = false;
+    me.region_loops = 0;
+    // thread private copy of body
+    auto region_body = body;
+    region_body();
+    me = saved;
+  });
+}
+
+}  // namespace threads
+
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREADS)
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,315 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the persistent thread pool used by the
+ *          RAJA threads policies.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_threads_thread_pool_HPP
+#define RAJA_policy_threads_thread_pool_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Process-wide pool of worker threads for the threads policies.
+ *
+ *         The workers live for the whole program. Between loops they spin
+ *         on a generation counter for a short while and then sleep on a
+ *         condition variable, so back-to-back loops start without a system
+ *         call while an idle program does not keep the cores busy.
+ *
+ *         A loop is started by publishing the task and bumping the
+ *         generation counter (one atomic); its end is a single counter of
+ *         unfinished workers that the calling thread, which runs a share of
+ *         the loop itself, waits on.
+ *
+ *         The pool size is read from RAJA_NUM_THREADS, or is the number of
+ *         hardware threads, and may be changed with resize() between
+ *         loops.
+ *
+ ******************************************************************************
+ */
+class thread_pool
+{
+public:
+  /*!
+   * \brief Loop counters and barrier of one running threads_region.
+   *
+   * Each region has its own, shared by the threads of its team only, so
+   * regions run by different host threads, or nested in one another, do
+   * not see each other's loops.
+   */
+  struct region_state {
+    alignas(64) std::atomic<Index_type> counters[2];
+    alignas(64) std::atomic<int> barrier_count{0};
+    alignas(64) std::atomic<unsigned> barrier_phase{0};
+
+    region_state()
+    {
+      counters[0].store(0, std::memory_order_relaxed);
+      counters[1].store(0, std::memory_order_relaxed);
+    }
+
+    region_state(const region_state&) = delete;
+    region_state& operator=(const region_state&) = delete;
+
+    //! shared iteration counter of the k-th loop of the region
+    std::atomic<Index_type>& counter(unsigned k) { return counters[k & 1]; }
+
+    /*!
+     * \brief Wait until all nthreads threads of the region arrive.
+     *
+     * The last thread to arrive resets *counter first, if given, so that
+     * it can be reused by the threads after the barrier.
+     */
+    void barrier(int nthreads, std::atomic<Index_type>* counter = nullptr)
+    {
+      if (nthreads == 1) {
+        if (counter) counter->store(0, std::memory_order_relaxed);
+        return;
+      }
+      const unsigned phase = barrier_phase.load(std::memory_order_acquire);
+      if (barrier_count.fetch_add(1, std::memory_order_acq_rel) ==
+          nthreads - 1) {
+        if (counter) counter->store(0, std::memory_order_relaxed);
+        barrier_count.store(0, std::memory_order_relaxed);
+        barrier_phase.fetch_add(1, std::memory_order_release);
+      } else {
+        for (int spins = 0;
+             barrier_phase.load(std::memory_order_acquire) == phase;
+             ++spins) {
+          relax(spins);
+        }
+      }
+    }
+  };
+
+  //! per-thread view of the task being run
+  struct thread_state {
+    int id = 0;
+    int team = 1;
+    bool in_task = false;
+    bool in_loop = false;
+    //! the threads_region the thread is running, if any
+    region_state* region = nullptr;
+    unsigned region_loops = 0;
+  };
+
+  //! the process-wide pool, started on first use
+  static thread_pool& get()
+  {
+    static thread_pool pool(default_size());
+    return pool;
+  }
+
+  static thread_state& this_thread()
+  {
+    static thread_local thread_state state;
+    return state;
+  }
+
+  thread_pool(const thread_pool&) = delete;
+  thread_pool& operator=(const thread_pool&) = delete;
+
+  ~thread_pool() { stop_workers(); }
+
+  //! number of threads a loop runs on, the calling thread included
+  int size() const { return num_threads; }
+
+  //! restart the pool with nthreads threads; not while a loop is running
+  void resize(int nthreads)
+  {
+    std::lock_guard<std::mutex> guard(dispatch_mutex);
+    stop_workers();
+    start_workers(nthreads < 1 ? 1 : nthreads);
+  }
+
+  /*!
+   * \brief Run task(thread, nthreads) once on each pool thread.
+   *
+   * The calling thread runs thread 0 and returns when every thread is done.
+   * A call from inside a task, or while another thread is using the pool,
+   * runs task(0, 1) on the calling thread instead.
+   */
+  template <typename Task>
+  void run(Task&& task)
+  {
+    thread_state& me = this_thread();
+    if (me.in_task || num_threads == 1 || !dispatch_mutex.try_lock()) {
+      task(0, 1);
+      return;
+    }
+    std::lock_guard<std::mutex> guard(dispatch_mutex, std::adopt_lock);
+
+    using task_type = typename std::remove_reference<Task>::type;
+    task_fn = [](void* t, int id, int n) {
+      (*static_cast<task_type*>(t))(id, n);
+    };
+    task_arg = const_cast<void*>(static_cast<const void*>(&task));
+    pending.store(num_threads - 1, std::memory_order_relaxed);
+    generation.fetch_add(1, std::memory_order_seq_cst);
+    if (sleepers.load(std::memory_order_seq_cst) > 0) {
+      std::lock_guard<std::mutex> lock(sleep_mutex);
+      sleep_cv.notify_all();
+    }
+
+    const thread_state saved = me;
+    enter_task(me, 0);
+    task(0, num_threads);
+    me = saved;
+
+    for (int spins = 0; pending.load(std::memory_order_acquire) != 0;
+         ++spins) {
+      relax(spins);
+    }
+  }
+
+private:
+  //! waits spin this many times, then yield the core between checks
+  static constexpr int spin_limit = 1 << 8;
+  //! checks an idle worker makes before it sleeps
+  static constexpr int yield_limit = spin_limit + (1 << 12);
+
+  int num_threads = 1;
+  std::vector<std::thread> workers;
+
+  std::mutex dispatch_mutex;
+  void (*task_fn)(void*, int, int) = nullptr;
+  void* task_arg = nullptr;
+
+  alignas(64) std::atomic<unsigned> generation{0};
+  alignas(64) std::atomic<int> pending{0};
+  alignas(64) std::atomic<int> sleepers{0};
+  std::atomic<bool> stopping{false};
+
+  std::mutex sleep_mutex;
+  std::condition_variable sleep_cv;
+
+  explicit thread_pool(int nthreads) { start_workers(nthreads); }
+
+  static int default_size()
+  {
+    const char* env = std::getenv("RAJA_NUM_THREADS");
+    const int requested = env ? std::atoi(env) : 0;
+    if (requested > 0) return requested;
+    const unsigned hw = std::thread::hardware_concurrency();
+    return hw > 0 ? static_cast<int>(hw) : 1;
+  }
+
+  static void relax(int spins)
+  {
+    if (spins < spin_limit) {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+      _mm_pause();
+#endif
+    } else {
+      std::this_thread::yield();
+    }
+  }
+
+  void enter_task(thread_state& state, int id)
+  {
+    state.id = id;
+    state.team = num_threads;
+    state.in_task = true;
+    state.region = nullptr;
+    state.in_loop = false;
+    state.region_loops = 0;
+  }
+
+  void start_workers(int nthreads)
+  {
+    num_threads = nthreads;
+    const unsigned seen = generation.load();
+    for (int id = 1; id < nthreads; ++id) {
+      workers.emplace_back([this, id, seen]() { work(id, seen); });
+    }
+  }
+
+  void stop_workers()
+  {
+    stopping.store(true);
+    generation.fetch_add(1, std::memory_order_seq_cst);
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex);
+      sleep_cv.notify_all();
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+    workers.clear();
+    stopping.store(false);
+    num_threads = 1;
+  }
+
+  //! wait for the generation counter to move past seen
+  unsigned wait_for_work(unsigned seen)
+  {
+    for (int spins = 0; spins < yield_limit; ++spins) {
+      const unsigned gen = generation.load(std::memory_order_acquire);
+      if (gen != seen) return gen;
+      relax(spins);
+    }
+    std::unique_lock<std::mutex> lock(sleep_mutex);
+    sleepers.fetch_add(1, std::memory_order_seq_cst);
+    unsigned gen;
+    sleep_cv.wait(lock, [&]() {
+      gen = generation.load(std::memory_order_seq_cst);
+      return gen != seen;
+    });
+    sleepers.fetch_sub(1, std::memory_order_relaxed);
+    return gen;
+  }
+
+  void work(int id, unsigned seen)
+  {
+    thread_state& me = this_thread();
+    for (;;) {
+      seen = wait_for_work(seen);
+      if (stopping.load()) return;
+      enter_task(me, id);
+      task_fn(task_arg, id, num_threads);
+      me.in_task = false;
+      pending.fetch_sub(1, std::memory_order_release);
+    }
+  }
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREADS)
+
+#endif  // closing endif for header file include guard
@@ -29,6 +29,7 @@
 
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/util/Permutations.hpp"
+#include "RAJA/util/fast_divide.hpp"
 
 namespace RAJA
 {
@@ -195,7 +196,9 @@ public:
    * Given a linear-space index, compute the n-dimensional indices defined
    * by this layout.
    *
-   * Note that this operation requires 2n integer divide instructions
+   * Note that this operation requires 2n integer divide instructions; to
+   * convert many indices, build a LayoutDecoder once and use its
+   * toIndices instead.
    *
    * @param linear_index  Linear space index to be converted to indices.
    * @param indices  Variadic list of indices to be assigned, number must match
@@ -230,6 +233,48 @@ constexpr size_t
 template <camp::idx_t... RangeInts, typename IdxLin, ptrdiff_t StrideOneDim>
 constexpr size_t
     LayoutBase_impl<camp::idx_seq<RangeInts...>, IdxLin, StrideOneDim>::limit;
+
+template <typename Range, typename IdxLin = Index_type>
+struct LayoutDecoder_impl;
+
+template <camp::idx_t... RangeInts, typename IdxLin>
+struct LayoutDecoder_impl<camp::idx_seq<RangeInts...>, IdxLin> {
+  static constexpr size_t n_dims = sizeof...(RangeInts);
+
+  IdxLin inv_mods[n_dims];
+  fast_divider div_strides[n_dims];
+  fast_divider div_mods[n_dims];
+
+  template <typename LIdxLin, ptrdiff_t LStrideOneDim>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr explicit LayoutDecoder_impl(
+      const LayoutBase_impl<camp::idx_seq<RangeInts...>, LIdxLin, LStrideOneDim>
+          &layout)
+      : inv_mods{static_cast<IdxLin>(layout.inv_mods[RangeInts])...},
+        div_strides{fast_divider(layout.inv_strides[RangeInts])...},
+        div_mods{fast_divider(layout.inv_mods[RangeInts])...}
+  {
+  }
+
+  /*!
+   * Same as Layout::toIndices, for a linear index that is not negative.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                              Indices &&... indices) const
+  {
+    VarOps::ignore_args(
+        (indices = index_along(linear_index, RangeInts))...);
+  }
+
+private:
+  //! (linear_index / inv_strides[d]) % inv_mods[d]
+  RAJA_INLINE RAJA_HOST_DEVICE IdxLin index_along(IdxLin linear_index,
+                                                  camp::idx_t d) const
+  {
+    const IdxLin q = div_strides[d].divide(linear_index);
+    return q - div_mods[d].divide(q) * inv_mods[d];
+  }
+};
 }  // namespace detail
 
 /*!
@@ -285,6 +330,39 @@ template <size_t n_dims, typename IdxLin = Index_type, ptrdiff_t StrideOne = -1>
 using Layout =
     detail::LayoutBase_impl<camp::make_idx_seq_t<n_dims>, IdxLin, StrideOne>;
 
+/*!
+ * @brief Precomputed inverse of a Layout, for converting many linear indices
+ * back to n-dimensional indices.
+ *
+ * Layout::toIndices does 2n integer divisions. A LayoutDecoder turns each
+ * of them into a multiply and a shift (see detail::fast_divider), with
+ * multipliers worked out once when it is built, so it pays off when
+ * toIndices is called in a loop. It is kept apart from the Layout so that
+ * Layouts and Views, which are copied into every kernel, stay small:
+ *
+ *     Layout<3> layout(5,7,11);
+ *     auto decoder = make_layout_decoder(layout);
+ *
+ *     forall<seq_exec>(RangeSegment(0, layout.size()), [=](int lin) {
+ *       int i, j, k;
+ *       decoder.toIndices(lin, i, j, k);
+ *       ...
+ *     });
+ *
+ * The linear index must not be negative.
+ */
+template <size_t n_dims, typename IdxLin = Index_type>
+using LayoutDecoder =
+    detail::LayoutDecoder_impl<camp::make_idx_seq_t<n_dims>, IdxLin>;
+
+//! a LayoutDecoder for layout
+template <typename Range, typename IdxLin, ptrdiff_t StrideOne>
+RAJA_INLINE detail::LayoutDecoder_impl<Range, IdxLin> make_layout_decoder(
+    detail::LayoutBase_impl<Range, IdxLin, StrideOne> const &layout)
+{
+  return detail::LayoutDecoder_impl<Range, IdxLin>(layout);
+}
+
 template <typename IdxLin, typename DimTuple, ptrdiff_t StrideOne = -1>
 struct TypedLayout;
 
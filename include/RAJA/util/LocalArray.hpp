@@ -40,7 +40,7 @@ using ParamList = camp::idx_seq<Sizes...>;
  * to allocate a static array.
  *
  * Once intialized they can be treated as an N dimensional array
- * on the CPU stack, CUDA thread private memory,
+ * in CPU tile memory (see TileScratch), CUDA thread private memory,
  * or CUDA shared memory. Intialization occurs within
  * the RAJA::Kernel statement ``InitLocalArray"
  *
@@ -85,6 +85,31 @@ auto make_permuted_layout(std::array<IdxLin, Rank> sizes,
   return Layout<Rank, IdxLin>(sizes, strides);
 }
 
+/*!
+ * @brief Creates a permuted Layout whose stride-1 dimension is part of its
+ * type.
+ *
+ * The stride-1 dimension is the last one in Perm; fixing it at compile time
+ * lets indexing skip the multiply for it.
+ *
+ * For example:
+ *
+ *     // Same strides as make_permuted_layout({{5,7,11}}, PERM_KIJ::value),
+ *     // with type Layout<3, Index_type, 1>
+ *     auto layout = make_permuted_layout<PERM_KIJ>({{5,7,11}});
+ *
+ * The stride-1 dimension must not have size zero.
+ */
+template <typename Perm,
+          typename IdxLin = Index_type,
+          size_t Rank = camp::size<Perm>::value>
+auto make_permuted_layout(std::array<IdxLin, Rank> sizes)
+    -> Layout<Rank, IdxLin, camp::seq_at<Rank - 1, Perm>::value>
+{
+  return Layout<Rank, IdxLin, camp::seq_at<Rank - 1, Perm>::value>(
+      make_permuted_layout(sizes, as_array<Perm>::get()));
+}
+
 
 template <camp::idx_t... Ints>
 using Perm = camp::idx_seq<Ints...>;
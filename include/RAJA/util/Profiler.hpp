@@ -0,0 +1,549 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a hierarchical region profiler built on
+ *          RAJA::Timer.
+ *
+ *          Regions are named code sections that nest. The profiler keeps a
+ *          tree of regions per thread with call counts and total, min and max
+ *          times, can time every forall and kernel launch through the launch
+ *          hooks, and writes a flat or JSON report.
+ *
+ *          Setting RAJA_PROFILE=flat or RAJA_PROFILE=json in the environment
+ *          times all launches and writes the report at exit, to stderr or to
+ *          the file named by RAJA_PROFILE_OUTPUT.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_Profiler_HPP
+#define RAJA_util_Profiler_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "RAJA/util/Timer.hpp"
+#include "RAJA/util/launch_hooks.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/mutex.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! what a profile node times
+enum class profile_kind { region, forall, kernel };
+
+inline const char* profile_kind_name(profile_kind kind)
+{
+  return kind == profile_kind::forall
+             ? "forall"
+             : kind == profile_kind::kernel ? "kernel" : "region";
+}
+
+//! accumulated times of one region, in seconds
+struct profile_stats {
+  unsigned long long count = 0;
+  double total = 0.0;
+  double min = std::numeric_limits<double>::max();
+  double max = 0.0;
+
+  void add(double t)
+  {
+    ++count;
+    total += t;
+    min = std::min(min, t);
+    max = std::max(max, t);
+  }
+
+  void add(const profile_stats& o)
+  {
+    count += o.count;
+    total += o.total;
+    min = std::min(min, o.min);
+    max = std::max(max, o.max);
+  }
+};
+
+/*!
+ * Whether two launch policy signatures name the same policy. The begin and
+ * end hooks come from different instantiations, and each object file or
+ * shared library may hold its own copy of the string, so equal pointers
+ * are only the fast path.
+ */
+inline bool same_policy(const char* a, const char* b)
+{
+  return a == b || std::strcmp(a, b) == 0;
+}
+
+/*!
+ * A region in one thread's tree. key is the name pointer the node was
+ * first entered with. Launches are keyed by their policy signature, which
+ * has static storage, so repeat launches usually skip the string compare;
+ * region names may live in buffers that are reused, so they are compared
+ * by value.
+ */
+struct profile_node {
+  profile_kind kind;
+  const char* key;
+  std::string name;
+  profile_stats stats;
+  std::vector<std::unique_ptr<profile_node>> children;
+
+  profile_node(profile_kind kind_, const char* key_, std::string name_)
+      : kind(kind_), key(key_), name(std::move(name_))
+  {
+  }
+
+  profile_node* child(profile_kind k, const char* key_)
+  {
+    for (auto& c : children) {
+      if (c->kind != k) continue;
+      if (k == profile_kind::region ? c->name == key_
+                                 : same_policy(c->key, key_)) {
+        return c.get();
+      }
+    }
+    std::string n = (k == profile_kind::region)
+                        ? std::string(key_)
+                        : std::string(profile_kind_name(k)) + "<" +
+                              util::launch_policy_name(key_) + ">";
+    for (auto& c : children) {
+      if (c->kind == k && c->name == n) return c.get();
+    }
+    children.emplace_back(new profile_node(k, key_, std::move(n)));
+    return children.back().get();
+  }
+
+  void clear()
+  {
+    stats = profile_stats();
+    for (auto& c : children) {
+      c->clear();
+    }
+  }
+};
+
+struct profile_frame {
+  profile_node* node;
+  Timer timer;
+};
+
+//! the region tree and open regions of one thread
+struct profile_thread {
+  profile_node root{profile_kind::region, "", ""};
+  std::vector<profile_frame> stack;
+};
+
+//! a region merged over all threads, used for reports
+struct profile_merged {
+  profile_kind kind;
+  std::string name;
+  profile_stats stats;
+  int threads = 0;
+  std::vector<profile_merged> children;
+
+  double self() const
+  {
+    double t = stats.total;
+    for (auto& c : children) {
+      t -= c.stats.total;
+    }
+    return std::max(t, 0.0);
+  }
+
+  //! true if n or a region nested in it has been entered
+  static bool called(const profile_node& n)
+  {
+    if (n.stats.count > 0) return true;
+    for (auto& c : n.children) {
+      if (called(*c)) return true;
+    }
+    return false;
+  }
+
+  void merge(const profile_node& n)
+  {
+    for (auto& c : n.children) {
+      if (!called(*c)) continue;
+      auto it = std::find_if(children.begin(),
+                             children.end(),
+                             [&](const profile_merged& m) {
+                               return m.kind == c->kind && m.name == c->name;
+                             });
+      if (it == children.end()) {
+        children.emplace_back();
+        it = children.end() - 1;
+        it->kind = c->kind;
+        it->name = c->name;
+      }
+      it->stats.add(c->stats);
+      if (c->stats.count > 0) ++it->threads;
+      it->merge(*c);
+    }
+  }
+};
+
+inline std::string json_escape(const std::string& s)
+{
+  std::string out;
+  for (char c : s) {
+    if (c == '"' || c == '\\') {
+      out += '\\';
+      out += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char buf[8];
+      std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+      out += buf;
+    } else {
+      out += c;
+    }
+  }
+  return out;
+}
+
+}  // namespace detail
+
+/*! \class Profiler
+ ******************************************************************************
+ *
+ * \brief  Profiler keeps a tree of named regions with call counts and
+ * total, min and max times
+ *
+ * Each thread records into its own tree, so entering and leaving a region
+ * takes no lock; the report merges the trees by region path and shows how
+ * many threads ran each region. Regions must nest properly on each thread.
+ *
+ * report() and reset() read and write every thread's tree, so call them
+ * when no other thread is inside a region.
+ *
+ ******************************************************************************
+ */
+class Profiler
+{
+public:
+  enum class format { flat, json };
+
+  static Profiler& getInstance()
+  {
+    static Profiler p;
+    return p;
+  }
+
+  Profiler(const Profiler&) = delete;
+  Profiler& operator=(const Profiler&) = delete;
+
+  //! enter the region name, nested in the current region of this thread
+  void begin(const char* name) { enter(detail::profile_kind::region, name); }
+
+  //! leave the region name, which must be the current region of this thread
+  void end(const char* name)
+  {
+    detail::profile_thread& t = this_thread();
+    if (t.stack.empty() ||
+        t.stack.back().node->kind != detail::profile_kind::region ||
+        t.stack.back().node->name != name) {
+      RAJA_ABORT_OR_THROW("RAJA::Profiler::end: region is not the innermost "
+                          "open region");
+    }
+    leave(t);
+  }
+
+  //! time every forall and kernel launch as a region named for its policy
+  void time_launches(bool on)
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+    if (on && m_hooks < 0) {
+      m_hooks = util::add_launch_hooks(&launch_begin, &launch_end, this);
+    } else if (!on && m_hooks >= 0) {
+      util::remove_launch_hooks(m_hooks);
+      m_hooks = -1;
+    }
+  }
+
+  bool timing_launches() const { return m_hooks >= 0; }
+
+  //! zero all counts and times, keeping the open regions open
+  void reset()
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+    for (auto& t : m_threads) {
+      t->root.clear();
+    }
+  }
+
+  //! write the regions merged over all threads
+  void report(std::ostream& os, format fmt = format::flat)
+  {
+    detail::profile_merged root;
+    {
+#if defined(RAJA_ENABLE_OPENMP)
+      lock_guard<omp::mutex> lock(m_mutex);
+#endif
+      for (auto& t : m_threads) {
+        root.merge(t->root);
+      }
+    }
+
+    if (fmt == format::json) {
+      os << "{\"regions\": ";
+      write_json(os, root.children);
+      os << "}\n";
+    } else {
+      write_flat(os, root);
+    }
+  }
+
+  //! write the report to path, or to stderr if path is null or empty
+  void report(const char* path, format fmt)
+  {
+    if (path == nullptr || *path == '\0') {
+      report(std::cerr, fmt);
+      return;
+    }
+    std::ofstream out(path);
+    if (!out) {
+      std::cerr << "RAJA::Profiler: cannot open " << path << std::endl;
+      report(std::cerr, fmt);
+      return;
+    }
+    report(out, fmt);
+  }
+
+  //! write the report when the program exits
+  void report_at_exit(format fmt, const char* path = nullptr)
+  {
+    m_exit_format = fmt;
+    m_exit_path = (path != nullptr) ? path : "";
+    if (!m_exit_registered) {
+      m_exit_registered = true;
+      std::atexit(&exit_report);
+    }
+  }
+
+  /*!
+   * Apply RAJA_PROFILE=flat|json and RAJA_PROFILE_OUTPUT=<file> from the
+   * environment; runs once, from the first translation unit that includes
+   * this header.
+   */
+  static bool configure_from_environment()
+  {
+    static const bool configured = []() {
+      const char* mode = std::getenv("RAJA_PROFILE");
+      if (mode == nullptr || *mode == '\0') return false;
+      format fmt = format::flat;
+      if (std::strcmp(mode, "json") == 0) {
+        fmt = format::json;
+      } else if (std::strcmp(mode, "flat") != 0) {
+        std::cerr << "RAJA::Profiler: unknown RAJA_PROFILE=" << mode
+                  << ", using flat" << std::endl;
+      }
+      Profiler& p = getInstance();
+      p.time_launches(true);
+      p.report_at_exit(fmt, std::getenv("RAJA_PROFILE_OUTPUT"));
+      return true;
+    }();
+    return configured;
+  }
+
+private:
+  Profiler() = default;
+
+  detail::profile_thread& this_thread()
+  {
+    static thread_local detail::profile_thread* t = nullptr;
+    if (t == nullptr) {
+#if defined(RAJA_ENABLE_OPENMP)
+      lock_guard<omp::mutex> lock(m_mutex);
+#endif
+      m_threads.emplace_back(new detail::profile_thread);
+      t = m_threads.back().get();
+    }
+    return *t;
+  }
+
+  void enter(detail::profile_kind kind, const char* key)
+  {
+    detail::profile_thread& t = this_thread();
+    detail::profile_node* parent =
+        t.stack.empty() ? &t.root : t.stack.back().node;
+    t.stack.emplace_back();
+    t.stack.back().node = parent->child(kind, key);
+    t.stack.back().timer.start();
+  }
+
+  void leave(detail::profile_thread& t)
+  {
+    detail::profile_frame& f = t.stack.back();
+    f.timer.stop();
+    f.node->stats.add(f.timer.elapsed());
+    t.stack.pop_back();
+  }
+
+  static void launch_begin(const util::launch_info& info, void* self)
+  {
+    static_cast<Profiler*>(self)->enter(info.kind == util::launch_kind::forall
+                                            ? detail::profile_kind::forall
+                                            : detail::profile_kind::kernel,
+                                        info.policy);
+  }
+
+  static void launch_end(const util::launch_info& info, void* self)
+  {
+    detail::profile_thread& t = static_cast<Profiler*>(self)->this_thread();
+    // a launch begun before the hooks were added has no frame
+    if (!t.stack.empty() &&
+        t.stack.back().node->kind != detail::profile_kind::region &&
+        detail::same_policy(t.stack.back().node->key, info.policy)) {
+      static_cast<Profiler*>(self)->leave(t);
+    }
+  }
+
+  static void exit_report()
+  {
+    Profiler& p = getInstance();
+    p.report(p.m_exit_path.c_str(), p.m_exit_format);
+  }
+
+  static void collect_flat(
+      const detail::profile_merged& n,
+      const std::string& prefix,
+      std::vector<std::pair<std::string, const detail::profile_merged*>>& rows)
+  {
+    for (auto& c : n.children) {
+      std::string path = prefix.empty() ? c.name : prefix + "/" + c.name;
+      rows.emplace_back(path, &c);
+      collect_flat(c, path, rows);
+    }
+  }
+
+  static void write_flat(std::ostream& os, const detail::profile_merged& root)
+  {
+    std::vector<std::pair<std::string, const detail::profile_merged*>> rows;
+    collect_flat(root, "", rows);
+    std::stable_sort(rows.begin(), rows.end(), [](
+        const std::pair<std::string, const detail::profile_merged*>& a,
+        const std::pair<std::string, const detail::profile_merged*>& b) {
+      return a.second->stats.total > b.second->stats.total;
+    });
+
+    std::ostringstream out;
+    out << std::left << std::setw(12) << "total(s)" << std::setw(12)
+        << "self(s)" << std::setw(12) << "calls" << std::setw(12) << "min(s)"
+        << std::setw(12) << "avg(s)" << std::setw(12) << "max(s)"
+        << std::setw(8) << "threads"
+        << "region\n";
+    out << std::setprecision(5);
+    for (auto& r : rows) {
+      const detail::profile_stats& s = r.second->stats;
+      const double avg = s.count ? s.total / s.count : 0.0;
+      out << std::setw(12) << s.total << std::setw(12) << r.second->self()
+          << std::setw(12) << s.count << std::setw(12)
+          << (s.count ? s.min : 0.0) << std::setw(12) << avg << std::setw(12)
+          << s.max << std::setw(8) << r.second->threads << r.first << "\n";
+    }
+    os << out.str();
+  }
+
+  static void write_json(std::ostream& os,
+                         const std::vector<detail::profile_merged>& nodes)
+  {
+    os << "[";
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      const detail::profile_merged& n = nodes[i];
+      const detail::profile_stats& s = n.stats;
+      os << (i ? ", " : "") << "{\"name\": \""
+         << detail::json_escape(n.name) << "\", \"kind\": \""
+         << detail::profile_kind_name(n.kind) << "\", \"count\": " << s.count
+         << ", \"total\": " << s.total << ", \"self\": " << n.self()
+         << ", \"min\": " << (s.count ? s.min : 0.0) << ", \"max\": " << s.max
+         << ", \"threads\": " << n.threads << ", \"children\": ";
+      write_json(os, n.children);
+      os << "}";
+    }
+    os << "]";
+  }
+
+#if defined(RAJA_ENABLE_OPENMP)
+  omp::mutex m_mutex;
+#endif
+  std::vector<std::unique_ptr<detail::profile_thread>> m_threads;
+  int m_hooks = -1;
+  bool m_exit_registered = false;
+  format m_exit_format = format::flat;
+  std::string m_exit_path;
+};
+
+/*! \class ProfileRegion
+ ******************************************************************************
+ *
+ * \brief  ProfileRegion times the scope it lives in as a Profiler region
+ *
+ ******************************************************************************
+ */
+class ProfileRegion
+{
+public:
+  explicit ProfileRegion(const char* name) : m_name(name)
+  {
+    Profiler::getInstance().begin(m_name);
+  }
+  ~ProfileRegion() { Profiler::getInstance().end(m_name); }
+
+  ProfileRegion(const ProfileRegion&) = delete;
+  ProfileRegion& operator=(const ProfileRegion&) = delete;
+
+private:
+  const char* m_name;
+};
+
+namespace detail
+{
+//! true if RAJA_PROFILE turned the profiler on; one flag for the program
+inline bool profiler_environment_read()
+{
+  static const bool read = Profiler::configure_from_environment();
+  return read;
+}
+
+namespace
+{
+//! reads RAJA_PROFILE at static initialization, before main runs
+struct profiler_environment_reader {
+  profiler_environment_reader() { profiler_environment_read(); }
+};
+const profiler_environment_reader read_profiler_environment{};
+}  // namespace
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,664 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a fixed-width SIMD register type.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_SimdRegister_HPP
+#define RAJA_util_SimdRegister_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cmath>
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Operations on the native register holding Width values of type T.
+ *
+ * The generic backend holds an array and leaves vectorization to the
+ * compiler; the specializations below use AVX2 and AVX-512 intrinsics.
+ * Functions taking a lane count n touch only lanes [0, n): loads and
+ * gathers zero the other lanes, stores and scatters leave memory for them
+ * untouched.
+ */
+template <typename T, camp::idx_t Width>
+struct simd_backend {
+  struct reg_t {
+    T v[Width];
+  };
+
+  static RAJA_INLINE reg_t broadcast(T x)
+  {
+    reg_t r;
+    for (camp::idx_t k = 0; k < Width; ++k)
+      r.v[k] = x;
+    return r;
+  }
+
+  static RAJA_INLINE reg_t load(const T* p, camp::idx_t n)
+  {
+    reg_t r;
+    for (camp::idx_t k = 0; k < Width; ++k)
+      r.v[k] = k < n ? p[k] : T();
+    return r;
+  }
+
+  static RAJA_INLINE reg_t gather(const T* p,
+                                  const Index_type* off,
+                                  camp::idx_t n)
+  {
+    reg_t r;
+    for (camp::idx_t k = 0; k < Width; ++k)
+      r.v[k] = k < n ? p[off[k]] : T();
+    return r;
+  }
+
+  static RAJA_INLINE void store(T* p, reg_t a, camp::idx_t n)
+  {
+    for (camp::idx_t k = 0; k < n; ++k)
+      p[k] = a.v[k];
+  }
+
+  static RAJA_INLINE void scatter(T* p,
+                                  const Index_type* off,
+                                  reg_t a,
+                                  camp::idx_t n)
+  {
+    for (camp::idx_t k = 0; k < n; ++k)
+      p[off[k]] = a.v[k];
+  }
+
+  static RAJA_INLINE void to_array(T* out, reg_t a)
+  {
+    for (camp::idx_t k = 0; k < Width; ++k)
+      out[k] = a.v[k];
+  }
+
+#define RAJA_SIMD_BACKEND_BINARY(NAME, EXPR)           \
+  static RAJA_INLINE reg_t NAME(reg_t a, reg_t b)      \
+  {                                                    \
+    reg_t r;                                           \
+    for (camp::idx_t k = 0; k < Width; ++k) {          \
+      const T x = a.v[k];                              \
+      const T y = b.v[k];                              \
+      r.v[k] = EXPR;                                   \
+    }                                                  \
+    return r;                                          \
+  }
+
+  RAJA_SIMD_BACKEND_BINARY(add, x + y)
+  RAJA_SIMD_BACKEND_BINARY(sub, x - y)
+  RAJA_SIMD_BACKEND_BINARY(mul, x* y)
+  RAJA_SIMD_BACKEND_BINARY(div, x / y)
+  RAJA_SIMD_BACKEND_BINARY(min, y < x ? y : x)
+  RAJA_SIMD_BACKEND_BINARY(max, x < y ? y : x)
+
+#undef RAJA_SIMD_BACKEND_BINARY
+
+  static RAJA_INLINE reg_t fma(reg_t a, reg_t b, reg_t c)
+  {
+    reg_t r;
+    for (camp::idx_t k = 0; k < Width; ++k)
+      r.v[k] = a.v[k] * b.v[k] + c.v[k];
+    return r;
+  }
+};
+
+//! gather through a lane array, for backends without a native gather
+template <typename Backend, typename T, camp::idx_t Width>
+RAJA_INLINE typename Backend::reg_t simd_gather_lanes(const T* p,
+                                                      const Index_type* off,
+                                                      camp::idx_t n)
+{
+  T lanes[Width];
+  for (camp::idx_t k = 0; k < Width; ++k)
+    lanes[k] = k < n ? p[off[k]] : T();
+  return Backend::load(lanes, Width);
+}
+
+//! scatter through a lane array, for backends without a native scatter
+template <typename Backend, typename T, camp::idx_t Width>
+RAJA_INLINE void simd_scatter_lanes(T* p,
+                                    const Index_type* off,
+                                    typename Backend::reg_t a,
+                                    camp::idx_t n)
+{
+  T lanes[Width];
+  Backend::to_array(lanes, a);
+  for (camp::idx_t k = 0; k < n; ++k)
+    p[off[k]] = lanes[k];
+}
+
+#if defined(__AVX2__)
+
+template <>
+struct simd_backend<double, 4> {
+  using reg_t = __m256d;
+  using self = simd_backend<double, 4>;
+
+  static RAJA_INLINE __m256i mask(camp::idx_t n)
+  {
+    return _mm256_cmpgt_epi64(_mm256_set1_epi64x(n),
+                              _mm256_set_epi64x(3, 2, 1, 0));
+  }
+
+  static RAJA_INLINE reg_t broadcast(double x) { return _mm256_set1_pd(x); }
+
+  static RAJA_INLINE reg_t load(const double* p, camp::idx_t n)
+  {
+    return n >= 4 ? _mm256_loadu_pd(p) : _mm256_maskload_pd(p, mask(n));
+  }
+
+  static RAJA_INLINE reg_t gather(const double* p,
+                                  const Index_type* off,
+                                  camp::idx_t n)
+  {
+    static_assert(sizeof(Index_type) == sizeof(long long),
+                  "64-bit gather offsets expected");
+    return _mm256_mask_i64gather_pd(
+        _mm256_setzero_pd(),
+        p,
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(off)),
+        _mm256_castsi256_pd(mask(n)),
+        8);
+  }
+
+  static RAJA_INLINE void store(double* p, reg_t a, camp::idx_t n)
+  {
+    if (n >= 4) {
+      _mm256_storeu_pd(p, a);
+    } else {
+      _mm256_maskstore_pd(p, mask(n), a);
+    }
+  }
+
+  static RAJA_INLINE void scatter(double* p,
+                                  const Index_type* off,
+                                  reg_t a,
+                                  camp::idx_t n)
+  {
+    simd_scatter_lanes<self, double, 4>(p, off, a, n);
+  }
+
+  static RAJA_INLINE void to_array(double* out, reg_t a)
+  {
+    _mm256_storeu_pd(out, a);
+  }
+
+  static RAJA_INLINE reg_t add(reg_t a, reg_t b) { return _mm256_add_pd(a, b); }
+  static RAJA_INLINE reg_t sub(reg_t a, reg_t b) { return _mm256_sub_pd(a, b); }
+  static RAJA_INLINE reg_t mul(reg_t a, reg_t b) { return _mm256_mul_pd(a, b); }
+  static RAJA_INLINE reg_t div(reg_t a, reg_t b) { return _mm256_div_pd(a, b); }
+  static RAJA_INLINE reg_t min(reg_t a, reg_t b) { return _mm256_min_pd(a, b); }
+  static RAJA_INLINE reg_t max(reg_t a, reg_t b) { return _mm256_max_pd(a, b); }
+
+  static RAJA_INLINE reg_t fma(reg_t a, reg_t b, reg_t c)
+  {
+#if defined(__FMA__)
+    return _mm256_fmadd_pd(a, b, c);
+#else
+    return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#endif
+  }
+};
+
+template <>
+struct simd_backend<float, 8> {
+  using reg_t = __m256;
+  using self = simd_backend<float, 8>;
+
+  static RAJA_INLINE __m256i mask(camp::idx_t n)
+  {
+    return _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(n)),
+                              _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  }
+
+  static RAJA_INLINE reg_t broadcast(float x) { return _mm256_set1_ps(x); }
+
+  static RAJA_INLINE reg_t load(const float* p, camp::idx_t n)
+  {
+    return n >= 8 ? _mm256_loadu_ps(p) : _mm256_maskload_ps(p, mask(n));
+  }
+
+  static RAJA_INLINE reg_t gather(const float* p,
+                                  const Index_type* off,
+                                  camp::idx_t n)
+  {
+    return simd_gather_lanes<self, float, 8>(p, off, n);
+  }
+
+  static RAJA_INLINE void store(float* p, reg_t a, camp::idx_t n)
+  {
+    if (n >= 8) {
+      _mm256_storeu_ps(p, a);
+    } else {
+      _mm256_maskstore_ps(p, mask(n), a);
+    }
+  }
+
+  static RAJA_INLINE void scatter(float* p,
+                                  const Index_type* off,
+                                  reg_t a,
+                                  camp::idx_t n)
+  {
+    simd_scatter_lanes<self, float, 8>(p, off, a, n);
+  }
+
+  static RAJA_INLINE void to_array(float* out, reg_t a)
+  {
+    _mm256_storeu_ps(out, a);
+  }
+
+  static RAJA_INLINE reg_t add(reg_t a, reg_t b) { return _mm256_add_ps(a, b); }
+  static RAJA_INLINE reg_t sub(reg_t a, reg_t b) { return _mm256_sub_ps(a, b); }
+  static RAJA_INLINE reg_t mul(reg_t a, reg_t b) { return _mm256_mul_ps(a, b); }
+  static RAJA_INLINE reg_t div(reg_t a, reg_t b) { return _mm256_div_ps(a, b); }
+  static RAJA_INLINE reg_t min(reg_t a, reg_t b) { return _mm256_min_ps(a, b); }
+  static RAJA_INLINE reg_t max(reg_t a, reg_t b) { return _mm256_max_ps(a, b); }
+
+  static RAJA_INLINE reg_t fma(reg_t a, reg_t b, reg_t c)
+  {
+#if defined(__FMA__)
+    return _mm256_fmadd_ps(a, b, c);
+#else
+    return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+  }
+};
+
+#endif  // __AVX2__
+
+#if defined(__AVX512F__)
+
+template <>
+struct simd_backend<double, 8> {
+  using reg_t = __m512d;
+  using self = simd_backend<double, 8>;
+
+  static RAJA_INLINE __mmask8 mask(camp::idx_t n)
+  {
+    return static_cast<__mmask8>((1u << n) - 1u);
+  }
+
+  static RAJA_INLINE reg_t broadcast(double x) { return _mm512_set1_pd(x); }
+
+  static RAJA_INLINE reg_t load(const double* p, camp::idx_t n)
+  {
+    return n >= 8 ? _mm512_loadu_pd(p) : _mm512_maskz_loadu_pd(mask(n), p);
+  }
+
+  static RAJA_INLINE reg_t gather(const double* p,
+                                  const Index_type* off,
+                                  camp::idx_t n)
+  {
+    static_assert(sizeof(Index_type) == sizeof(long long),
+                  "64-bit gather offsets expected");
+    return _mm512_mask_i64gather_pd(_mm512_setzero_pd(),
+                                    mask(n),
+                                    _mm512_loadu_si512(off),
+                                    p,
+                                    8);
+  }
+
+  static RAJA_INLINE void store(double* p, reg_t a, camp::idx_t n)
+  {
+    if (n >= 8) {
+      _mm512_storeu_pd(p, a);
+    } else {
+      _mm512_mask_storeu_pd(p, mask(n), a);
+    }
+  }
+
+  static RAJA_INLINE void scatter(double* p,
+                                  const Index_type* off,
+                                  reg_t a,
+                                  camp::idx_t n)
+  {
+    _mm512_mask_i64scatter_pd(p, mask(n), _mm512_loadu_si512(off), a, 8);
+  }
+
+  static RAJA_INLINE void to_array(double* out, reg_t a)
+  {
+    _mm512_storeu_pd(out, a);
+  }
+
+  static RAJA_INLINE reg_t add(reg_t a, reg_t b) { return _mm512_add_pd(a, b); }
+  static RAJA_INLINE reg_t sub(reg_t a, reg_t b) { return _mm512_sub_pd(a, b); }
+  static RAJA_INLINE reg_t mul(reg_t a, reg_t b) { return _mm512_mul_pd(a, b); }
+  static RAJA_INLINE reg_t div(reg_t a, reg_t b) { return _mm512_div_pd(a, b); }
+  static RAJA_INLINE reg_t min(reg_t a, reg_t b) { return _mm512_min_pd(a, b); }
+  static RAJA_INLINE reg_t max(reg_t a, reg_t b) { return _mm512_max_pd(a, b); }
+
+  static RAJA_INLINE reg_t fma(reg_t a, reg_t b, reg_t c)
+  {
+    return _mm512_fmadd_pd(a, b, c);
+  }
+};
+
+template <>
+struct simd_backend<float, 16> {
+  using reg_t = __m512;
+  using self = simd_backend<float, 16>;
+
+  static RAJA_INLINE __mmask16 mask(camp::idx_t n)
+  {
+    return static_cast<__mmask16>((1u << n) - 1u);
+  }
+
+  static RAJA_INLINE reg_t broadcast(float x) { return _mm512_set1_ps(x); }
+
+  static RAJA_INLINE reg_t load(const float* p, camp::idx_t n)
+  {
+    return n >= 16 ? _mm512_loadu_ps(p) : _mm512_maskz_loadu_ps(mask(n), p);
+  }
+
+  static RAJA_INLINE reg_t gather(const float* p,
+                                  const Index_type* off,
+                                  camp::idx_t n)
+  {
+    return simd_gather_lanes<self, float, 16>(p, off, n);
+  }
+
+  static RAJA_INLINE void store(float* p, reg_t a, camp::idx_t n)
+  {
+    if (n >= 16) {
+      _mm512_storeu_ps(p, a);
+    } else {
+      _mm512_mask_storeu_ps(p, mask(n), a);
+    }
+  }
+
+  static RAJA_INLINE void scatter(float* p,
+                                  const Index_type* off,
+                                  reg_t a,
+                                  camp::idx_t n)
+  {
+    simd_scatter_lanes<self, float, 16>(p, off, a, n);
+  }
+
+  static RAJA_INLINE void to_array(float* out, reg_t a)
+  {
+    _mm512_storeu_ps(out, a);
+  }
+
+  static RAJA_INLINE reg_t add(reg_t a, reg_t b) { return _mm512_add_ps(a, b); }
+  static RAJA_INLINE reg_t sub(reg_t a, reg_t b) { return _mm512_sub_ps(a, b); }
+  static RAJA_INLINE reg_t mul(reg_t a, reg_t b) { return _mm512_mul_ps(a, b); }
+  static RAJA_INLINE reg_t div(reg_t a, reg_t b) { return _mm512_div_ps(a, b); }
+  static RAJA_INLINE reg_t min(reg_t a, reg_t b) { return _mm512_min_ps(a, b); }
+  static RAJA_INLINE reg_t max(reg_t a, reg_t b) { return _mm512_max_ps(a, b); }
+
+  static RAJA_INLINE reg_t fma(reg_t a, reg_t b, reg_t c)
+  {
+    return _mm512_fmadd_ps(a, b, c);
+  }
+};
+
+#endif  // __AVX512F__
+
+}  // namespace detail
+
+/*!
+ * \brief A register of Width values of type T.
+ *
+ * Maps onto an AVX2 or AVX-512 register when the target supports one of
+ * that shape (4 or 8 doubles, 8 or 16 floats), and onto an array the
+ * compiler is free to vectorize otherwise.
+ *
+ * Memory operations take the number of active lanes n, counted from lane 0,
+ * so the remainder of a loop is handled with a masked access rather than a
+ * scalar epilogue.
+ */
+template <typename T, camp::idx_t Width>
+class simd_register
+{
+public:
+  static_assert(std::is_arithmetic<T>::value,
+                "simd_register holds arithmetic values");
+  static_assert(Width > 0, "simd_register needs at least one lane");
+
+  using value_type = T;
+  using backend = detail::simd_backend<T, Width>;
+  using native_type = typename backend::reg_t;
+
+  static constexpr camp::idx_t width = Width;
+
+  native_type reg;
+
+  simd_register() = default;
+
+  //! all lanes set to x
+  RAJA_INLINE simd_register(T x) : reg(backend::broadcast(x)) {}
+
+  RAJA_INLINE explicit simd_register(native_type r) : reg(r) {}
+
+  //! load lanes [0, n) from p[0, n), zeroing the rest
+  static RAJA_INLINE simd_register load(const T* p, camp::idx_t n = Width)
+  {
+    return simd_register(backend::load(p, n));
+  }
+
+  //! load lanes [0, n) from p[k * stride], zeroing the rest
+  static RAJA_INLINE simd_register load_strided(const T* p,
+                                                Index_type stride,
+                                                camp::idx_t n = Width)
+  {
+    if (stride == 1) return load(p, n);
+    Index_type off[Width];
+    for (camp::idx_t k = 0; k < Width; ++k)
+      off[k] = k * stride;
+    return gather(p, off, n);
+  }
+
+  //! load lanes [0, n) from p[off[k]], zeroing the rest
+  static RAJA_INLINE simd_register gather(const T* p,
+                                          const Index_type* off,
+                                          camp::idx_t n = Width)
+  {
+    return simd_register(backend::gather(p, off, n));
+  }
+
+  //! load lanes [0, n) from p[idx[k]], zeroing the rest
+  template <typename IndexType>
+  static RAJA_INLINE simd_register gather(
+      const T* p,
+      simd_register<IndexType, Width> const& idx,
+      camp::idx_t n = Width)
+  {
+    IndexType lanes[Width];
+    idx.store(lanes, Width);
+    Index_type off[Width];
+    for (camp::idx_t k = 0; k < Width; ++k)
+      off[k] = static_cast<Index_type>(lanes[k]);
+    return gather(p, off, n);
+  }
+
+  //! store lanes [0, n) to p[0, n)
+  RAJA_INLINE void store(T* p, camp::idx_t n = Width) const
+  {
+    backend::store(p, reg, n);
+  }
+
+  //! store lanes [0, n) to p[k * stride]
+  RAJA_INLINE void store_strided(T* p,
+                                 Index_type stride,
+                                 camp::idx_t n = Width) const
+  {
+    if (stride == 1) {
+      store(p, n);
+      return;
+    }
+    Index_type off[Width];
+    for (camp::idx_t k = 0; k < Width; ++k)
+      off[k] = k * stride;
+    scatter(p, off, n);
+  }
+
+  //! store lanes [0, n) to p[off[k]]
+  RAJA_INLINE void scatter(T* p,
+                           const Index_type* off,
+                           camp::idx_t n = Width) const
+  {
+    backend::scatter(p, off, reg, n);
+  }
+
+  //! value of one lane
+  RAJA_INLINE T operator[](camp::idx_t lane) const
+  {
+    T lanes[Width];
+    backend::to_array(lanes, reg);
+    return lanes[lane];
+  }
+
+  //! sum over lanes [0, n)
+  RAJA_INLINE T sum(camp::idx_t n = Width) const
+  {
+    T lanes[Width];
+    backend::to_array(lanes, reg);
+    T r = T();
+    for (camp::idx_t k = 0; k < n; ++k)
+      r += lanes[k];
+    return r;
+  }
+
+  //! smallest of lanes [0, n), n > 0
+  RAJA_INLINE T min(camp::idx_t n = Width) const
+  {
+    T lanes[Width];
+    backend::to_array(lanes, reg);
+    T r = lanes[0];
+    for (camp::idx_t k = 1; k < n; ++k)
+      r = lanes[k] < r ? lanes[k] : r;
+    return r;
+  }
+
+  //! largest of lanes [0, n), n > 0
+  RAJA_INLINE T max(camp::idx_t n = Width) const
+  {
+    T lanes[Width];
+    backend::to_array(lanes, reg);
+    T r = lanes[0];
+    for (camp::idx_t k = 1; k < n; ++k)
+      r = r < lanes[k] ? lanes[k] : r;
+    return r;
+  }
+
+  RAJA_INLINE simd_register operator-() const
+  {
+    return simd_register(backend::sub(backend::broadcast(T()), reg));
+  }
+
+  RAJA_INLINE simd_register& operator+=(simd_register const& b)
+  {
+    reg = backend::add(reg, b.reg);
+    return *this;
+  }
+
+  RAJA_INLINE simd_register& operator-=(simd_register const& b)
+  {
+    reg = backend::sub(reg, b.reg);
+    return *this;
+  }
+
+  RAJA_INLINE simd_register& operator*=(simd_register const& b)
+  {
+    reg = backend::mul(reg, b.reg);
+    return *this;
+  }
+
+  RAJA_INLINE simd_register& operator/=(simd_register const& b)
+  {
+    reg = backend::div(reg, b.reg);
+    return *this;
+  }
+};
+
+#define RAJA_SIMD_REGISTER_OPERATOR(OP, OPEQ)                               \
+  template <typename T, camp::idx_t Width>                                   \
+  RAJA_INLINE simd_register<T, Width> operator OP(                           \
+      simd_register<T, Width> a, simd_register<T, Width> const& b)           \
+  {                                                                          \
+    return a OPEQ b;                                                         \
+  }                                                                          \
+                                                                             \
+  template <typename T, camp::idx_t Width, typename S>                       \
+  RAJA_INLINE typename std::enable_if<std::is_arithmetic<S>::value,          \
+                                      simd_register<T, Width>>::type         \
+  operator OP(simd_register<T, Width> a, S b)                                \
+  {                                                                          \
+    return a OPEQ simd_register<T, Width>(static_cast<T>(b));                \
+  }                                                                          \
+                                                                             \
+  template <typename T, camp::idx_t Width, typename S>                       \
+  RAJA_INLINE typename std::enable_if<std::is_arithmetic<S>::value,          \
+                                      simd_register<T, Width>>::type         \
+  operator OP(S a, simd_register<T, Width> const& b)                         \
+  {                                                                          \
+    simd_register<T, Width> r(static_cast<T>(a));                            \
+    return r OPEQ b;                                                         \
+  }
+
+RAJA_SIMD_REGISTER_OPERATOR(+, +=)
+RAJA_SIMD_REGISTER_OPERATOR(-, -=)
+RAJA_SIMD_REGISTER_OPERATOR(*, *=)
+RAJA_SIMD_REGISTER_OPERATOR(/, /=)
+
+#undef RAJA_SIMD_REGISTER_OPERATOR
+
+//! lane-wise minimum
+template <typename T, camp::idx_t Width>
+RAJA_INLINE simd_register<T, Width> vmin(simd_register<T, Width> const& a,
+                                         simd_register<T, Width> const& b)
+{
+  using backend = typename simd_register<T, Width>::backend;
+  return simd_register<T, Width>(backend::min(a.reg, b.reg));
+}
+
+//! lane-wise maximum
+template <typename T, camp::idx_t Width>
+RAJA_INLINE simd_register<T, Width> vmax(simd_register<T, Width> const& a,
+                                         simd_register<T, Width> const& b)
+{
+  using backend = typename simd_register<T, Width>::backend;
+  return simd_register<T, Width>(backend::max(a.reg, b.reg));
+}
+
+//! a * b + c, fused where the target supports it
+template <typename T, camp::idx_t Width>
+RAJA_INLINE simd_register<T, Width> vfma(simd_register<T, Width> const& a,
+                                         simd_register<T, Width> const& b,
+                                         simd_register<T, Width> const& c)
+{
+  using backend = typename simd_register<T, Width>::backend;
+  return simd_register<T, Width>(backend::fma(a.reg, b.reg, c.reg));
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
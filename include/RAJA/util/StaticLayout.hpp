@@ -90,6 +90,27 @@ struct StaticLayoutBase_impl<camp::idx_seq<RangeInts...>,
   }
 
 
+  /*!
+   * Given a linear-space index, compute the n-dimensional indices defined
+   * by this layout.
+   *
+   * The strides and sizes are compile-time constants, so the compiler
+   * replaces the divisions with multiplies and shifts.
+   *
+   * @param linear_index  Linear space index to be converted to indices.
+   * @param indices  Variadic list of indices to be assigned, number must match
+   *                 dimensionality of this layout.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(int linear_index,
+                                              Indices &&... indices) const
+  {
+    VarOps::ignore_args(
+        (indices = (linear_index / (Strides ? Strides : 1)) %
+                   (Sizes ? Sizes : 1))...);
+  }
+
+
   /*!
    * Computes a total size of the layout's space.
    * This is the produce of each dimensions size.
@@ -0,0 +1,231 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining an exact accumulator for sums of
+ *          floating-point values.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_SuperAccumulator_HPP
+#define RAJA_util_SuperAccumulator_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * \brief Exact sum of double (or float) values.
+ *
+ * The sum is kept as a fixed-point integer covering the whole double range,
+ * from 2^-1074 up, split into 32-bit digits held in 64-bit words so that
+ * carries only need to be propagated every 2^30 additions. Every addition
+ * is exact, so the value does not depend on the order or grouping of the
+ * additions; it is rounded once, to nearest float or double, when read.
+ *
+ * Infinities and NaNs are counted separately and give the IEEE result.
+ */
+class super_accumulator
+{
+public:
+  //! digits of 32 bits: 66 for finite doubles and two for carries
+  static constexpr int num_digits = 68;
+
+  super_accumulator() { clear(); }
+
+  void clear()
+  {
+    for (int k = 0; k < num_digits; ++k) {
+      digit[k] = 0;
+    }
+    adds_left = max_deferred_adds;
+    nans = 0;
+    pos_infs = 0;
+    neg_infs = 0;
+  }
+
+  RAJA_INLINE void add(double x)
+  {
+    std::uint64_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    const int biased = static_cast<int>((bits >> 52) & 0x7ff);
+    std::uint64_t mant = bits & ((std::uint64_t(1) << 52) - 1);
+    if (biased == 0x7ff) {
+      add_special(mant, bits >> 63);
+      return;
+    }
+
+    // bit 0 of the accumulator has weight 2^-1074, the lowest subnormal bit;
+    // normal values get their implicit leading bit
+    const int normal = biased != 0;
+    const int pos = biased - normal;
+    mant |= static_cast<std::uint64_t>(normal) << 52;
+
+    const int idx = pos >> 5;
+    const int shift = pos & 31;
+    const std::uint64_t lo = mant << shift;
+    const std::uint64_t hi = (mant >> 32) >> (32 - shift);
+
+    // conditional negation, without a branch on the sign
+    const std::int64_t neg = -static_cast<std::int64_t>(bits >> 63);
+    digit[idx] += (static_cast<std::int64_t>(lo & digit_mask) ^ neg) - neg;
+    digit[idx + 1] += (static_cast<std::int64_t>(lo >> 32) ^ neg) - neg;
+    digit[idx + 2] += (static_cast<std::int64_t>(hi) ^ neg) - neg;
+
+    if (--adds_left == 0) {
+      normalize();
+    }
+  }
+
+  RAJA_INLINE void add(float x) { add(static_cast<double>(x)); }
+
+  //! add another exact sum
+  void add(super_accumulator other)
+  {
+    other.normalize();
+    normalize();
+    for (int k = 0; k < num_digits; ++k) {
+      digit[k] += other.digit[k];
+    }
+    normalize();
+    nans += other.nans;
+    pos_infs += other.pos_infs;
+    neg_infs += other.neg_infs;
+  }
+
+  /*!
+   * The sum rounded once, to the nearest T (float or double), ties to
+   * even; a float result is not rounded to double first.
+   */
+  template <typename T = double>
+  T get() const
+  {
+    static_assert(std::is_same<T, float>::value ||
+                      std::is_same<T, double>::value,
+                  "super_accumulator sums round to float or double");
+    using limits = std::numeric_limits<T>;
+    if (nans || (pos_infs && neg_infs)) {
+      return limits::quiet_NaN();
+    }
+    if (pos_infs) return limits::infinity();
+    if (neg_infs) return -limits::infinity();
+
+    super_accumulator a(*this);
+    a.normalize();
+    const bool negative = a.digit[num_digits - 1] < 0;
+    if (negative) {
+      for (int k = 0; k < num_digits; ++k) {
+        a.digit[k] = -a.digit[k];
+      }
+      a.normalize();
+    }
+
+    int top = num_digits - 1;
+    while (top >= 0 && a.digit[top] == 0) {
+      --top;
+    }
+    if (top < 0) return T(0);
+    // digit 66 has weight 2^1038, beyond the double range
+    if (top >= 66) {
+      return negative ? -limits::infinity() : limits::infinity();
+    }
+
+    // the leading 64 bits, with the lowest bit made sticky for the bits
+    // below them; the sum is window * 2^exp
+    const std::uint64_t d2 = static_cast<std::uint64_t>(a.digit[top]);
+    const std::uint64_t d1 =
+        top >= 1 ? static_cast<std::uint64_t>(a.digit[top - 1]) : 0;
+    const std::uint64_t d0 =
+        top >= 2 ? static_cast<std::uint64_t>(a.digit[top - 2]) : 0;
+    int lead = 31;
+    while (!(d2 >> lead)) {
+      --lead;
+    }
+    const int shift = 63 - lead;
+    std::uint64_t window =
+        (d2 << shift) | (d1 << (shift - 32)) | (d0 >> (64 - shift));
+    bool sticky = (d0 & ((std::uint64_t(1) << (64 - shift)) - 1)) != 0;
+    for (int k = 0; k < top - 2; ++k) {
+      sticky = sticky || a.digit[k] != 0;
+    }
+    window |= static_cast<std::uint64_t>(sticky);
+    const int exp = 32 * top + lead - 63 - 1074;
+
+    // keep T's precision, less below its smallest normal, and round the
+    // rest of the window to nearest even
+    const int lowest = limits::min_exponent - limits::digits;
+    const int keep = std::min(limits::digits, exp + 64 - lowest);
+    const int drop = 64 - keep;
+    if (drop > 64) return negative ? -T(0) : T(0);
+    std::uint64_t kept, rem, half;
+    if (drop == 64) {
+      kept = 0;
+      rem = window;
+      half = std::uint64_t(1) << 63;
+    } else {
+      kept = window >> drop;
+      rem = window & ((std::uint64_t(1) << drop) - 1);
+      half = std::uint64_t(1) << (drop - 1);
+    }
+    if (rem > half || (rem == half && (kept & 1))) ++kept;
+
+    const T mag = std::ldexp(static_cast<T>(kept), exp + drop);
+    return negative ? -mag : mag;
+  }
+
+private:
+  static constexpr std::uint64_t digit_mask = 0xffffffff;
+  //! additions of up to 2^32 per digit before an int64 digit could overflow
+  static constexpr std::int64_t max_deferred_adds = std::int64_t(1) << 30;
+
+  std::int64_t digit[num_digits];
+  std::int64_t adds_left;
+  std::int64_t nans;
+  std::int64_t pos_infs;
+  std::int64_t neg_infs;
+
+  //! propagate carries; leaves every digit but the top one in [0, 2^32)
+  void normalize()
+  {
+    for (int k = 0; k < num_digits - 1; ++k) {
+      const std::int64_t carry = digit[k] >> 32;
+      digit[k] -= carry * (std::int64_t(1) << 32);
+      digit[k + 1] += carry;
+    }
+    adds_left = max_deferred_adds;
+  }
+
+  void add_special(std::uint64_t mant, std::uint64_t sign)
+  {
+    if (mant) {
+      ++nans;
+    } else if (sign) {
+      ++neg_infs;
+    } else {
+      ++pos_infs;
+    }
+  }
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,342 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the per-thread scratch arena that holds
+ *          CPU tile memory, such as the LocalArrays initialized by
+ *          statement::InitLocalMem with cpu_tile_mem.
+ *
+ *          Each thread keeps its arena for the life of the thread, so a
+ *          tile buffer costs a pointer bump once the arena has grown to
+ *          the kernel's needs. Buffers live on the heap, so tiles larger
+ *          than a thread's stack are fine, and start on a cache line.
+ *
+ *          RAJA_TILE_SCRATCH_PAD sets the number of bytes skipped after
+ *          each buffer (rounded up to whole cache lines), so buffers whose
+ *          size is a multiple of a large power of two do not map to the
+ *          same cache sets.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_TileScratch_HPP
+#define RAJA_util_TileScratch_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*! \class TileScratch
+ ******************************************************************************
+ *
+ * \brief  TileScratch is a thread's stack of tile buffers
+ *
+ * Buffers are taken with allocate() and given back, in the reverse order,
+ * by returning to a mark():
+ *
+ *   RAJA::TileScratch& scratch = RAJA::TileScratch::this_thread();
+ *   RAJA::TileScratch::mark_type m = scratch.mark();
+ *   double* tile = scratch.allocate<double>(256 * 256);
+ *   ...
+ *   scratch.release(m);
+ *
+ * or with a TileScratchScope, which does the same on scope exit. Memory
+ * comes from blocks of at least min_block bytes; a buffer that does not fit
+ * in the current block goes to a new, larger one, so earlier buffers never
+ * move. Once everything is released the blocks are merged into one that
+ * holds them all, so a kernel that ran once runs again without touching
+ * the system allocator.
+ *
+ ******************************************************************************
+ */
+class TileScratch
+{
+public:
+  //! alignment of every buffer
+  static constexpr size_t alignment = 64;
+  //! smallest block requested from the system
+  static constexpr size_t min_block = size_t(1) << 16;
+
+  //! position in the arena to release back to
+  struct mark_type {
+    size_t block;
+    size_t used;
+  };
+
+  //! the calling thread's arena
+  static TileScratch& this_thread()
+  {
+    static thread_local TileScratch scratch;
+    return scratch;
+  }
+
+  //! bytes skipped after each buffer, for all threads
+  static void set_padding(size_t bytes)
+  {
+    padding_bytes().store(round_up(bytes), std::memory_order_relaxed);
+  }
+
+  static size_t padding()
+  {
+    return padding_bytes().load(std::memory_order_relaxed);
+  }
+
+  TileScratch() = default;
+  TileScratch(const TileScratch&) = delete;
+  TileScratch& operator=(const TileScratch&) = delete;
+
+  ~TileScratch()
+  {
+    for (block& b : m_blocks) {
+      free_aligned(b.ptr);
+    }
+  }
+
+  //! nbytes of memory aligned to alignment
+  void* allocate(size_t nbytes)
+  {
+    const size_t size = round_up(nbytes) + padding();
+    while (m_current < m_blocks.size()) {
+      block& b = m_blocks[m_current];
+      if (b.size - m_used >= size) {
+        void* ptr = b.ptr + m_used;
+        m_used += size;
+        return ptr;
+      }
+      if (m_current + 1 == m_blocks.size()) break;
+      ++m_current;
+      m_used = 0;
+    }
+    return grow(size);
+  }
+
+  //! uninitialized space for n values of T
+  template <typename T>
+  T* allocate(size_t n)
+  {
+    static_assert(alignof(T) <= alignment,
+                  "TileScratch buffers are aligned to 64 bytes only");
+    return static_cast<T*>(allocate(n * sizeof(T)));
+  }
+
+  //! n default-initialized values of T; destroy them with destroy()
+  template <typename T>
+  T* construct(size_t n)
+  {
+    T* ptr = allocate<T>(n);
+    for (size_t i = 0; i < n; ++i) {
+      new (ptr + i) T;
+    }
+    return ptr;
+  }
+
+  template <typename T>
+  static void destroy(T* ptr, size_t n)
+  {
+    for (size_t i = n; i > 0; --i) {
+      ptr[i - 1].~T();
+    }
+  }
+
+  mark_type mark() const { return mark_type{m_current, m_used}; }
+
+  //! give back every buffer allocated since m was taken
+  void release(mark_type m)
+  {
+    m_current = m.block;
+    m_used = m.used;
+    if (m_current == 0 && m_used == 0 && m_blocks.size() > 1) merge();
+  }
+
+  //! bytes the arena holds
+  size_t capacity() const
+  {
+    size_t total = 0;
+    for (const block& b : m_blocks) {
+      total += b.size;
+    }
+    return total;
+  }
+
+  //! bytes handed out and not yet released, including skipped space
+  size_t in_use() const
+  {
+    size_t total = m_used;
+    for (size_t b = 0; b < m_current && b < m_blocks.size(); ++b) {
+      total += m_blocks[b].size;
+    }
+    return total;
+  }
+
+  //! return all memory to the system; nothing may be in use
+  void trim()
+  {
+    if (in_use() != 0) {
+      RAJA_ABORT_OR_THROW("RAJA::TileScratch::trim: buffers are in use");
+    }
+    for (block& b : m_blocks) {
+      free_aligned(b.ptr);
+    }
+    m_blocks.clear();
+  }
+
+private:
+  struct block {
+    char* ptr;
+    size_t size;
+  };
+
+  static size_t round_up(size_t nbytes)
+  {
+    return (nbytes + alignment - 1) / alignment * alignment;
+  }
+
+  static std::atomic<size_t>& padding_bytes()
+  {
+    static std::atomic<size_t> pad(read_padding());
+    return pad;
+  }
+
+  static size_t read_padding()
+  {
+    const char* env = std::getenv("RAJA_TILE_SCRATCH_PAD");
+    const long bytes = env ? std::atol(env) : 0;
+    return bytes > 0 ? round_up(static_cast<size_t>(bytes)) : 0;
+  }
+
+  //! a new block after the current one for a buffer of size bytes
+  void* grow(size_t size)
+  {
+    const size_t last = m_blocks.empty() ? 0 : m_blocks.back().size;
+    const size_t bytes = std::max(std::max(size, 2 * last), size_t(min_block));
+    void* ptr = allocate_aligned(alignment, bytes);
+    if (ptr == nullptr) {
+      RAJA_ABORT_OR_THROW("RAJA::TileScratch: out of memory");
+    }
+    m_blocks.push_back(block{static_cast<char*>(ptr), bytes});
+    m_current = m_blocks.size() - 1;
+    m_used = size;
+    return ptr;
+  }
+
+  //! replace the blocks, none of which is in use, with one as large
+  void merge()
+  {
+    const size_t bytes = capacity();
+    trim();
+    void* ptr = allocate_aligned(alignment, bytes);
+    if (ptr != nullptr) {
+      m_blocks.push_back(block{static_cast<char*>(ptr), bytes});
+    }
+  }
+
+  std::vector<block> m_blocks;
+  size_t m_current = 0;
+  size_t m_used = 0;
+};
+
+/*!
+ * \brief Releases the buffers taken from a thread's TileScratch during its
+ *        lifetime when it goes out of scope.
+ */
+class TileScratchScope
+{
+public:
+  explicit TileScratchScope(TileScratch& s = TileScratch::this_thread())
+      : m_scratch(s), m_mark(s.mark())
+  {
+  }
+
+  TileScratchScope(const TileScratchScope&) = delete;
+  TileScratchScope& operator=(const TileScratchScope&) = delete;
+
+  ~TileScratchScope() { m_scratch.release(m_mark); }
+
+  TileScratch& scratch() const { return m_scratch; }
+
+private:
+  TileScratch& m_scratch;
+  TileScratch::mark_type m_mark;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Two scratch buffers of n values of T for consecutive tiles
+ *
+ * While one tile is worked on in current(), the next one can be loaded
+ * into next(); swap() then moves on to it, and the finished buffer is
+ * reused for the tile after:
+ *
+ *   RAJA::TileDoubleBuffer<double> buf(tile * tile);
+ *   load(buf.current(), 0);
+ *   for (int t = 0; t < ntiles; ++t) {
+ *     if (t + 1 < ntiles) load(buf.next(), t + 1);
+ *     compute(buf.current(), t);
+ *     buf.swap();
+ *   }
+ *
+ * The buffers come from the calling thread's TileScratch and are given
+ * back by the destructor, so the object must be used and destroyed on that
+ * thread, after any buffers taken from the arena after it.
+ *
+ ******************************************************************************
+ */
+template <typename T>
+class TileDoubleBuffer
+{
+public:
+  explicit TileDoubleBuffer(size_t n,
+                            TileScratch& s = TileScratch::this_thread())
+      : m_scope(s), m_size(n)
+  {
+    m_buf[0] = s.construct<T>(n);
+    m_buf[1] = s.construct<T>(n);
+  }
+
+  TileDoubleBuffer(const TileDoubleBuffer&) = delete;
+  TileDoubleBuffer& operator=(const TileDoubleBuffer&) = delete;
+
+  ~TileDoubleBuffer()
+  {
+    TileScratch::destroy(m_buf[1], m_size);
+    TileScratch::destroy(m_buf[0], m_size);
+  }
+
+  T* current() const { return m_buf[m_which]; }
+  T* next() const { return m_buf[1 - m_which]; }
+  void swap() { m_which = 1 - m_which; }
+
+  //! values in each buffer
+  size_t size() const { return m_size; }
+
+private:
+  TileScratchScope m_scope;
+  size_t m_size;
+  T* m_buf[2];
+  int m_which = 0;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
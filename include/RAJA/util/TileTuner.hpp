@@ -0,0 +1,394 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a tile size tuner with an on-disk
+ *          cache, for use with statement::tile_dynamic.
+ *
+ *          The tuner times a kernel with each candidate tile size, keeps
+ *          the fastest for the kernel's name and problem shape on the
+ *          current machine, and saves it to a cache file that later runs
+ *          read, so they use the tuned size without timing anything.
+ *
+ *          RAJA_TILE_CACHE names the cache file (raja_tile_cache.txt in
+ *          the working directory by default), RAJA_TILE_TUNE=1 turns on
+ *          tuning of kernels not found in it, and RAJA_TILE_MACHINE
+ *          overrides the machine name entries are filed under.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_TileTuner_HPP
+#define RAJA_util_TileTuner_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32) || defined(WIN32) || defined(__CYGWIN__) || \
+    defined(__MINGW32__) || defined(__BORLANDC__)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "RAJA/util/Timer.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! s with each run of whitespace replaced by '_', so it is one token
+inline std::string tile_token(const std::string& s)
+{
+  std::string out;
+  bool space = false;
+  for (char c : s) {
+    if (std::isspace(static_cast<unsigned char>(c))) {
+      space = true;
+      continue;
+    }
+    if (space && !out.empty()) out += '_';
+    space = false;
+    out += c;
+  }
+  return out.empty() ? std::string("_") : out;
+}
+
+//! "256x256" for the shape {256, 256}
+inline std::string tile_shape(const std::vector<Index_type>& shape)
+{
+  std::ostringstream out;
+  for (size_t d = 0; d < shape.size(); ++d) {
+    out << (d ? "x" : "") << shape[d];
+  }
+  return shape.empty() ? std::string("-") : out.str();
+}
+
+/*!
+ * The machine tuned sizes are filed under: the CPU model from
+ * /proc/cpuinfo (the part number on Arm) and the number of hardware
+ * threads, or RAJA_TILE_MACHINE if set.
+ */
+inline std::string tile_machine()
+{
+  const char* env = std::getenv("RAJA_TILE_MACHINE");
+  if (env != nullptr && *env != '\0') return tile_token(env);
+
+  std::string model;
+  std::ifstream cpuinfo("/proc/cpuinfo");
+  std::string line;
+  while (model.empty() && std::getline(cpuinfo, line)) {
+    if (line.compare(0, 10, "model name") == 0 ||
+        line.compare(0, 8, "CPU part") == 0) {
+      const size_t colon = line.find(':');
+      if (colon != std::string::npos) model = line.substr(colon + 1);
+    }
+  }
+  return tile_token(model.empty() ? "unknown" : model) + ":" +
+         std::to_string(std::thread::hardware_concurrency());
+}
+
+//! cache entries, keyed by "machine kernel shape"
+using tile_entries = std::map<std::string, Index_type>;
+
+//! add the entries of the cache file at path; false if it cannot be read
+inline bool read_tile_cache(const std::string& path, tile_entries& entries)
+{
+  std::ifstream in(path);
+  if (!in) return false;
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    std::istringstream fields(line);
+    std::string machine, name, shape;
+    Index_type tile = 0;
+    if (fields >> machine >> name >> shape >> tile && tile > 0) {
+      entries[machine + " " + name + " " + shape] = tile;
+    }
+  }
+  return true;
+}
+
+/*!
+ * A temporary file name next to path, unique to the calling process and
+ * thread, so that processes saving the same cache (such as MPI ranks) do
+ * not write into each other's file before it is renamed over path.
+ */
+inline std::string tile_cache_temp(const std::string& path)
+{
+#if defined(_WIN32) || defined(WIN32) || defined(__CYGWIN__) || \
+    defined(__MINGW32__) || defined(__BORLANDC__)
+  const long pid = static_cast<long>(_getpid());
+#else
+  const long pid = static_cast<long>(getpid());
+#endif
+  std::ostringstream name;
+  name << path << ".tmp." << pid << "."
+       << std::hash<std::thread::id>()(std::this_thread::get_id());
+  return name.str();
+}
+
+}  // namespace detail
+
+/*! \class TileTuner
+ ******************************************************************************
+ *
+ * \brief  TileTuner picks tile sizes for statement::tile_dynamic by timing
+ * candidates, and remembers them across runs in a cache file
+ *
+ * A kernel with run-time tile sizes takes them as kernel parameters:
+ *
+ *   using pol = KernelPolicy<
+ *       statement::Tile<1, statement::tile_dynamic<0>, loop_exec,
+ *         statement::For<1, loop_exec,
+ *           statement::For<0, loop_exec, statement::Lambda<0>>>>>;
+ *
+ *   auto run = [&](Index_type tile) {
+ *     RAJA::kernel_param<pol>(segments, RAJA::make_tuple(tile), body);
+ *   };
+ *   Index_type tile = RAJA::TileTuner::getInstance().select(
+ *       "smooth", {nx, ny}, {8, 16, 32, 64}, run);
+ *   run(tile);
+ *
+ * select() returns the cached size for the kernel name and shape on this
+ * machine if there is one. Otherwise, when tuning is on, it runs the
+ * kernel once and then repetitions() times with each candidate, keeps the
+ * size with the shortest run and writes it to the cache file; when tuning
+ * is off it returns the first candidate without running anything. A
+ * kernel that is tuned must therefore be safe to run again.
+ *
+ * Entries are filed under a machine name, so one cache file can serve
+ * several kinds of node. The cache file is read on first use; saving
+ * merges into the file's current contents and replaces it atomically.
+ *
+ ******************************************************************************
+ */
+class TileTuner
+{
+public:
+  static TileTuner& getInstance()
+  {
+    static TileTuner t;
+    return t;
+  }
+
+  TileTuner(const TileTuner&) = delete;
+  TileTuner& operator=(const TileTuner&) = delete;
+
+  /*!
+   * \brief Tile size for kernel name at the given problem shape.
+   *
+   * run(tile) must run the kernel with that tile size; it is only called
+   * when tuning.
+   */
+  template <typename Run>
+  Index_type select(const std::string& name,
+                    const std::vector<Index_type>& shape,
+                    const std::vector<Index_type>& candidates,
+                    Run&& run)
+  {
+    Index_type tile = 0;
+    if (lookup(name, shape, tile)) return tile;
+    if (candidates.empty()) {
+      RAJA_ABORT_OR_THROW("RAJA::TileTuner::select: no candidate tile sizes");
+    }
+    if (!tuning()) return candidates.front();
+
+    double best = std::numeric_limits<double>::max();
+    for (Index_type c : candidates) {
+      run(c);
+      double fastest = std::numeric_limits<double>::max();
+      for (int r = 0; r < repetitions(); ++r) {
+        Timer timer;
+        timer.start();
+        run(c);
+        timer.stop();
+        fastest = std::min(fastest, static_cast<double>(timer.elapsed()));
+      }
+      if (fastest < best) {
+        best = fastest;
+        tile = c;
+      }
+    }
+
+    store(name, shape, tile);
+    const std::string path = cache_file();
+    if (!path.empty()) save(path);
+    return tile;
+  }
+
+  //! the cached tile size for name and shape on this machine, if any
+  bool lookup(const std::string& name,
+              const std::vector<Index_type>& shape,
+              Index_type& tile) const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(key(name, shape));
+    if (it == m_entries.end()) return false;
+    tile = it->second;
+    return true;
+  }
+
+  //! record tile as the size for name and shape on this machine
+  void store(const std::string& name,
+             const std::vector<Index_type>& shape,
+             Index_type tile)
+  {
+    if (tile <= 0) {
+      RAJA_ABORT_OR_THROW("RAJA::TileTuner::store: tile size must be "
+                          "positive");
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries[key(name, shape)] = tile;
+  }
+
+  //! add the entries of the cache file at path; false if it cannot be read
+  bool load(const std::string& path)
+  {
+    detail::tile_entries entries;
+    if (!detail::read_tile_cache(path, entries)) return false;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& e : entries) {
+      m_entries[e.first] = e.second;
+    }
+    return true;
+  }
+
+  //! merge all entries into the cache file at path
+  bool save(const std::string& path) const
+  {
+    detail::tile_entries entries;
+    detail::read_tile_cache(path, entries);
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      for (auto& e : m_entries) {
+        entries[e.first] = e.second;
+      }
+    }
+
+    const std::string tmp = detail::tile_cache_temp(path);
+    {
+      std::ofstream out(tmp);
+      out << "# RAJA tile cache: machine kernel shape tile\n";
+      for (auto& e : entries) {
+        out << e.first << " " << e.second << "\n";
+      }
+      if (!out) {
+        std::cerr << "RAJA::TileTuner: cannot write " << tmp << std::endl;
+        std::remove(tmp.c_str());
+        return false;
+      }
+    }
+    if (std::rename(tmp.c_str(), path.c_str()) != 0) {
+      std::cerr << "RAJA::TileTuner: cannot replace " << path << std::endl;
+      std::remove(tmp.c_str());
+      return false;
+    }
+    return true;
+  }
+
+  //! forget all entries, without touching the cache file
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+  }
+
+  //! time candidates for kernels that are not in the cache
+  void set_tuning(bool on)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_tuning = on;
+  }
+
+  bool tuning() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_tuning;
+  }
+
+  //! timed runs per candidate, after one untimed run
+  void set_repetitions(int n)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_repetitions = n < 1 ? 1 : n;
+  }
+
+  int repetitions() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_repetitions;
+  }
+
+  //! file tuned sizes are saved to; empty to keep them in memory only
+  void set_cache_file(const std::string& path)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_cache_file = path;
+  }
+
+  std::string cache_file() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_cache_file;
+  }
+
+  //! name of this machine in the cache
+  const std::string& machine() const { return m_machine; }
+
+private:
+  TileTuner() : m_machine(detail::tile_machine())
+  {
+    const char* path = std::getenv("RAJA_TILE_CACHE");
+    m_cache_file = (path != nullptr && *path != '\0') ? path
+                                                        : "raja_tile_cache.txt";
+    const char* tune = std::getenv("RAJA_TILE_TUNE");
+    m_tuning = tune != nullptr && *tune != '\0' && std::strcmp(tune, "0") != 0;
+    load(m_cache_file);
+  }
+
+  std::string key(const std::string& name,
+                  const std::vector<Index_type>& shape) const
+  {
+    return m_machine + " " + detail::tile_token(name) + " " +
+           detail::tile_shape(shape);
+  }
+
+  mutable std::mutex m_mutex;
+  const std::string m_machine;
+  std::string m_cache_file;
+  bool m_tuning = false;
+  int m_repetitions = 3;
+  detail::tile_entries m_entries;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -141,7 +141,7 @@ namespace RAJA
 /*!
  ******************************************************************************
  *
- * \brief  Timer class that uses std::chrono.
+ * \brief  Timer class that uses clock_gettime.
  *
  *         Generates elapsed time in seconds.
  *
@@ -175,7 +175,7 @@ public:
 private:
   TimeType tstart;
   TimeType tstop;
-  ElasedType telapsed;
+  ElapsedType telapsed;
 
   ElapsedType stime_elapsed;
   ElapsedType nstime_elapsed;
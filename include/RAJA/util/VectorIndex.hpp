@@ -0,0 +1,349 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the vector index passed to loop bodies
+ *          by RAJA::vector_exec, and the View accesses it produces.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_VectorIndex_HPP
+#define RAJA_util_VectorIndex_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/util/SimdRegister.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * \brief A run of up to Width consecutive loop indices.
+ *
+ * Lane k holds index first + k, for the size() active lanes. A View
+ * indexed with a vector_index returns a vector_ref that loads and stores
+ * all active lanes at once; a partial run at the end of a loop has fewer
+ * active lanes and is accessed with masked loads and stores.
+ */
+template <typename IndexType, camp::idx_t Width>
+struct vector_index {
+  using index_type = IndexType;
+  static constexpr camp::idx_t width = Width;
+
+  IndexType first;
+  camp::idx_t length;
+
+  RAJA_INLINE constexpr vector_index(IndexType first_,
+                                     camp::idx_t length_ = Width)
+      : first(first_), length(length_)
+  {
+  }
+
+  //! number of active lanes
+  RAJA_INLINE constexpr camp::idx_t size() const { return length; }
+
+  //! index held by a lane
+  RAJA_INLINE constexpr IndexType operator[](camp::idx_t lane) const
+  {
+    return first + static_cast<IndexType>(lane);
+  }
+
+  //! the lane indices as values of type T, e.g. to compute coordinates
+  template <typename T>
+  RAJA_INLINE simd_register<T, Width> as_register() const
+  {
+    T lanes[Width];
+    for (camp::idx_t k = 0; k < Width; ++k)
+      lanes[k] = static_cast<T>(stripIndexType(first) + k);
+    return simd_register<T, Width>::load(lanes);
+  }
+
+  //! the same lanes shifted by offset indices, e.g. a stencil neighbor
+  template <typename Offset>
+  RAJA_INLINE constexpr vector_index operator+(Offset offset) const
+  {
+    return vector_index(first + static_cast<IndexType>(offset), length);
+  }
+
+  template <typename Offset>
+  RAJA_INLINE constexpr vector_index operator-(Offset offset) const
+  {
+    return vector_index(first - static_cast<IndexType>(offset), length);
+  }
+};
+
+template <typename T, camp::idx_t Width>
+struct vector_ref;
+
+namespace detail
+{
+
+//! a vector operand as a register of Width values of type T
+template <typename T, camp::idx_t Width>
+RAJA_INLINE simd_register<T, Width> as_register(
+    simd_register<T, Width> const& v)
+{
+  return v;
+}
+
+template <typename T, camp::idx_t Width, typename U>
+RAJA_INLINE simd_register<T, Width> as_register(vector_ref<U, Width> const& v)
+{
+  return v.load();
+}
+
+template <typename T, camp::idx_t Width, typename S>
+RAJA_INLINE typename std::enable_if<std::is_arithmetic<S>::value,
+                                    simd_register<T, Width>>::type
+as_register(S x)
+{
+  return simd_register<T, Width>(static_cast<T>(x));
+}
+
+}  // namespace detail
+
+/*!
+ * \brief The elements of a View addressed by a vector_index.
+ *
+ * Reading converts to a simd_register, assigning a register or a scalar
+ * writes the active lanes.  Elements are contiguous when the vector index
+ * addresses the stride-one dimension of the layout, and are gathered or
+ * scattered otherwise.
+ */
+template <typename T, camp::idx_t Width>
+struct vector_ref {
+  using value_type = typename std::remove_const<T>::type;
+  using register_type = simd_register<value_type, Width>;
+
+  T* ptr;
+  Index_type stride;
+  camp::idx_t length;
+
+  RAJA_INLINE constexpr vector_ref(T* ptr_,
+                                   Index_type stride_,
+                                   camp::idx_t length_)
+      : ptr(ptr_), stride(stride_), length(length_)
+  {
+  }
+
+  vector_ref(vector_ref const&) = default;
+
+  RAJA_INLINE register_type load() const
+  {
+    return register_type::load_strided(ptr, stride, length);
+  }
+
+  RAJA_INLINE operator register_type() const { return load(); }
+
+  RAJA_INLINE vector_ref const& operator=(register_type const& v) const
+  {
+    v.store_strided(ptr, stride, length);
+    return *this;
+  }
+
+  //! copies elements, not the reference
+  RAJA_INLINE vector_ref const& operator=(vector_ref const& v) const
+  {
+    return *this = v.load();
+  }
+
+  template <typename U>
+  RAJA_INLINE vector_ref const& operator=(vector_ref<U, Width> const& v) const
+  {
+    return *this = register_type(v.load());
+  }
+
+  RAJA_INLINE vector_ref const& operator=(value_type x) const
+  {
+    return *this = register_type(x);
+  }
+
+#define RAJA_VECTOR_REF_UPDATE(OPEQ, OP)                                  \
+  template <typename V>                                                   \
+  RAJA_INLINE vector_ref const& operator OPEQ(V const& v) const           \
+  {                                                                       \
+    return *this = load() OP detail::as_register<value_type, Width>(v);   \
+  }
+
+  RAJA_VECTOR_REF_UPDATE(+=, +)
+  RAJA_VECTOR_REF_UPDATE(-=, -)
+  RAJA_VECTOR_REF_UPDATE(*=, *)
+  RAJA_VECTOR_REF_UPDATE(/=, /)
+
+#undef RAJA_VECTOR_REF_UPDATE
+};
+
+namespace detail
+{
+
+template <typename T>
+struct is_vector_index : std::false_type {
+};
+
+template <typename IndexType, camp::idx_t Width>
+struct is_vector_index<vector_index<IndexType, Width>> : std::true_type {
+};
+
+template <typename T>
+struct is_vector_ref : std::false_type {
+};
+
+template <typename T, camp::idx_t Width>
+struct is_vector_ref<vector_ref<T, Width>> : std::true_type {
+};
+
+//! whether any of Args is a vector_index
+template <typename... Args>
+struct has_vector_index : std::false_type {
+};
+
+template <typename Arg, typename... Args>
+struct has_vector_index<Arg, Args...>
+    : std::integral_constant<bool,
+                             is_vector_index<camp::decay<Arg>>::value
+                                 || has_vector_index<Args...>::value> {
+};
+
+//! width of the vector_index in Args, 1 if there is none
+template <typename... Args>
+struct vector_index_width : camp::num<1> {
+};
+
+template <typename Arg, typename... Args>
+struct vector_index_width<Arg, Args...> : vector_index_width<Args...> {
+};
+
+template <typename IndexType, camp::idx_t Width, typename... Args>
+struct vector_index_width<vector_index<IndexType, Width>, Args...>
+    : camp::num<Width> {
+  static_assert(!has_vector_index<Args...>::value,
+                "a View access takes at most one vector_index");
+};
+
+//! index of lane 0, or the index itself for scalar arguments
+template <typename Arg>
+RAJA_INLINE constexpr Arg vector_first(Arg arg)
+{
+  return arg;
+}
+
+template <typename IndexType, camp::idx_t Width>
+RAJA_INLINE constexpr IndexType vector_first(
+    vector_index<IndexType, Width> arg)
+{
+  return arg.first;
+}
+
+//! index of lane 1, or the index itself for scalar arguments
+template <typename Arg>
+RAJA_INLINE constexpr Arg vector_second(Arg arg)
+{
+  return arg;
+}
+
+template <typename IndexType, camp::idx_t Width>
+RAJA_INLINE constexpr IndexType vector_second(
+    vector_index<IndexType, Width> arg)
+{
+  return arg.first + static_cast<IndexType>(1);
+}
+
+RAJA_INLINE constexpr camp::idx_t vector_length() { return 1; }
+
+template <typename IndexType, camp::idx_t Width, typename... Args>
+RAJA_INLINE constexpr camp::idx_t vector_length(
+    vector_index<IndexType, Width> arg,
+    Args...)
+{
+  return arg.length;
+}
+
+template <typename Arg, typename... Args>
+RAJA_INLINE constexpr camp::idx_t vector_length(Arg, Args... args)
+{
+  return vector_length(args...);
+}
+
+/*!
+ * The vector_ref for data addressed through layout by args, one of which
+ * is a vector_index; the lane stride is the distance between the elements
+ * of its first two lanes.
+ */
+template <camp::idx_t Width,
+          typename ValueType,
+          typename PointerType,
+          typename LayoutType,
+          typename... Args>
+RAJA_INLINE vector_ref<ValueType, Width> make_vector_ref(
+    PointerType const& data,
+    LayoutType const& layout,
+    Args... args)
+{
+  const Index_type first =
+      static_cast<Index_type>(stripIndexType(layout(vector_first(args)...)));
+  const Index_type second =
+      static_cast<Index_type>(stripIndexType(layout(vector_second(args)...)));
+  return vector_ref<ValueType, Width>(&data[first],
+                                      second - first,
+                                      vector_length(args...));
+}
+
+//! register type of the vector operands A and B, enabled when one of them
+//! is a vector_ref
+template <typename A, typename B, typename Enable = void>
+struct vector_ref_result {
+};
+
+template <typename T, camp::idx_t Width, typename B>
+struct vector_ref_result<vector_ref<T, Width>, B> {
+  using type = typename vector_ref<T, Width>::register_type;
+};
+
+template <typename A, typename T, camp::idx_t Width>
+struct vector_ref_result<
+    A,
+    vector_ref<T, Width>,
+    typename std::enable_if<!is_vector_ref<A>::value>::type> {
+  using type = typename vector_ref<T, Width>::register_type;
+};
+
+}  // namespace detail
+
+#define RAJA_VECTOR_REF_OPERATOR(OP)                                        \
+  template <typename A, typename B>                                         \
+  RAJA_INLINE typename detail::vector_ref_result<A, B>::type operator OP(   \
+      A const& a, B const& b)                                               \
+  {                                                                         \
+    using reg = typename detail::vector_ref_result<A, B>::type;             \
+    using T = typename reg::value_type;                                     \
+    return detail::as_register<T, reg::width>(a)                            \
+        OP detail::as_register<T, reg::width>(b);                           \
+  }
+
+RAJA_VECTOR_REF_OPERATOR(+)
+RAJA_VECTOR_REF_OPERATOR(-)
+RAJA_VECTOR_REF_OPERATOR(*)
+RAJA_VECTOR_REF_OPERATOR(/)
+
+#undef RAJA_VECTOR_REF_OPERATOR
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -25,6 +25,7 @@
 #include "RAJA/pattern/atomic.hpp"
 
 #include "RAJA/util/Layout.hpp"
+#include "RAJA/util/VectorIndex.hpp"
 
 #if defined(RAJA_ENABLE_CHAI)
 #include "chai/ManagedArray.hpp"
@@ -80,11 +81,25 @@ struct View {
   // making this specifically typed would require unpacking the layout,
   // this is easier to maintain
   template <typename... Args>
-  RAJA_HOST_DEVICE RAJA_INLINE value_type &operator()(Args... args) const
+  RAJA_HOST_DEVICE RAJA_INLINE typename std::
+      enable_if<!detail::has_vector_index<Args...>::value, value_type &>::type
+      operator()(Args... args) const
   {
     auto idx = stripIndexType(layout(args...));
     return data[idx];
   }
+
+  // access with a vector_index, from loop bodies run by vector_exec
+  template <typename... Args>
+  RAJA_INLINE typename std::enable_if<
+      detail::has_vector_index<Args...>::value,
+      vector_ref<value_type, detail::vector_index_width<Args...>::value>>::type
+  operator()(Args... args) const
+  {
+    return detail::make_vector_ref<
+        detail::vector_index_width<Args...>::value,
+        value_type>(data, layout, args...);
+  }
 };
 
 template <typename ValueType,
@@ -18,12 +18,17 @@
 #ifndef RAJA_BASIC_MEMPOOL_HPP
 #define RAJA_BASIC_MEMPOOL_HPP
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <list>
 #include <map>
+#include <memory>
+#include <vector>
 
 #include "RAJA/util/align.hpp"
 #include "RAJA/util/mutex.hpp"
@@ -404,6 +409,495 @@ private:
   allocator_t m_alloc;
 };
 
+namespace detail
+{
+
+//! size classes are the powers of two from 16 B to 32 KiB
+static const int min_class_shift = 4;
+static const int max_class_shift = 15;
+static const int num_size_classes = max_class_shift - min_class_shift + 1;
+
+//! blocks of one size class are carved from naturally aligned 64 KiB slabs
+static const int slab_shift = 16;
+static const size_t slab_bytes = size_t(1) << slab_shift;
+
+/*!
+ * \brief size class of a request, or -1 if it is too large for the caches;
+ * the block size of class c is 2^(c + min_class_shift)
+ */
+inline int size_class(size_t nbytes, size_t alignment)
+{
+  size_t size = std::max(std::max(nbytes, alignment), size_t(1));
+  if (size > (size_t(1) << max_class_shift)) {
+    return -1;
+  }
+  if (size <= (size_t(1) << min_class_shift)) {
+    return 0;
+  }
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<int>(sizeof(unsigned long long) * 8 -
+                          __builtin_clzll(static_cast<unsigned long long>(
+                              size - 1))) -
+         min_class_shift;
+#else
+  int shift = min_class_shift;
+  while ((size_t(1) << shift) < size) {
+    ++shift;
+  }
+  return shift - min_class_shift;
+#endif
+}
+
+//! number of blocks moved between a thread cache and the shared lists
+inline size_t class_batch(int c)
+{
+  size_t batch = (size_t(16) * 1024) >> (c + min_class_shift);
+  return std::min(std::max(batch, size_t(2)), size_t(256));
+}
+
+//! free blocks are chained through their first word
+inline void*& next_block(void* block) { return *static_cast<void**>(block); }
+
+
+/*! \class ThreadSlot
+ ******************************************************************************
+ *
+ * \brief  ThreadSlot gives every live thread a small integer id, used to
+ * index per-thread caches; ids of exited threads are handed out again
+ *
+ ******************************************************************************
+ */
+class ThreadSlot
+{
+public:
+  static int get()
+  {
+    static thread_local holder h;
+    return h.slot;
+  }
+
+private:
+  struct registry {
+#if defined(RAJA_ENABLE_OPENMP)
+    omp::mutex mutex;
+#endif
+    std::vector<int> free_slots;
+    int next_slot = 0;
+  };
+
+  static registry& get_registry()
+  {
+    static registry r;
+    return r;
+  }
+
+  struct holder {
+    int slot;
+
+    holder()
+    {
+      registry& r = get_registry();
+#if defined(RAJA_ENABLE_OPENMP)
+      lock_guard<omp::mutex> lock(r.mutex);
+#endif
+      if (r.free_slots.empty()) {
+        slot = r.next_slot++;
+      } else {
+        slot = r.free_slots.back();
+        r.free_slots.pop_back();
+      }
+    }
+
+    ~holder()
+    {
+      registry& r = get_registry();
+#if defined(RAJA_ENABLE_OPENMP)
+      lock_guard<omp::mutex> lock(r.mutex);
+#endif
+      r.free_slots.push_back(slot);
+    }
+  };
+};
+
+
+/*! \class SlabMap
+ ******************************************************************************
+ *
+ * \brief  SlabMap is a two level table from slab address to size class, so
+ * MemPool::free can find the class of a block without a search or a lock
+ *
+ * Leaves are added under the owning pool's lock and never removed until
+ * clear(); lookups are lock free.
+ *
+ ******************************************************************************
+ */
+class SlabMap
+{
+public:
+  static const int address_bits = 48;
+  static const int leaf_bits = 16;
+  static const int root_bits = address_bits - slab_shift - leaf_bits;
+
+  SlabMap() : m_root(new std::atomic<unsigned char*>[size_t(1) << root_bits])
+  {
+    for (size_t i = 0; i < (size_t(1) << root_bits); ++i) {
+      m_root[i].store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  SlabMap(SlabMap const&) = delete;
+  SlabMap& operator=(SlabMap const&) = delete;
+
+  ~SlabMap() { clear(); }
+
+  //! true if [begin, end) can be described by the map
+  static bool covers(void* begin, void* end)
+  {
+    return (reinterpret_cast<uintptr_t>(begin) >> address_bits) == 0 &&
+           (reinterpret_cast<uintptr_t>(end) >> address_bits) == 0;
+  }
+
+  //! make sure leaves exist for the slabs in [begin, end)
+  void reserve(void* begin, void* end)
+  {
+    uintptr_t first = reinterpret_cast<uintptr_t>(begin) >> slab_shift;
+    uintptr_t last = (reinterpret_cast<uintptr_t>(end) - 1) >> slab_shift;
+    for (uintptr_t r = first >> leaf_bits; r <= (last >> leaf_bits); ++r) {
+      if (m_root[r].load(std::memory_order_relaxed) == nullptr) {
+        unsigned char* leaf = new unsigned char[size_t(1) << leaf_bits]();
+        m_root[r].store(leaf, std::memory_order_release);
+      }
+    }
+  }
+
+  //! record the size class of the slab at slab; class -1 unregisters it
+  void set(void* slab, int c)
+  {
+    uintptr_t idx = reinterpret_cast<uintptr_t>(slab) >> slab_shift;
+    unsigned char* leaf =
+        m_root[idx >> leaf_bits].load(std::memory_order_relaxed);
+    leaf[idx & ((uintptr_t(1) << leaf_bits) - 1)] =
+        static_cast<unsigned char>(c + 1);
+  }
+
+  //! size class of the block at ptr, or -1 if ptr is not in a slab
+  int get(const void* ptr) const
+  {
+    uintptr_t addr = reinterpret_cast<uintptr_t>(ptr);
+    if ((addr >> address_bits) != 0) {
+      return -1;
+    }
+    uintptr_t idx = addr >> slab_shift;
+    unsigned char* leaf =
+        m_root[idx >> leaf_bits].load(std::memory_order_acquire);
+    if (leaf == nullptr) {
+      return -1;
+    }
+    return static_cast<int>(leaf[idx & ((uintptr_t(1) << leaf_bits) - 1)]) - 1;
+  }
+
+  void clear()
+  {
+    for (size_t i = 0; i < (size_t(1) << root_bits); ++i) {
+      delete[] m_root[i].exchange(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+private:
+  std::unique_ptr<std::atomic<unsigned char*>[]> m_root;
+};
+
+} /* end namespace detail */
+
+
+/*! \class ThreadCachingMemPool
+ ******************************************************************************
+ *
+ * \brief  ThreadCachingMemPool is a drop-in alternative to MemPool for
+ * allocators returning host accessible memory, built for many threads
+ * allocating and freeing small blocks concurrently
+ *
+ * Requests up to 32 KiB are rounded up to a power of two size class. Each
+ * thread keeps a free list per class and a bump region in a slab of that
+ * class, so the common malloc/free touches only thread-private state. When
+ * a thread cache grows past a high-water mark it returns a batch of blocks
+ * to a lock-free shared list for the class; a thread whose cache is empty
+ * takes the whole shared list before falling back to carving a new slab
+ * from the shared arena, which is the only step that takes the lock.
+ * Larger requests are forwarded to an embedded MemPool.
+ *
+ * Freed blocks hold their free list links, so the pool must not be used with
+ * device-only allocators such as cuda::DeviceAllocator.
+ *
+ * using host_mempool_type =
+ *     basic_mempool::ThreadCachingMemPool<basic_mempool::generic_allocator>;
+ *
+ ******************************************************************************
+ */
+template <typename allocator_t>
+class ThreadCachingMemPool
+{
+public:
+  using allocator_type = allocator_t;
+
+  static inline ThreadCachingMemPool<allocator_t>& getInstance()
+  {
+    static ThreadCachingMemPool<allocator_t> pool{};
+    return pool;
+  }
+
+  static const size_t default_default_arena_size =
+      MemPool<allocator_t>::default_default_arena_size;
+
+  //! number of threads with a private cache; others share a locked cache
+  static const int max_thread_caches = 256;
+
+  ThreadCachingMemPool()
+      : m_caches(new thread_cache[max_thread_caches + 1]),
+        m_arena_cursor(nullptr),
+        m_arena_end(nullptr),
+        m_default_arena_size(default_default_arena_size)
+  {
+    for (int c = 0; c < detail::num_size_classes; ++c) {
+      m_shared[c].store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  ~ThreadCachingMemPool()
+  {
+    // like MemPool, leave the arenas alone at static destruction
+  }
+
+  ThreadCachingMemPool(ThreadCachingMemPool const&) = delete;
+  ThreadCachingMemPool& operator=(ThreadCachingMemPool const&) = delete;
+
+  //! release all memory; no allocations may be live and no thread may be
+  //! using the pool concurrently
+  void free_chunks()
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    for (int t = 0; t <= max_thread_caches; ++t) {
+      m_caches[t] = thread_cache{};
+    }
+    for (int c = 0; c < detail::num_size_classes; ++c) {
+      m_shared[c].store(nullptr, std::memory_order_relaxed);
+    }
+    m_slab_map.clear();
+    while (!m_arenas.empty()) {
+      m_alloc.free(m_arenas.front());
+      m_arenas.pop_front();
+    }
+    m_arena_cursor = m_arena_end = nullptr;
+    m_large.free_chunks();
+  }
+
+  size_t arena_size()
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    return m_default_arena_size;
+  }
+
+  size_t arena_size(size_t new_size)
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    size_t prev_size = m_default_arena_size;
+    m_default_arena_size = new_size;
+    m_large.arena_size(new_size);
+    return prev_size;
+  }
+
+  template <typename T>
+  T* malloc(size_t nTs, size_t alignment = alignof(T))
+  {
+    const int c = detail::size_class(nTs * sizeof(T), alignment);
+    if (c < 0) {
+      return m_large.template malloc<T>(nTs, alignment);
+    }
+
+    const int slot = detail::ThreadSlot::get();
+    void* ptr = nullptr;
+    if (slot < max_thread_caches) {
+      ptr = cache_get(m_caches[slot].bins[c], c);
+    } else {
+#if defined(RAJA_ENABLE_OPENMP)
+      lock_guard<omp::mutex> lock(m_overflow_mutex);
+#endif
+      ptr = cache_get(m_caches[max_thread_caches].bins[c], c);
+    }
+
+    if (ptr == nullptr) {
+      return m_large.template malloc<T>(nTs, alignment);
+    }
+    return static_cast<T*>(ptr);
+  }
+
+  void free(const void* cptr)
+  {
+    if (cptr == nullptr) {
+      return;
+    }
+    void* ptr = const_cast<void*>(cptr);
+
+    const int c = m_slab_map.get(ptr);
+    if (c < 0) {
+      m_large.free(ptr);
+      return;
+    }
+
+    const int slot = detail::ThreadSlot::get();
+    if (slot < max_thread_caches) {
+      cache_put(m_caches[slot].bins[c], c, ptr);
+    } else {
+#if defined(RAJA_ENABLE_OPENMP)
+      lock_guard<omp::mutex> lock(m_overflow_mutex);
+#endif
+      cache_put(m_caches[max_thread_caches].bins[c], c, ptr);
+    }
+  }
+
+private:
+  //! per-thread state for one size class
+  struct cache_bin {
+    void* head = nullptr;
+    size_t count = 0;
+    char* bump = nullptr;
+    char* bump_end = nullptr;
+  };
+
+  struct thread_cache {
+    cache_bin bins[detail::num_size_classes];
+    // keep neighbouring threads' caches off each other's cache lines
+    char pad[64];
+  };
+
+  void* cache_get(cache_bin& bin, int c)
+  {
+    const size_t block_bytes = size_t(1) << (c + detail::min_class_shift);
+
+    if (bin.head == nullptr) {
+      // take everything other threads have returned for this class
+      void* list = m_shared[c].exchange(nullptr, std::memory_order_acquire);
+      size_t count = 0;
+      for (void* b = list; b != nullptr; b = detail::next_block(b)) {
+        ++count;
+      }
+      bin.head = list;
+      bin.count = count;
+    }
+
+    if (bin.head != nullptr) {
+      void* ptr = bin.head;
+      bin.head = detail::next_block(ptr);
+      --bin.count;
+      return ptr;
+    }
+
+    if (bin.bump == bin.bump_end) {
+      char* slab = static_cast<char*>(get_slab(c));
+      if (slab == nullptr) {
+        return nullptr;
+      }
+      bin.bump = slab;
+      bin.bump_end = slab + detail::slab_bytes;
+    }
+
+    void* ptr = bin.bump;
+    bin.bump += block_bytes;
+    return ptr;
+  }
+
+  void cache_put(cache_bin& bin, int c, void* ptr)
+  {
+    detail::next_block(ptr) = bin.head;
+    bin.head = ptr;
+    ++bin.count;
+
+    const size_t batch = detail::class_batch(c);
+    if (bin.count >= 2 * batch) {
+      // detach a batch from the front and push it on the shared list
+      void* first = bin.head;
+      void* last = first;
+      for (size_t i = 1; i < batch; ++i) {
+        last = detail::next_block(last);
+      }
+      bin.head = detail::next_block(last);
+      bin.count -= batch;
+
+      void* old = m_shared[c].load(std::memory_order_relaxed);
+      do {
+        detail::next_block(last) = old;
+      } while (!m_shared[c].compare_exchange_weak(old,
+                                                  first,
+                                                  std::memory_order_release,
+                                                  std::memory_order_relaxed));
+    }
+  }
+
+  //! carve a new slab for class c from the shared arena
+  void* get_slab(int c)
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    if (static_cast<size_t>(m_arena_end - m_arena_cursor) <
+        detail::slab_bytes) {
+      const size_t nslabs =
+          std::max(m_default_arena_size / detail::slab_bytes, size_t(1));
+      // one extra slab of room to align the first slab
+      const size_t alloc_size = (nslabs + 1) * detail::slab_bytes;
+      void* arena_ptr = m_alloc.malloc(alloc_size);
+      if (arena_ptr == nullptr) {
+        return nullptr;
+      }
+      char* end = static_cast<char*>(arena_ptr) + alloc_size;
+      if (!detail::SlabMap::covers(arena_ptr, end)) {
+        m_alloc.free(arena_ptr);
+        return nullptr;
+      }
+      m_arenas.push_front(arena_ptr);
+
+      uintptr_t addr = reinterpret_cast<uintptr_t>(arena_ptr);
+      uintptr_t aligned =
+          (addr + detail::slab_bytes - 1) & ~uintptr_t(detail::slab_bytes - 1);
+      m_arena_cursor = reinterpret_cast<char*>(aligned);
+      m_arena_end = m_arena_cursor + nslabs * detail::slab_bytes;
+      m_slab_map.reserve(m_arena_cursor, m_arena_end);
+    }
+
+    char* slab = m_arena_cursor;
+    m_arena_cursor += detail::slab_bytes;
+    m_slab_map.set(slab, c);
+    return slab;
+  }
+
+#if defined(RAJA_ENABLE_OPENMP)
+  omp::mutex m_mutex;
+  omp::mutex m_overflow_mutex;
+#endif
+
+  std::unique_ptr<thread_cache[]> m_caches;
+  std::atomic<void*> m_shared[detail::num_size_classes];
+  detail::SlabMap m_slab_map;
+
+  std::list<void*> m_arenas;
+  char* m_arena_cursor;
+  char* m_arena_end;
+  size_t m_default_arena_size;
+  allocator_t m_alloc;
+
+  MemPool<allocator_t> m_large;
+};
+
 //! example allocator for basic_mempool using malloc/free
 struct generic_allocator {
 
@@ -0,0 +1,124 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining division by a run-time constant with a
+ *          precomputed multiplier and shift.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_fast_divide_HPP
+#define RAJA_util_fast_divide_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! number of bits needed to hold x
+RAJA_HOST_DEVICE constexpr int bit_width(std::uint64_t x)
+{
+  return x == 0 ? 0 : 1 + bit_width(x >> 1);
+}
+
+#if !defined(__SIZEOF_INT128__)
+//! floor(2^k / d) by long division, with q and r the quotient and
+//! remainder of the bits done so far
+RAJA_HOST_DEVICE constexpr std::uint64_t pow2_div(int k,
+                                                  std::uint64_t d,
+                                                  std::uint64_t q,
+                                                  std::uint64_t r)
+{
+  return k == 0 ? q
+                : pow2_div(k - 1,
+                           d,
+                           2 * q + (2 * r >= d ? 1 : 0),
+                           2 * r >= d ? 2 * r - d : 2 * r);
+}
+#endif
+
+/*!
+ * \brief Divides non-negative integers below 2^63 by a fixed divisor d
+ *        with a multiply and a shift.
+ *
+ * With s = ceil(log2(d)) and m = floor(2^(63+s) / d) + 1, the quotient of
+ * any n < 2^63 is (n * m) >> (63 + s) (Granlund and Montgomery, 1994). m
+ * fits in 64 bits, so only the high word of a 64x64-bit product is needed.
+ * The divisor must be at least one.
+ */
+struct fast_divider {
+  std::uint64_t mul;
+  int shift;
+
+  RAJA_HOST_DEVICE constexpr fast_divider() : mul(0), shift(0) {}
+
+  RAJA_HOST_DEVICE constexpr explicit fast_divider(std::uint64_t d)
+      : mul(d == 1 ? 0 : magic(d, bit_width(d - 1))),
+        shift(d == 1 ? 0 : bit_width(d - 1))
+  {
+  }
+
+  //! n / d for 0 <= n < 2^63
+  template <typename T>
+  RAJA_HOST_DEVICE RAJA_INLINE T divide(T n) const
+  {
+    if (shift == 0) return n;
+    const std::uint64_t un = static_cast<std::uint64_t>(n);
+    return static_cast<T>(mul_high(un, mul) >> (shift - 1));
+  }
+
+private:
+  RAJA_HOST_DEVICE static constexpr std::uint64_t magic(std::uint64_t d,
+                                                        int s)
+  {
+#if defined(__SIZEOF_INT128__)
+    return static_cast<std::uint64_t>(
+               (static_cast<unsigned __int128>(1) << (63 + s)) / d)
+           + 1;
+#else
+    return pow2_div(63 + s, d, 0, 1) + 1;
+#endif
+  }
+
+  RAJA_HOST_DEVICE static RAJA_INLINE std::uint64_t mul_high(std::uint64_t a,
+                                                             std::uint64_t b)
+  {
+#if defined(__CUDA_ARCH__)
+    return __umul64hi(a, b);
+#elif defined(__SIZEOF_INT128__)
+    return static_cast<std::uint64_t>(
+        (static_cast<unsigned __int128>(a) * b) >> 64);
+#else
+    const std::uint64_t a_lo = a & 0xffffffffu, a_hi = a >> 32;
+    const std::uint64_t b_lo = b & 0xffffffffu, b_hi = b >> 32;
+    const std::uint64_t lo_lo = a_lo * b_lo;
+    const std::uint64_t hi_lo = a_hi * b_lo;
+    const std::uint64_t lo_hi = a_lo * b_hi;
+    const std::uint64_t cross =
+        (lo_lo >> 32) + (hi_lo & 0xffffffffu) + lo_hi;
+    return a_hi * b_hi + (hi_lo >> 32) + (cross >> 32);
+#endif
+  }
+};
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,90 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file for NUMA-aware allocation by parallel first
+ *          touch.
+ *
+ *          Operating systems place a page on the NUMA node of the thread
+ *          that first writes it. Initializing an array with the execution
+ *          policy of the loops that later use it puts every page next to
+ *          the thread that works on it.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_first_touch_HPP
+#define RAJA_util_first_touch_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+//! alignment of first-touch allocations, so no page is shared with others
+static constexpr size_t first_touch_alignment = 4096;
+
+/*!
+ * \brief Initialize ptr[0, n) to value with forall over RangeSegment(0, n)
+ * under ExecPolicy.
+ *
+ * Pages are placed where the threads of ExecPolicy run, so use the policy
+ * of the loops that read the array: a static OpenMP schedule such as
+ * omp_parallel_for_static<ChunkSize> or
+ * omp_parallel_for_affinity_static<ChunkSize>, with threads bound to cores
+ * (OMP_PROC_BIND). A chunk should span at least a page.
+ */
+template <typename T, typename ExecPolicy>
+void first_touch(ExecPolicy&& p, T* ptr, Index_type n, const T& value = T())
+{
+  static_assert(std::is_copy_constructible<T>::value,
+                "first_touch needs a copy constructible type");
+  forall(std::forward<ExecPolicy>(p),
+         RangeSegment(0, n),
+         [=](Index_type i) { new (ptr + i) T(value); });
+}
+
+/*!
+ * \brief Allocate n values of T and first touch them with ExecPolicy.
+ *
+ * Free with free_aligned.
+ */
+template <typename T, typename ExecPolicy>
+T* allocate_first_touch(ExecPolicy&& p,
+                        Index_type n,
+                        const T& value = T(),
+                        size_t alignment = first_touch_alignment)
+{
+  static_assert(std::is_trivially_destructible<T>::value,
+                "allocate_first_touch memory is released with free_aligned, "
+                "which runs no destructors");
+  T* ptr = allocate_aligned_type<T>(alignment, n * sizeof(T));
+  if (ptr != nullptr) {
+    first_touch(std::forward<ExecPolicy>(p), ptr, n, value);
+  }
+  return ptr;
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
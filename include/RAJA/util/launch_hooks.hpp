@@ -0,0 +1,213 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a registry of callbacks run before and
+ *          after every forall and kernel launch.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_launch_hooks_HPP
+#define RAJA_util_launch_hooks_HPP
+
+#include "RAJA/config.hpp"
+
+#include <atomic>
+#include <string>
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/mutex.hpp"
+
+namespace RAJA
+{
+namespace util
+{
+
+//! the pattern that triggered a launch hook
+enum class launch_kind { forall, kernel };
+
+/*!
+ * \brief Description of a launch, passed to the launch hooks.
+ *
+ * policy points at a string with static storage naming the policy type;
+ * object files and shared libraries may each hold their own copy, so
+ * compare it by contents when pointers differ. launch_policy_name() turns
+ * it into a readable type name.
+ */
+struct launch_info {
+  launch_kind kind;
+  const char* policy;
+};
+
+//! signature of pre- and post-launch hooks
+using launch_hook = void (*)(const launch_info&, void* user_data);
+
+//! most hook pairs that can be registered at once
+static constexpr int max_launch_hooks = 16;
+
+namespace detail
+{
+
+struct launch_hook_entry {
+  std::atomic<bool> active{false};
+  launch_hook pre = nullptr;
+  launch_hook post = nullptr;
+  void* user_data = nullptr;
+};
+
+struct launch_hook_registry {
+#if defined(RAJA_ENABLE_OPENMP)
+  omp::mutex mutex;
+#endif
+  //! number of registered hook pairs, checked before each launch
+  std::atomic<int> count{0};
+  launch_hook_entry entries[max_launch_hooks];
+};
+
+inline launch_hook_registry& get_launch_hooks()
+{
+  static launch_hook_registry r;
+  return r;
+}
+
+/*!
+ * Returns a string naming T, with static storage unique to T.
+ *
+ * Built from the function signature so no RTTI is needed; the type is
+ * cut out of it by launch_policy_name().
+ */
+template <typename T>
+const char* policy_signature()
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return __PRETTY_FUNCTION__;
+#elif defined(_MSC_VER)
+  return __FUNCSIG__;
+#else
+  return "unknown policy";
+#endif
+}
+
+template <typename ExecutionPolicy>
+RAJA_INLINE launch_info make_launch_info(launch_kind kind)
+{
+  using policy = typename std::decay<ExecutionPolicy>::type;
+  return launch_info{kind, policy_signature<policy>()};
+}
+
+/*!
+ * Run the pre-launch hooks for a launch of ExecutionPolicy.
+ *
+ * A single relaxed load when no hooks are registered.
+ */
+template <typename ExecutionPolicy>
+RAJA_INLINE void callPreLaunchHooks(launch_kind kind)
+{
+  launch_hook_registry& r = get_launch_hooks();
+  if (r.count.load(std::memory_order_relaxed) == 0) return;
+
+  const launch_info info = make_launch_info<ExecutionPolicy>(kind);
+  for (auto& e : r.entries) {
+    if (e.active.load(std::memory_order_acquire) && e.pre) {
+      e.pre(info, e.user_data);
+    }
+  }
+}
+
+//! Run the post-launch hooks, in the reverse order of the pre-launch hooks.
+template <typename ExecutionPolicy>
+RAJA_INLINE void callPostLaunchHooks(launch_kind kind)
+{
+  launch_hook_registry& r = get_launch_hooks();
+  if (r.count.load(std::memory_order_relaxed) == 0) return;
+
+  const launch_info info = make_launch_info<ExecutionPolicy>(kind);
+  for (int i = max_launch_hooks - 1; i >= 0; --i) {
+    launch_hook_entry& e = r.entries[i];
+    if (e.active.load(std::memory_order_acquire) && e.post) {
+      e.post(info, e.user_data);
+    }
+  }
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Register a pair of hooks run around every forall and kernel launch.
+ *
+ * Either hook may be null. Hooks run on the thread that launches, before
+ * the launch starts and after it returns. Returns an id for
+ * remove_launch_hooks.
+ */
+inline int add_launch_hooks(launch_hook pre,
+                            launch_hook post,
+                            void* user_data = nullptr)
+{
+  detail::launch_hook_registry& r = detail::get_launch_hooks();
+#if defined(RAJA_ENABLE_OPENMP)
+  lock_guard<omp::mutex> lock(r.mutex);
+#endif
+  for (int id = 0; id < max_launch_hooks; ++id) {
+    detail::launch_hook_entry& e = r.entries[id];
+    if (!e.active.load(std::memory_order_relaxed)) {
+      e.pre = pre;
+      e.post = post;
+      e.user_data = user_data;
+      e.active.store(true, std::memory_order_release);
+      r.count.fetch_add(1, std::memory_order_relaxed);
+      return id;
+    }
+  }
+  RAJA_ABORT_OR_THROW("RAJA::util::add_launch_hooks: too many hooks");
+  return -1;
+}
+
+/*!
+ * \brief Remove the hooks registered under id.
+ *
+ * Must not race with launches on other threads that may be running them.
+ */
+inline void remove_launch_hooks(int id)
+{
+  if (id < 0 || id >= max_launch_hooks) return;
+  detail::launch_hook_registry& r = detail::get_launch_hooks();
+#if defined(RAJA_ENABLE_OPENMP)
+  lock_guard<omp::mutex> lock(r.mutex);
+#endif
+  detail::launch_hook_entry& e = r.entries[id];
+  if (e.active.load(std::memory_order_relaxed)) {
+    e.active.store(false, std::memory_order_release);
+    r.count.fetch_sub(1, std::memory_order_relaxed);
+  }
+}
+
+//! Readable policy type name from launch_info::policy.
+inline std::string launch_policy_name(const char* policy)
+{
+  std::string sig(policy);
+#if defined(__GNUC__) || defined(__clang__)
+  // "... policy_signature() [with T = <type>]" or "[T = <type>]"
+  const std::string::size_type begin = sig.find("T = ");
+  if (begin == std::string::npos) return sig;
+  std::string::size_type end = sig.find_first_of(";]", begin);
+  if (end == std::string::npos) end = sig.size();
+  return sig.substr(begin + 4, end - begin - 4);
+#else
+  return sig;
+#endif
+}
+
+}  // namespace util
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
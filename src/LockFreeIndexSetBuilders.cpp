@@ -110,85 +110,43 @@ void buildLockFreeBlockIndexset(
     }
   } else { /* 3d mesh */
 
-    // this requires dependence graph - commenting out for now
-
-    /* Need at least 3 full planes per thread */
-    /* and at least one segment per plane */
-    /*
-        const int segmentsPerThread = 2;
-        int rowsPerSegment = slowDim / (segmentsPerThread * numThreads);
-        if (rowsPerSegment == 0) {
-          // printf("%d %d\n", 0, fastDim*midDim*slowDim) ;
-          iset.push_back(RAJA::RangeSegment(0, fastDim * midDim * slowDim));
-          printf(
-              "Failure to create lockfree indexset - not enough rows per "
-              "segment\n");
-          exit(-1);
-        } else {
-    */
-    /* This just sets up the schedule -- a truly safe */
-    /* execution of this schedule would require a check */
-    /* for completion of dependent threads before execution. */
-
-    /* We might want to force one thread if the */
-    /* profitability ratio is really bad, but for */
-    /* now use the brain dead approach. */
-    /*
-          for (int lane = 0; lane < segmentsPerThread; ++lane) {
-            for (int i = 0; i < numThreads; ++i) {
-              Index_type startPlane = i * slowDim / numThreads;
-              Index_type endPlane = (i + 1) * slowDim / numThreads;
-              Index_type start = startPlane * fastDim * midDim;
-              Index_type end = endPlane * fastDim * midDim;
-              Index_type len = end - start;
-              // printf("%d %d\n", start + (lane  )*len/segmentsPerThread,
-              //                   start + (lane+1)*len/segmentsPerThread  );
-              iset.push_back(
-                  RAJA::RangeSegment(start + (lane)*len / segmentsPerThread,
-                                     start + (lane + 1) * len /
-       segmentsPerThread));
-            }
-          }
-    */
+    /* Split the slowDim planes into slabs, two per thread. A zone in */
+    /* plane k touches nodes in planes k and k+1, so only neighboring */
+    /* slabs conflict. Even slabs never neighbor each other and run */
+    /* first; each odd slab waits for the two even slabs around it. */
+    const int segmentsPerThread = 2;
+    Index_type numSlabs = segmentsPerThread * numThreads;
+    if (numSlabs > slowDim) {
+      numSlabs = slowDim;
+    }
+
+    Index_type planeSize = fastDim * midDim;
+    for (int lane = 0; lane < segmentsPerThread; ++lane) {
+      for (Index_type i = lane; i < numSlabs; i += segmentsPerThread) {
+        Index_type startPlane = i * slowDim / numSlabs;
+        Index_type endPlane = (i + 1) * slowDim / numSlabs;
+        // printf("%d %d\n", startPlane * planeSize, endPlane * planeSize) ;
+        iset.push_back(RAJA::RangeSegment(startPlane * planeSize,
+                                          endPlane * planeSize));
+      }
+    }
+
     /* Allocate dependency graph structures for index set segments */
-    /*
-          iset.initDependencyGraph();
-
-          if (segmentsPerThread == 1) {
-    */
-    /* This dependency graph should impose serialization */
-    /*
-            for (int i = 0; i < numThreads; ++i) {
-              RAJA::DepGraphNode* task =
-       iset.getSegmentInfo(i)->getDepGraphNode(); task->semaphoreValue() = ((i
-       == 0) ? 0 : 1); task->semaphoreReloadValue() = ((i == 0) ? 0 : 1); if (i
-       != numThreads - 1) { task->numDepTasks() = 1; task->depTaskNum(0) = i +
-       1;
-              }
-            }
-          } else {
-    */
-    /* This dependency graph relies on omp schedule(static, 1) */
-    /* but allows a minimumal set of dependent tasks be used */
-    /*
-            int borderSeg = numThreads * (segmentsPerThread - 1);
-            for (int i = 1; i < numThreads; ++i) {
-              RAJA::DepGraphNode* task =
-       iset.getSegmentInfo(i)->getDepGraphNode(); task->semaphoreReloadValue() =
-       1; task->numDepTasks() = 1; task->depTaskNum(0) = borderSeg + i - 1;
-
-              RAJA::DepGraphNode* border_task =
-                  iset.getSegmentInfo(borderSeg + i - 1)->getDepGraphNode();
-              border_task->semaphoreValue() = 1;
-              border_task->semaphoreReloadValue() = 1;
-              border_task->numDepTasks() = 1;
-              border_task->depTaskNum(0) = i;
-            }
-          }
+    iset.initDependencyGraph();
+
+    /* Even slab 2j is segment j; odd slab 2j+1 is segment numEven + j */
+    Index_type numEven = (numSlabs + 1) / 2;
+    for (Index_type j = 0; j < numEven; ++j) {
+      RAJA::DepGraphNode* task = iset.getSegmentDepGraphNode(j);
+      if (j > 0) {
+        task->addDepTask(numEven + j - 1);
+      }
+      if (2 * j + 1 < numSlabs) {
+        task->addDepTask(numEven + j);
+      }
+    }
 
-          iset.finalizeDependencyGraph();
-        }
-    */
+    iset.finalizeDependencyGraph();
   }
 
   /* Print the dependency schedule for segments */
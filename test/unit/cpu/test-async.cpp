@@ -0,0 +1,182 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Tests for asynchronous host execution with resources and events.
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#if defined(RAJA_ENABLE_THREADS)
+
+TEST(Async, LaunchesOnOneResourceRunInOrder)
+{
+  const RAJA::Index_type n = 1000;
+  std::vector<int> a(n, 0);
+  int* pa = a.data();
+
+  RAJA::host_resource res;
+  for (int step = 0; step < 10; ++step) {
+    RAJA::forall<RAJA::seq_exec>(res,
+                                 RAJA::RangeSegment(0, n),
+                                 [=](RAJA::Index_type i) {
+                                   pa[i] = pa[i] * 2 + step;
+                                 });
+  }
+  res.wait();
+
+  int expected = 0;
+  for (int step = 0; step < 10; ++step) {
+    expected = expected * 2 + step;
+  }
+  for (auto v : a) {
+    ASSERT_EQ(expected, v);
+  }
+}
+
+TEST(Async, EventsOrderWorkAcrossResources)
+{
+  const RAJA::Index_type n = 4096;
+  std::vector<int> a(n, 0), b(n, 0);
+  int* pa = a.data();
+  int* pb = b.data();
+
+  RAJA::host_resource first, second;
+  std::atomic<bool> release{false};
+  std::atomic<bool>* prelease = &release;
+
+  // hold the first resource until the second has queued its dependent loop
+  first.launch([=]() {
+    while (!prelease->load()) {
+      std::this_thread::yield();
+    }
+  });
+  RAJA::event filled = RAJA::forall<RAJA::loop_exec>(
+      first, RAJA::RangeSegment(0, n), [=](RAJA::Index_type i) {
+        pa[i] = static_cast<int>(i);
+      });
+  second.wait_for(filled);
+  RAJA::event copied = RAJA::forall<RAJA::loop_exec>(
+      second, RAJA::RangeSegment(0, n), [=](RAJA::Index_type i) {
+        pb[i] = pa[i] + 1;
+      });
+
+  ASSERT_FALSE(copied.query());
+  release.store(true);
+  copied.wait();
+  ASSERT_TRUE(filled.query());
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    ASSERT_EQ(i + 1, b[i]);
+  }
+}
+
+TEST(Async, IndependentLaunchesOverlap)
+{
+  RAJA::host_resource first, second;
+  std::atomic<int> arrived{0};
+  std::atomic<int>* parrived = &arrived;
+
+  // each loop waits for the other to start, which only finishes if both
+  // resources run at the same time
+  auto meet = [=](RAJA::Index_type) {
+    parrived->fetch_add(1);
+    const auto give_up =
+        std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (parrived->load() < 2 &&
+           std::chrono::steady_clock::now() < give_up) {
+      std::this_thread::yield();
+    }
+  };
+  RAJA::event e1 =
+      RAJA::forall<RAJA::seq_exec>(first, RAJA::RangeSegment(0, 1), meet);
+  RAJA::event e2 =
+      RAJA::forall<RAJA::seq_exec>(second, RAJA::RangeSegment(0, 1), meet);
+  e1.wait();
+  e2.wait();
+  ASSERT_EQ(2, arrived.load());
+}
+
+TEST(Async, ReductionsAreCompleteAtTheEvent)
+{
+  const RAJA::Index_type n = 10000;
+  RAJA::host_resource res;
+
+  RAJA::ReduceSum<RAJA::seq_reduce, long> sum(0);
+  RAJA::event done = RAJA::forall<RAJA::seq_exec>(
+      res, RAJA::RangeSegment(0, n), [=](RAJA::Index_type i) { sum += i; });
+  done.wait();
+  ASSERT_EQ(n * (n - 1) / 2, sum.get());
+
+  using Max = RAJA::ReduceMax<RAJA::threads_reduce, long>;
+  Max max(-1);
+  RAJA::forall<RAJA::threads_for_exec>(
+      res,
+      RAJA::RangeSegment(0, n),
+      RAJA::reduce_params(max),
+      [=](RAJA::Index_type i, Max::param_type& m) { m.max(i % 77); })
+      .wait();
+  ASSERT_EQ(76, max.get());
+}
+
+TEST(Async, Kernel)
+{
+  const RAJA::Index_type n = 50;
+  std::vector<int> count(n * n, 0);
+  int* c = count.data();
+
+  using Pol = RAJA::KernelPolicy<RAJA::statement::For<
+      1,
+      RAJA::threads_for_exec,
+      RAJA::statement::For<0, RAJA::seq_exec, RAJA::statement::Lambda<0>>>>;
+
+  RAJA::host_resource res;
+  RAJA::kernel<Pol>(res,
+                    RAJA::make_tuple(RAJA::RangeSegment(0, n),
+                                     RAJA::RangeSegment(0, n)),
+                    [=](RAJA::Index_type i, RAJA::Index_type j) {
+                      ++c[j * n + i];
+                    })
+      .wait();
+  for (auto v : count) {
+    ASSERT_EQ(1, v);
+  }
+}
+
+TEST(Async, ExceptionsAreRethrownByWait)
+{
+  RAJA::host_resource res;
+  RAJA::event failed = res.launch([]() { throw std::runtime_error("boom"); });
+  int after = 0;
+  int* pafter = &after;
+  RAJA::event next = RAJA::forall<RAJA::seq_exec>(
+      res, RAJA::RangeSegment(0, 1), [=](RAJA::Index_type) { *pafter = 1; });
+
+  ASSERT_THROW(failed.wait(), std::runtime_error);
+  // later work on the resource still runs
+  next.wait();
+  ASSERT_EQ(1, after);
+}
+
+TEST(Async, DefaultEventIsComplete)
+{
+  RAJA::event e;
+  ASSERT_TRUE(e.query());
+  e.wait();
+
+  RAJA::host_resource res;
+  res.wait_for(e);
+  res.wait();
+}
+
+#endif
@@ -0,0 +1,123 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for first-touch allocation and the
+/// affinity-stable OpenMP policy.
+///
+
+#include <cstdint>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+
+#include "gtest/gtest.h"
+
+TEST(FirstTouch, allocate)
+{
+  const RAJA::Index_type n = 100000;
+  double* a = RAJA::allocate_first_touch<double>(RAJA::seq_exec{}, n, 2.5);
+  ASSERT_NE(a, nullptr);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(a) %
+                RAJA::first_touch_alignment,
+            0u);
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    ASSERT_EQ(a[i], 2.5);
+  }
+  RAJA::free_aligned(a);
+
+  int* b = RAJA::allocate_first_touch<int>(RAJA::loop_exec{}, n);
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    ASSERT_EQ(b[i], 0);
+  }
+  RAJA::free_aligned(b);
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(FirstTouch, allocate_omp)
+{
+  const RAJA::Index_type n = 100000;
+  double* a = RAJA::allocate_first_touch<double>(
+      RAJA::omp_parallel_for_affinity_static<512>{}, n, 1.0);
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    ASSERT_EQ(a[i], 1.0);
+  }
+  RAJA::free_aligned(a);
+}
+
+// thread that ran each index of [0, n) under ExecPolicy over seg
+template <typename ExecPolicy, typename Segment>
+static std::vector<int> owners(const Segment& seg, RAJA::Index_type offset)
+{
+  std::vector<int> own(seg.size(), -1);
+  int* o = own.data();
+  RAJA::forall<ExecPolicy>(seg, [=](RAJA::Index_type i) {
+    EXPECT_EQ(o[i - offset], -1);
+    o[i - offset] = omp_get_thread_num();
+  });
+  return own;
+}
+
+TEST(AffinityStatic, matches_static_schedule)
+{
+  const RAJA::Index_type n = 10007;
+  RAJA::RangeSegment all(0, n);
+  auto stable = owners<RAJA::omp_parallel_for_affinity_static<64>>(all, 0);
+  auto plain = owners<RAJA::omp_parallel_for_static<64>>(all, 0);
+  ASSERT_TRUE(stable == plain);
+}
+
+TEST(AffinityStatic, stable_across_bounds)
+{
+  const RAJA::Index_type n = 10007;
+  const int nthreads = omp_get_max_threads();
+  auto full = owners<RAJA::omp_parallel_for_affinity_static<64>>(
+      RAJA::RangeSegment(0, n), 0);
+
+  // interior and shifted ranges map every index to the same thread
+  for (RAJA::Index_type lo : {1, 37, 64, 5000}) {
+    for (RAJA::Index_type hi : {n - 5, n}) {
+      auto part = owners<RAJA::omp_parallel_for_affinity_static<64>>(
+          RAJA::RangeSegment(lo, hi), lo);
+      for (RAJA::Index_type i = lo; i < hi; ++i) {
+        ASSERT_EQ(part[i - lo], full[i]) << lo << " " << hi << " " << i;
+        ASSERT_EQ(part[i - lo], (i / 64) % nthreads);
+      }
+    }
+  }
+
+  // negative starts and empty ranges
+  auto neg = owners<RAJA::omp_parallel_for_affinity_static<64>>(
+      RAJA::RangeSegment(-200, 100), -200);
+  for (RAJA::Index_type i = -200; i < 100; ++i) {
+    const RAJA::Index_type c = (i + 256) / 64 - 4;
+    ASSERT_EQ(neg[i + 200], ((c % nthreads) + nthreads) % nthreads);
+  }
+  auto none = owners<RAJA::omp_parallel_for_affinity_static<64>>(
+      RAJA::RangeSegment(5, 5), 5);
+  ASSERT_TRUE(none.empty());
+}
+
+TEST(AffinityStatic, list_segment)
+{
+  std::vector<RAJA::Index_type> idx;
+  for (RAJA::Index_type i = 999; i >= 0; i -= 3) {
+    idx.push_back(i);
+  }
+  RAJA::ListSegment list(idx.data(), idx.size());
+  std::vector<int> count(1000, 0);
+  int* c = count.data();
+  RAJA::forall<RAJA::omp_parallel_for_affinity_static<16>>(
+      list, [=](RAJA::Index_type i) {
+#pragma omp atomic
+        ++c[i];
+      });
+  for (RAJA::Index_type i = 0; i < 1000; ++i) {
+    ASSERT_EQ(count[i], (999 - i) % 3 == 0 ? 1 : 0);
+  }
+}
+#endif
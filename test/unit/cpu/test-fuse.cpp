@@ -0,0 +1,191 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Tests for loop fusion: RAJA::forall_fused and statement::Fuse.
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace RAJA::statement;
+
+template <typename Stmts>
+using fused_t = typename RAJA::internal::FuseStatements<Stmts>::type;
+
+// loops over the same argument and policy merge, recursively
+static_assert(
+    std::is_same<
+        fused_t<camp::list<
+            For<1, RAJA::seq_exec, For<0, RAJA::loop_exec, Lambda<0>>>,
+            For<1, RAJA::seq_exec, For<0, RAJA::loop_exec, Lambda<1>>>,
+            For<1, RAJA::seq_exec, Lambda<2>>>>,
+        camp::list<For<1,
+                       RAJA::seq_exec,
+                       For<0, RAJA::loop_exec, Lambda<0>, Lambda<1>>,
+                       Lambda<2>>>>::value,
+    "adjacent loops are fused");
+
+// different arguments, policies or an intervening statement keep loops apart
+static_assert(std::is_same<fused_t<camp::list<For<0, RAJA::seq_exec>,
+                                              For<1, RAJA::seq_exec>,
+                                              For<1, RAJA::loop_exec>,
+                                              Lambda<0>,
+                                              For<1, RAJA::loop_exec>>>,
+                           camp::list<For<0, RAJA::seq_exec>,
+                                      For<1, RAJA::seq_exec>,
+                                      For<1, RAJA::loop_exec>,
+                                      Lambda<0>,
+                                      For<1, RAJA::loop_exec>>>::value,
+              "only adjacent loops with the same argument and policy fuse");
+
+template <typename ExecPolicy>
+class ForallFused : public ::testing::Test
+{
+};
+
+using FusedPolicies = ::testing::Types<RAJA::seq_exec,
+                                       RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                       ,
+                                       RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                       ,
+                                       RAJA::tbb_for_exec
+#endif
+                                       >;
+
+TYPED_TEST_CASE(ForallFused, FusedPolicies);
+
+template <typename ExecPolicy>
+struct reduce_for {
+  using type = RAJA::seq_reduce;
+};
+#if defined(RAJA_ENABLE_OPENMP)
+template <>
+struct reduce_for<RAJA::omp_parallel_for_exec> {
+  using type = RAJA::omp_reduce;
+};
+#endif
+#if defined(RAJA_ENABLE_TBB)
+template <>
+struct reduce_for<RAJA::tbb_for_exec> {
+  using type = RAJA::tbb_reduce;
+};
+#endif
+
+// each body reads what the bodies before it wrote at the same index
+TYPED_TEST(ForallFused, ProducerConsumerChain)
+{
+  using reduce_policy = typename reduce_for<TypeParam>::type;
+
+  const RAJA::Index_type n = 1000;
+  std::vector<double> a(n, 0.0), b(n, 0.0), c(n, 0.0);
+  double* pa = a.data();
+  double* pb = b.data();
+  double* pc = c.data();
+  RAJA::ReduceSum<reduce_policy, double> total(0.0);
+
+  RAJA::forall_fused<TypeParam>(
+      RAJA::RangeSegment(0, n),
+      [=](RAJA::Index_type i) { pa[i] = 2.0 * i; },
+      [=](RAJA::Index_type i) { pb[i] = pa[i] + 1.0; },
+      [=](RAJA::Index_type i) {
+        pc[i] = pa[i] * pb[i];
+        total += pc[i];
+      });
+
+  double expected = 0.0;
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    ASSERT_EQ(2.0 * i, a[i]);
+    ASSERT_EQ(2.0 * i + 1.0, b[i]);
+    ASSERT_EQ(a[i] * b[i], c[i]);
+    expected += c[i];
+  }
+  ASSERT_EQ(expected, total.get());
+}
+
+TEST(ForallFusedSegments, SingleBodyAndListSegment)
+{
+  std::vector<RAJA::Index_type> idx = {7, 3, 11, 5};
+  RAJA::TypedListSegment<RAJA::Index_type> list(idx.data(), idx.size());
+  std::vector<int> order;
+  std::vector<int>* porder = &order;
+
+  RAJA::forall_fused<RAJA::seq_exec>(list, [=](RAJA::Index_type i) {
+    porder->push_back(static_cast<int>(i));
+  });
+  ASSERT_EQ(std::vector<int>({7, 3, 11, 5}), order);
+
+  order.clear();
+  RAJA::forall_fused<RAJA::seq_exec>(
+      list,
+      [=](RAJA::Index_type i) { porder->push_back(static_cast<int>(i)); },
+      [=](RAJA::Index_type i) { porder->push_back(-static_cast<int>(i)); });
+  ASSERT_EQ(std::vector<int>({7, -7, 3, -3, 11, -11, 5, -5}), order);
+}
+
+// the lambdas of fused loops interleave for each iterate
+TEST(KernelFuse, Interleaves)
+{
+  using Pol = RAJA::KernelPolicy<Fuse<For<0, RAJA::seq_exec, Lambda<0>>,
+                                      For<0, RAJA::seq_exec, Lambda<1>>,
+                                      For<1, RAJA::seq_exec, Lambda<2>>>>;
+  std::vector<std::pair<int, int>> trace;
+  std::vector<std::pair<int, int>>* ptrace = &trace;
+
+  RAJA::kernel<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, 3), RAJA::RangeSegment(0, 2)),
+      [=](int i, int) { ptrace->emplace_back(0, i); },
+      [=](int i, int) { ptrace->emplace_back(1, i); },
+      [=](int, int j) { ptrace->emplace_back(2, j); });
+
+  const std::vector<std::pair<int, int>> expected = {
+      {0, 0}, {1, 0}, {0, 1}, {1, 1}, {0, 2}, {1, 2}, {2, 0}, {2, 1}};
+  ASSERT_EQ(expected, trace);
+}
+
+template <typename OuterPolicy>
+static void check_fused_2d()
+{
+  using Pol = RAJA::KernelPolicy<
+      Fuse<For<1, OuterPolicy, For<0, RAJA::loop_exec, Lambda<0>>>,
+           For<1, OuterPolicy, For<0, RAJA::loop_exec, Lambda<1>>>>>;
+
+  const RAJA::Index_type ni = 37, nj = 29;
+  std::vector<double> u(ni * nj, 0.0), v(ni * nj, 0.0);
+  RAJA::View<double, RAJA::Layout<2>> uv(u.data(), nj, ni);
+  RAJA::View<double, RAJA::Layout<2>> vv(v.data(), nj, ni);
+
+  RAJA::kernel<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, ni), RAJA::RangeSegment(0, nj)),
+      [=](RAJA::Index_type i, RAJA::Index_type j) { uv(j, i) = i + ni * j; },
+      [=](RAJA::Index_type i, RAJA::Index_type j) {
+        vv(j, i) = 3.0 * uv(j, i);
+      });
+
+  for (RAJA::Index_type j = 0; j < nj; ++j) {
+    for (RAJA::Index_type i = 0; i < ni; ++i) {
+      ASSERT_EQ(3.0 * (i + ni * j), vv(j, i));
+    }
+  }
+}
+
+TEST(KernelFuse, Nested2D) { check_fused_2d<RAJA::seq_exec>(); }
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(KernelFuse, OpenMP) { check_fused_2d<RAJA::omp_parallel_for_exec>(); }
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+TEST(KernelFuse, TBB) { check_fused_2d<RAJA::tbb_for_exec>(); }
+#endif
@@ -0,0 +1,165 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Tests for statement::Hyperplane: every point of the box is visited
+/// once, and wavefront dependences are respected, for the sequential,
+/// OpenMP and TBB executors.
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+template <typename ExecPolicy>
+class HyperplaneTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_CASE_P(HyperplaneTest);
+
+TYPED_TEST_P(HyperplaneTest, Visits2DOnce)
+{
+  using Pol = RAJA::KernelPolicy<RAJA::statement::Hyperplane<
+      0,
+      RAJA::seq_exec,
+      RAJA::ArgList<1>,
+      TypeParam,
+      RAJA::statement::Lambda<0>>>;
+
+  for (RAJA::Index_type ni : {1, 2, 7, 40}) {
+    for (RAJA::Index_type nj : {1, 3, 33}) {
+      std::vector<int> count(ni * nj, 0);
+      int* c = count.data();
+      // offsets are zero based on a segment that is not
+      RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(5, 5 + ni),
+                                         RAJA::RangeSegment(-2, nj - 2)),
+                        [=](RAJA::Index_type i, RAJA::Index_type j) {
+                          ++c[(i - 5) * nj + (j + 2)];
+                        });
+      for (auto v : count) {
+        ASSERT_EQ(1, v);
+      }
+    }
+  }
+}
+
+TYPED_TEST_P(HyperplaneTest, EmptySegment)
+{
+  using Pol = RAJA::KernelPolicy<RAJA::statement::Hyperplane<
+      0,
+      RAJA::seq_exec,
+      RAJA::ArgList<1, 2>,
+      TypeParam,
+      RAJA::statement::Lambda<0>>>;
+
+  int calls = 0;
+  int* c = &calls;
+  RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, 4),
+                                     RAJA::RangeSegment(0, 0),
+                                     RAJA::RangeSegment(0, 4)),
+                    [=](RAJA::Index_type, RAJA::Index_type, RAJA::Index_type) {
+                      ++*c;
+                    });
+  ASSERT_EQ(0, calls);
+}
+
+TYPED_TEST_P(HyperplaneTest, Wavefront3D)
+{
+  using Pol = RAJA::KernelPolicy<RAJA::statement::Hyperplane<
+      0,
+      RAJA::seq_exec,
+      RAJA::ArgList<1, 2>,
+      TypeParam,
+      RAJA::statement::Lambda<0>>>;
+
+  const RAJA::Index_type ni = 9, nj = 17, nk = 12;
+  std::vector<long> data(ni * nj * nk, 0);
+  RAJA::View<long, RAJA::Layout<3>> x(data.data(), ni, nj, nk);
+
+  // each point reads its three upwind neighbours, which lie on the
+  // previous hyperplane
+  RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, ni),
+                                     RAJA::RangeSegment(0, nj),
+                                     RAJA::RangeSegment(0, nk)),
+                    [=](RAJA::Index_type i,
+                        RAJA::Index_type j,
+                        RAJA::Index_type k) {
+                      long v = 1;
+                      if (i > 0) v += x(i - 1, j, k);
+                      if (j > 0) v += x(i, j - 1, k);
+                      if (k > 0) v += x(i, j, k - 1);
+                      x(i, j, k) = v;
+                    });
+
+  std::vector<long> ref(ni * nj * nk, 0);
+  RAJA::View<long, RAJA::Layout<3>> y(ref.data(), ni, nj, nk);
+  for (RAJA::Index_type i = 0; i < ni; ++i) {
+    for (RAJA::Index_type j = 0; j < nj; ++j) {
+      for (RAJA::Index_type k = 0; k < nk; ++k) {
+        long v = 1;
+        if (i > 0) v += y(i - 1, j, k);
+        if (j > 0) v += y(i, j - 1, k);
+        if (k > 0) v += y(i, j, k - 1);
+        y(i, j, k) = v;
+      }
+    }
+  }
+  for (size_t p = 0; p < data.size(); ++p) {
+    ASSERT_EQ(ref[p], data[p]);
+  }
+}
+
+REGISTER_TYPED_TEST_CASE_P(HyperplaneTest,
+                           Visits2DOnce,
+                           EmptySegment,
+                           Wavefront3D);
+
+using HyperplaneTypes = ::testing::Types<RAJA::seq_exec,
+                                         RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                         ,
+                                         RAJA::omp_parallel_for_exec,
+                                         RAJA::omp_parallel_collapse_exec,
+                                         RAJA::omp_parallel_collapse_static<2>,
+                                         RAJA::omp_parallel_collapse_dynamic<3>
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                         ,
+                                         RAJA::tbb_for_dynamic,
+                                         RAJA::tbb_collapse_exec
+#endif
+                                         >;
+
+INSTANTIATE_TYPED_TEST_CASE_P(CPU, HyperplaneTest, HyperplaneTypes);
+
+#if defined(RAJA_ENABLE_TBB)
+TEST(Hyperplane, TBBTiles)
+{
+  // one tile size per argument of the ArgList; the first is the grain
+  using Pol = RAJA::KernelPolicy<RAJA::statement::Hyperplane<
+      0,
+      RAJA::seq_exec,
+      RAJA::ArgList<1, 2>,
+      RAJA::tbb_tile_collapse_exec<3, 8>,
+      RAJA::statement::Lambda<0>>>;
+
+  const RAJA::Index_type ni = 11, nj = 20, nk = 6;
+  std::vector<int> count(ni * nj * nk, 0);
+  int* c = count.data();
+  RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, ni),
+                                     RAJA::RangeSegment(0, nj),
+                                     RAJA::RangeSegment(0, nk)),
+                    [=](RAJA::Index_type i,
+                        RAJA::Index_type j,
+                        RAJA::Index_type k) { ++c[(i * nj + j) * nk + k]; });
+  for (auto v : count) {
+    ASSERT_EQ(1, v);
+  }
+}
+#endif
@@ -9,11 +9,16 @@
 /// Source file containing tests for RAJA index set mechanics.
 ///
 
+#include <atomic>
+#include <utility>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "buildIndexSet.hpp"
 
 #include "RAJA/RAJA.hpp"
+#include "RAJA/index/IndexSetBuilders.hpp"
 
 class IndexSetTest : public ::testing::Test
 {
@@ -129,3 +134,167 @@ TEST(IndexSet, swap)
   ASSERT_EQ(0l, iset1.size());
   ASSERT_EQ(0lu, iset1.getLength());
 }
+
+TEST(IndexSet, dependencyGraph)
+{
+  using RangeIndexSet = RAJA::TypedIndexSet<RAJA::RangeSegment>;
+  RangeIndexSet iset;
+  for (int i = 0; i < 4; ++i) {
+    iset.push_back(RAJA::RangeSegment(i * 10, (i + 1) * 10));
+  }
+  ASSERT_FALSE(iset.dependencyGraphSet());
+
+  iset.initDependencyGraph();
+  ASSERT_TRUE(iset.dependencyGraphSet());
+
+  // diamond: 0 -> {1, 2} -> 3
+  iset.getSegmentDepGraphNode(0)->addDepTask(1);
+  iset.getSegmentDepGraphNode(0)->addDepTask(2);
+  iset.getSegmentDepGraphNode(1)->addDepTask(3);
+  iset.getSegmentDepGraphNode(2)->addDepTask(3);
+  iset.finalizeDependencyGraph();
+
+  ASSERT_EQ(2, iset.getSegmentDepGraphNode(0)->numDepTasks());
+  ASSERT_EQ(0, iset.getSegmentDepGraphNode(0)->semaphoreReloadValue());
+  ASSERT_EQ(1, iset.getSegmentDepGraphNode(1)->semaphoreReloadValue());
+  ASSERT_EQ(1, iset.getSegmentDepGraphNode(2)->semaphoreReloadValue());
+  ASSERT_EQ(2, iset.getSegmentDepGraphNode(3)->semaphoreReloadValue());
+  ASSERT_EQ(2, iset.getSegmentDepGraphNode(3)->semaphoreValue());
+
+  ASSERT_FALSE(iset.getSegmentDepGraphNode(3)->satisfyOne());
+  ASSERT_TRUE(iset.getSegmentDepGraphNode(3)->satisfyOne());
+  iset.getSegmentDepGraphNode(3)->reset();
+  ASSERT_EQ(2, iset.getSegmentDepGraphNode(3)->semaphoreValue());
+
+  RangeIndexSet copy(iset);
+  ASSERT_TRUE(copy.dependencyGraphSet());
+  ASSERT_EQ(iset.getSegmentDepGraphNode(3), copy.getSegmentDepGraphNode(3));
+
+  // the graph outlives the index set it was built for
+  RangeIndexSet* built = new RangeIndexSet(std::move(copy));
+  RangeIndexSet moved(std::move(*built));
+  delete built;
+  iset.initDependencyGraph();
+  ASSERT_TRUE(moved.dependencyGraphSet());
+  ASSERT_EQ(2, moved.getSegmentDepGraphNode(0)->numDepTasks());
+  ASSERT_EQ(2, moved.getSegmentDepGraphNode(3)->semaphoreReloadValue());
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+template <typename SEG_ITER_POLICY>
+void runTaskGraphWavefront()
+{
+  // nblk x nblk wavefront, block (i,j) waits for (i-1,j) and (i,j-1)
+  const int nblk = 8;
+  const int blen = 16;
+  const int nseg = nblk * nblk;
+
+  UnitIndexSet iset;
+  for (int seg = 0; seg < nseg; ++seg) {
+    iset.push_back(RAJA::RangeSegment(seg * blen, (seg + 1) * blen));
+  }
+  for (int ival = 0; ival < nblk; ++ival) {
+    iset.setSegmentInterval(ival, ival * nblk, (ival + 1) * nblk);
+  }
+
+  iset.initDependencyGraph();
+  for (int i = 0; i < nblk; ++i) {
+    for (int j = 0; j < nblk; ++j) {
+      RAJA::DepGraphNode* task = iset.getSegmentDepGraphNode(i * nblk + j);
+      if (i + 1 < nblk) task->addDepTask((i + 1) * nblk + j);
+      if (j + 1 < nblk) task->addDepTask(i * nblk + j + 1);
+    }
+  }
+  iset.finalizeDependencyGraph();
+
+  std::vector<int> visits(nseg * blen);
+  std::vector<int> start(nseg), finish(nseg);
+  std::atomic<int> clock(0);
+
+  int* visits_ptr = visits.data();
+  int* start_ptr = start.data();
+  int* finish_ptr = finish.data();
+
+  // run twice to make sure the graph is ready for reuse
+  for (int rep = 0; rep < 2; ++rep) {
+    RAJA::forall<RAJA::ExecPolicy<SEG_ITER_POLICY, RAJA::seq_exec>>(
+        iset, [=, &clock](int idx) {
+          int seg = idx / blen;
+          if (idx % blen == 0) start_ptr[seg] = clock++;
+          visits_ptr[idx]++;
+          if (idx % blen == blen - 1) finish_ptr[seg] = clock++;
+        });
+
+    for (int idx = 0; idx < nseg * blen; ++idx) {
+      ASSERT_EQ(rep + 1, visits[idx]);
+    }
+    for (int i = 0; i < nblk; ++i) {
+      for (int j = 0; j < nblk; ++j) {
+        int seg = i * nblk + j;
+        if (i > 0) {
+          ASSERT_GT(start[seg], finish[seg - nblk]);
+        }
+        if (j > 0) {
+          ASSERT_GT(start[seg], finish[seg - 1]);
+        }
+      }
+    }
+  }
+}
+
+TEST(IndexSet, taskgraphSegit)
+{
+  runTaskGraphWavefront<RAJA::omp_taskgraph_segit>();
+}
+
+TEST(IndexSet, taskgraphIntervalSegit)
+{
+  runTaskGraphWavefront<RAJA::omp_taskgraph_interval_segit>();
+}
+#endif
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(IndexSet, lockFreeBlock3DScatter)
+{
+  const RAJA::Index_type nx = 5, ny = 4, nz = 23;
+  const RAJA::Index_type nzones = nx * ny * nz;
+  const RAJA::Index_type nnx = nx + 1, nny = ny + 1;
+  const RAJA::Index_type nnodes = nnx * nny * (nz + 1);
+
+  UnitIndexSet iset;
+  RAJA::buildLockFreeBlockIndexset(iset, nx, ny, nz);
+
+  ASSERT_TRUE(iset.dependencyGraphSet());
+  ASSERT_EQ(static_cast<size_t>(nzones), iset.getLength());
+
+  std::vector<double> node(nnodes, 0.0);
+  std::vector<double> ref(nnodes, 0.0);
+  double* node_ptr = node.data();
+
+  auto scatter = [=](double* nodal, RAJA::Index_type z) {
+    RAJA::Index_type i = z % nx;
+    RAJA::Index_type j = (z / nx) % ny;
+    RAJA::Index_type k = z / (nx * ny);
+    RAJA::Index_type n0 = i + nnx * (j + nny * k);
+    RAJA::Index_type offsets[8] = {0, 1, nnx, nnx + 1,
+                                   nnx * nny, nnx * nny + 1,
+                                   nnx * nny + nnx, nnx * nny + nnx + 1};
+    for (int n = 0; n < 8; ++n) {
+      nodal[n0 + offsets[n]] += 1.0;
+    }
+  };
+
+  for (RAJA::Index_type z = 0; z < nzones; ++z) {
+    scatter(ref.data(), z);
+  }
+
+  for (int rep = 0; rep < 3; ++rep) {
+    RAJA::forall<RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::loop_exec>>(
+        iset, [=](RAJA::Index_type z) { scatter(node_ptr, z); });
+  }
+
+  for (RAJA::Index_type n = 0; n < nnodes; ++n) {
+    ASSERT_DOUBLE_EQ(3.0 * ref[n], node[n]);
+  }
+}
+#endif
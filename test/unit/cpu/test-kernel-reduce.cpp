@@ -0,0 +1,151 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Tests for the OpenMP and TBB executors of statement::Reduce, which
+/// combine the thread-private values of a kernel parameter.
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace RAJA::statement;
+
+template <typename ReducePolicy, typename OuterPolicy>
+static void check_sum_and_max()
+{
+  using Pol = RAJA::KernelPolicy<
+      Reduce<ReducePolicy,
+             RAJA::operators::plus,
+             Param<0>,
+             Reduce<ReducePolicy,
+                    RAJA::operators::maximum,
+                    Param<1>,
+                    For<1, OuterPolicy, For<0, RAJA::loop_exec, Lambda<0>>>>>,
+      Lambda<1>>;
+
+  const RAJA::Index_type ni = 97, nj = 131;
+  long sum = -1, max = -1;
+  long* psum = &sum;
+  long* pmax = &max;
+
+  // the initial value of a parameter is counted once
+  RAJA::kernel_param<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, ni), RAJA::RangeSegment(0, nj)),
+      RAJA::make_tuple(10L, -1000L),
+      [=](RAJA::Index_type i, RAJA::Index_type j, long& s, long& m) {
+        const long v = i * nj + j;
+        s += v;
+        m = v > m ? v : m;
+      },
+      [=](RAJA::Index_type, RAJA::Index_type, long& s, long& m) {
+        *psum = s;
+        *pmax = m;
+      });
+
+  const long n = ni * nj;
+  ASSERT_EQ(10 + n * (n - 1) / 2, sum);
+  ASSERT_EQ(n - 1, max);
+}
+
+TEST(KernelReduce, Sequential)
+{
+  check_sum_and_max<RAJA::seq_reduce, RAJA::seq_exec>();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(KernelReduce, OpenMPFor)
+{
+  check_sum_and_max<RAJA::omp_reduce, RAJA::omp_parallel_for_exec>();
+  check_sum_and_max<RAJA::omp_reduce_ordered, RAJA::omp_parallel_for_exec>();
+}
+
+TEST(KernelReduce, OpenMPCollapse)
+{
+  using Pol = RAJA::KernelPolicy<
+      Reduce<RAJA::omp_reduce,
+             RAJA::operators::plus,
+             Param<0>,
+             Collapse<RAJA::omp_parallel_collapse_exec,
+                      RAJA::ArgList<0, 1, 2>,
+                      Lambda<0>>>,
+      Lambda<1>>;
+
+  const RAJA::Index_type n = 23;
+  double norm = 0.0;
+  double* pnorm = &norm;
+  RAJA::kernel_param<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, n),
+                       RAJA::RangeSegment(0, n),
+                       RAJA::RangeSegment(0, n)),
+      RAJA::make_tuple(0.0),
+      [=](RAJA::Index_type, RAJA::Index_type, RAJA::Index_type, double& s) {
+        s += 0.5;
+      },
+      [=](RAJA::Index_type, RAJA::Index_type, RAJA::Index_type, double& s) {
+        *pnorm = s;
+      });
+  ASSERT_DOUBLE_EQ(0.5 * n * n * n, norm);
+}
+
+TEST(KernelReduce, OpenMPRegion)
+{
+  // every thread of the region runs its share of the loop on its own copy
+  using Pol = RAJA::KernelPolicy<
+      Reduce<RAJA::omp_reduce,
+             RAJA::operators::plus,
+             Param<0>,
+             Region<RAJA::omp_parallel_region,
+                    For<0, RAJA::omp_for_nowait_exec, Lambda<0>>,
+                    For<0, RAJA::omp_for_nowait_exec, Lambda<0>>>>,
+      Lambda<1>>;
+
+  const RAJA::Index_type n = 1000;
+  long sum = 0;
+  long* psum = &sum;
+  RAJA::kernel_param<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, n)),
+                          RAJA::make_tuple(0L),
+                          [=](RAJA::Index_type i, long& s) { s += i; },
+                          [=](RAJA::Index_type, long& s) { *psum = s; });
+  ASSERT_EQ(n * (n - 1), sum);
+}
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+TEST(KernelReduce, TBBFor)
+{
+  check_sum_and_max<RAJA::tbb_reduce, RAJA::tbb_for_dynamic>();
+  check_sum_and_max<RAJA::tbb_reduce, RAJA::tbb_for_exec>();
+}
+
+TEST(KernelReduce, TBBCollapse)
+{
+  using Pol = RAJA::KernelPolicy<
+      Reduce<RAJA::tbb_reduce,
+             RAJA::operators::minimum,
+             Param<0>,
+             Collapse<RAJA::tbb_collapse_exec,
+                      RAJA::ArgList<1, 0>,
+                      Lambda<0>>>,
+      Lambda<1>>;
+
+  const RAJA::Index_type n = 300;
+  int min = 0;
+  int* pmin = &min;
+  RAJA::kernel_param<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, n), RAJA::RangeSegment(0, n)),
+      RAJA::make_tuple(1 << 30),
+      [=](RAJA::Index_type i, RAJA::Index_type j, int& m) {
+        const int v = static_cast<int>((i - 123) * (i - 123) + (j - 7));
+        m = v < m ? v : m;
+      },
+      [=](RAJA::Index_type, RAJA::Index_type, int& m) { *pmin = m; });
+  ASSERT_EQ(-7, min);
+}
+#endif
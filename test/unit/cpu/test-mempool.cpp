@@ -0,0 +1,153 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the RAJA basic_mempool pools.
+///
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "RAJA/util/basic_mempool.hpp"
+
+#include "gtest/gtest.h"
+
+using allocator = RAJA::basic_mempool::generic_allocator;
+
+template <typename Pool>
+class MemPoolTest : public ::testing::Test
+{
+};
+
+using PoolTypes =
+    ::testing::Types<RAJA::basic_mempool::MemPool<allocator>,
+                     RAJA::basic_mempool::ThreadCachingMemPool<allocator>>;
+
+TYPED_TEST_CASE(MemPoolTest, PoolTypes);
+
+TYPED_TEST(MemPoolTest, AlignedAndDisjoint)
+{
+  TypeParam pool;
+
+  std::vector<char*> ptrs;
+  std::vector<size_t> sizes;
+  for (size_t size = 1; size <= (size_t(1) << 17); size = size * 3 + 1) {
+    for (size_t align : {size_t(1), size_t(8), size_t(64), size_t(256)}) {
+      char* ptr = pool.template malloc<char>(size, align);
+      ASSERT_NE(ptr, nullptr);
+      ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % align, 0u);
+      ptrs.push_back(ptr);
+      sizes.push_back(size);
+    }
+  }
+
+  for (size_t i = 0; i < ptrs.size(); ++i) {
+    for (size_t j = 0; j < sizes[i]; ++j) {
+      ptrs[i][j] = static_cast<char>(i);
+    }
+  }
+  for (size_t i = 0; i < ptrs.size(); ++i) {
+    for (size_t j = 0; j < sizes[i]; ++j) {
+      ASSERT_EQ(ptrs[i][j], static_cast<char>(i));
+    }
+    pool.free(ptrs[i]);
+  }
+
+  pool.free_chunks();
+}
+
+TYPED_TEST(MemPoolTest, Reuse)
+{
+  TypeParam pool;
+
+  double* a = pool.template malloc<double>(100);
+  pool.free(a);
+  double* b = pool.template malloc<double>(100);
+  ASSERT_EQ(a, b);
+  pool.free(b);
+
+  pool.free_chunks();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TYPED_TEST(MemPoolTest, ConcurrentChurn)
+{
+  TypeParam pool;
+  const int live = 64;
+  const int rounds = 2000;
+  int errors = 0;
+  std::vector<int*> all(live * omp_get_max_threads(), nullptr);
+
+#pragma omp parallel reduction(+ : errors)
+  {
+    const int tid = omp_get_thread_num();
+    const int nthreads = omp_get_num_threads();
+    std::mt19937 gen(tid);
+    std::uniform_int_distribution<int> dist(1, 1024);
+    int** ptrs = &all[tid * live];
+    std::vector<int> sizes(live, 0);
+
+    for (int r = 0; r < rounds; ++r) {
+      const int k = r % live;
+      if (ptrs[k] != nullptr) {
+        for (int j = 0; j < sizes[k]; ++j) {
+          if (ptrs[k][j] != tid * rounds + k) ++errors;
+        }
+        pool.free(ptrs[k]);
+      }
+      sizes[k] = dist(gen);
+      ptrs[k] = pool.template malloc<int>(sizes[k]);
+      for (int j = 0; j < sizes[k]; ++j) {
+        ptrs[k][j] = tid * rounds + k;
+      }
+    }
+
+    // free the blocks allocated by the next thread
+#pragma omp barrier
+    const int other = (tid + 1) % nthreads;
+    for (int k = 0; k < live; ++k) {
+      pool.free(all[other * live + k]);
+    }
+  }
+
+  ASSERT_EQ(errors, 0);
+  pool.free_chunks();
+}
+#endif
+
+TEST(ThreadCachingMemPool, SizeClasses)
+{
+  using RAJA::basic_mempool::detail::size_class;
+
+  ASSERT_EQ(size_class(1, 1), 0);
+  ASSERT_EQ(size_class(16, 1), 0);
+  ASSERT_EQ(size_class(17, 1), 1);
+  ASSERT_EQ(size_class(32, 1), 1);
+  ASSERT_EQ(size_class(33, 8), 2);
+  ASSERT_EQ(size_class(8, 256), 4);
+  ASSERT_EQ(size_class(32768, 8), 11);
+  ASSERT_EQ(size_class(32769, 8), -1);
+}
+
+TEST(ThreadCachingMemPool, LargeFallback)
+{
+  RAJA::basic_mempool::ThreadCachingMemPool<allocator> pool;
+
+  double* big = pool.malloc<double>(1 << 16);
+  ASSERT_NE(big, nullptr);
+  big[0] = 1.0;
+  big[(1 << 16) - 1] = 2.0;
+  pool.free(big);
+
+  double* again = pool.malloc<double>(1 << 16);
+  ASSERT_EQ(big, again);
+  pool.free(again);
+
+  pool.free_chunks();
+}
@@ -0,0 +1,175 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA::permute_copy between Views with
+/// different layouts.
+///
+
+#include <array>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+
+#include "gtest/gtest.h"
+
+template <typename ExecPolicy>
+class PermuteCopyTest : public ::testing::Test
+{
+};
+
+using PermuteCopyPolicies = ::testing::Types<RAJA::seq_exec,
+                                             RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                             ,
+                                             RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                             ,
+                                             RAJA::tbb_for_exec
+#endif
+#if defined(RAJA_ENABLE_THREADS)
+                                             ,
+                                             RAJA::threads_for_exec
+#endif
+                                             >;
+
+TYPED_TEST_CASE(PermuteCopyTest, PermuteCopyPolicies);
+
+// distinct value for every multi-index
+static double tag(std::array<RAJA::Index_type, 3> const& i)
+{
+  return 1.0 + i[0] + 1000.0 * i[1] + 1000000.0 * i[2];
+}
+
+TYPED_TEST(PermuteCopyTest, Transpose2D)
+{
+  // sizes that are not multiples of the tile or block sizes
+  for (RAJA::Index_type n : {1, 3, 31, 33, 70}) {
+    for (RAJA::Index_type m : {1, 4, 37, 128}) {
+      std::vector<double> a(n * m), b(n * m, -1.0);
+      RAJA::View<double, RAJA::Layout<2>> src(a.data(), n, m);
+      auto layout = RAJA::make_permuted_layout(
+          {{n, m}}, RAJA::as_array<RAJA::Perm<1, 0>>::get());
+      RAJA::View<double, RAJA::Layout<2>> dst(b.data(), layout);
+      for (RAJA::Index_type i = 0; i < n; ++i) {
+        for (RAJA::Index_type j = 0; j < m; ++j) {
+          src(i, j) = tag({{i, j, 0}});
+        }
+      }
+
+      RAJA::permute_copy<TypeParam>(src, dst);
+
+      for (RAJA::Index_type i = 0; i < n; ++i) {
+        for (RAJA::Index_type j = 0; j < m; ++j) {
+          ASSERT_EQ(tag({{i, j, 0}}), dst(i, j));
+          ASSERT_EQ(tag({{i, j, 0}}), b[j * n + i]);
+        }
+      }
+    }
+  }
+}
+
+TYPED_TEST(PermuteCopyTest, AllPermutations3D)
+{
+  const RAJA::Index_type n0 = 9, n1 = 35, n2 = 40;
+  const std::array<std::array<camp::idx_t, 3>, 6> perms{
+      {RAJA::as_array<RAJA::PERM_IJK>::get(),
+       RAJA::as_array<RAJA::PERM_IKJ>::get(),
+       RAJA::as_array<RAJA::PERM_JIK>::get(),
+       RAJA::as_array<RAJA::PERM_JKI>::get(),
+       RAJA::as_array<RAJA::PERM_KIJ>::get(),
+       RAJA::as_array<RAJA::PERM_KJI>::get()}};
+
+  std::vector<double> a(n0 * n1 * n2), b(n0 * n1 * n2);
+  for (auto const& sp : perms) {
+    for (auto const& dp : perms) {
+      RAJA::View<double, RAJA::Layout<3>> src(
+          a.data(), RAJA::make_permuted_layout({{n0, n1, n2}}, sp));
+      RAJA::View<double, RAJA::Layout<3>> dst(
+          b.data(), RAJA::make_permuted_layout({{n0, n1, n2}}, dp));
+      for (RAJA::Index_type i = 0; i < n0; ++i) {
+        for (RAJA::Index_type j = 0; j < n1; ++j) {
+          for (RAJA::Index_type k = 0; k < n2; ++k) {
+            src(i, j, k) = tag({{i, j, k}});
+            dst(i, j, k) = -1.0;
+          }
+        }
+      }
+
+      RAJA::permute_copy<TypeParam>(src, dst);
+
+      for (RAJA::Index_type i = 0; i < n0; ++i) {
+        for (RAJA::Index_type j = 0; j < n1; ++j) {
+          for (RAJA::Index_type k = 0; k < n2; ++k) {
+            ASSERT_EQ(tag({{i, j, k}}), dst(i, j, k));
+          }
+        }
+      }
+    }
+  }
+}
+
+TYPED_TEST(PermuteCopyTest, Permute5DWithConversion)
+{
+  const std::array<RAJA::Index_type, 5> n{{3, 5, 2, 7, 6}};
+  const RAJA::Index_type total = 3 * 5 * 2 * 7 * 6;
+  std::vector<int> a(total);
+  std::vector<double> b(total, -1.0);
+
+  RAJA::View<int, RAJA::Layout<5>> src(a.data(), n[0], n[1], n[2], n[3], n[4]);
+  RAJA::View<double, RAJA::Layout<5>> dst(
+      b.data(),
+      RAJA::make_permuted_layout(n,
+                                 RAJA::as_array<RAJA::PERM_MLKJI>::get()));
+
+  int v = 0;
+  for (int i = 0; i < n[0]; ++i)
+    for (int j = 0; j < n[1]; ++j)
+      for (int k = 0; k < n[2]; ++k)
+        for (int l = 0; l < n[3]; ++l)
+          for (int m = 0; m < n[4]; ++m)
+            src(i, j, k, l, m) = v++;
+
+  RAJA::permute_copy<TypeParam>(src, dst);
+
+  v = 0;
+  for (int i = 0; i < n[0]; ++i)
+    for (int j = 0; j < n[1]; ++j)
+      for (int k = 0; k < n[2]; ++k)
+        for (int l = 0; l < n[3]; ++l)
+          for (int m = 0; m < n[4]; ++m)
+            ASSERT_EQ(static_cast<double>(v++), dst(i, j, k, l, m));
+}
+
+TEST(PermuteCopy, SameLayoutAndProjected)
+{
+  const RAJA::Index_type n = 10000;
+  std::vector<float> a(n), b(n, 0.0f);
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    a[i] = static_cast<float>(i);
+  }
+  RAJA::View<float, RAJA::Layout<1>> src(a.data(), n);
+  RAJA::View<float, RAJA::Layout<1>> dst(b.data(), n);
+  RAJA::permute_copy<RAJA::seq_exec>(src, dst);
+  ASSERT_EQ(a, b);
+
+  // zero-sized dimensions are projected out, leaving a single element
+  RAJA::View<float, RAJA::Layout<2>> p0(a.data() + 5, 0, 0);
+  RAJA::View<float, RAJA::Layout<2>> p1(b.data(), 0, 0);
+  RAJA::permute_copy<RAJA::seq_exec>(p0, p1);
+  ASSERT_EQ(a[5], b[0]);
+  ASSERT_EQ(a[1], b[1]);
+}
+
+TEST(PermuteCopy, SizeMismatchThrows)
+{
+  std::vector<double> a(12), b(12);
+  RAJA::View<double, RAJA::Layout<2>> src(a.data(), 3, 4);
+  RAJA::View<double, RAJA::Layout<2>> dst(b.data(), 4, 3);
+  ASSERT_ANY_THROW(RAJA::permute_copy<RAJA::seq_exec>(src, dst));
+}
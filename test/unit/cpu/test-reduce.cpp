@@ -35,7 +35,9 @@ using TestingTypes = ::testing::Types<
     ,
     std::tuple<ExecPolicy<omp_parallel_for_segit, loop_exec>, omp_reduce>,
     std::tuple<ExecPolicy<omp_parallel_for_segit, loop_exec>,
-               omp_reduce_ordered>
+               omp_reduce_ordered>,
+    std::tuple<ExecPolicy<omp_parallel_for_segit, loop_exec>,
+               omp_reduce_padded>
 #endif
 #if defined(RAJA_ENABLE_TBB)
     ,
@@ -15,10 +15,19 @@
 #include "RAJA/RAJA.hpp"
 #include "RAJA/internal/MemUtils_CPU.hpp"
 
+#include <chrono>
+#include <limits>
+#include <thread>
 #include <tuple>
+#include <vector>
+#include <cmath>
 
 #include <math.h>
 
+#if defined(RAJA_ENABLE_TBB)
+#include <tbb/global_control.h>
+#endif
+
 template <typename T>
 class ReductionConstructorTest : public ::testing::Test
 {
@@ -100,12 +109,17 @@ REGISTER_TYPED_TEST_CASE_P(ReductionConstructorTest,
 using constructor_types =
     ::testing::Types<std::tuple<RAJA::seq_reduce, int>,
                      std::tuple<RAJA::seq_reduce, float>,
-                     std::tuple<RAJA::seq_reduce, double>
+                     std::tuple<RAJA::seq_reduce, double>,
+                     std::tuple<RAJA::seq_reduce_deterministic, int>,
+                     std::tuple<RAJA::seq_reduce_deterministic, double>,
+                     std::tuple<RAJA::seq_reduce_deterministic, long double>
 #if defined(RAJA_ENABLE_TBB)
                      ,
                      std::tuple<RAJA::tbb_reduce, int>,
                      std::tuple<RAJA::tbb_reduce, float>,
-                     std::tuple<RAJA::tbb_reduce, double>
+                     std::tuple<RAJA::tbb_reduce, double>,
+                     std::tuple<RAJA::tbb_reduce_deterministic, float>,
+                     std::tuple<RAJA::tbb_reduce_deterministic, double>
 #endif
 #if defined(RAJA_ENABLE_OPENMP)
                      ,
@@ -114,7 +128,19 @@ using constructor_types =
                      std::tuple<RAJA::omp_reduce, double>,
                      std::tuple<RAJA::omp_reduce_ordered, int>,
                      std::tuple<RAJA::omp_reduce_ordered, float>,
-                     std::tuple<RAJA::omp_reduce_ordered, double>
+                     std::tuple<RAJA::omp_reduce_ordered, double>,
+                     std::tuple<RAJA::omp_reduce_padded, int>,
+                     std::tuple<RAJA::omp_reduce_padded, float>,
+                     std::tuple<RAJA::omp_reduce_padded, double>,
+                     std::tuple<RAJA::omp_reduce_deterministic, int>,
+                     std::tuple<RAJA::omp_reduce_deterministic, double>,
+                     std::tuple<RAJA::omp_reduce_deterministic, long double>
+#endif
+#if defined(RAJA_ENABLE_THREADS)
+                     ,
+                     std::tuple<RAJA::threads_reduce, int>,
+                     std::tuple<RAJA::threads_reduce, float>,
+                     std::tuple<RAJA::threads_reduce, double>
 #endif
                      >;
 
@@ -857,6 +883,110 @@ TYPED_TEST_P(ReductionCorrectnessTest, ReduceMaxLocGenericIndex2)
   ASSERT_EQ(this->maxloc, raja_loc.idx);
 }
 
+TYPED_TEST_P(ReductionCorrectnessTest, ReduceMinLocTies)
+{
+  using ExecPolicy = typename std::tuple_element<0, TypeParam>::type;
+  using ReducePolicy = typename std::tuple_element<1, TypeParam>::type;
+
+  // the minimum occurs at 13, 110, 207, ...; visiting the indices in
+  // reverse must still report the smallest of them
+  const RAJA::Index_type n = 1000;
+  std::vector<double> x(n);
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    x[i] = (i % 97 == 13) ? -5.0 : static_cast<double>(i % 11);
+  }
+  const double* data = x.data();
+
+  RAJA::ReduceMinLoc<ReducePolicy, double> minloc_reducer(1024.0, -1);
+
+  RAJA::forall<ExecPolicy>(RAJA::RangeStrideSegment(n - 1, -1, -1),
+                           [=](RAJA::Index_type i) {
+                             minloc_reducer.minloc(data[i], i);
+                           });
+
+  ASSERT_EQ(-5.0, (double)minloc_reducer.get());
+  ASSERT_EQ(13, minloc_reducer.getLoc());
+}
+
+TYPED_TEST_P(ReductionCorrectnessTest, ReduceMaxLocTies)
+{
+  using ExecPolicy = typename std::tuple_element<0, TypeParam>::type;
+  using ReducePolicy = typename std::tuple_element<1, TypeParam>::type;
+
+  const RAJA::Index_type n = 1000;
+  std::vector<double> x(n);
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    x[i] = (i % 97 == 13) ? 50.0 : static_cast<double>(i % 11);
+  }
+  const double* data = x.data();
+
+  RAJA::ReduceMaxLoc<ReducePolicy, double> maxloc_reducer(-1024.0, -1);
+
+  RAJA::forall<ExecPolicy>(RAJA::RangeStrideSegment(n - 1, -1, -1),
+                           [=](RAJA::Index_type i) {
+                             maxloc_reducer.maxloc(data[i], i);
+                           });
+
+  ASSERT_EQ(50.0, (double)maxloc_reducer.get());
+  ASSERT_EQ(13, maxloc_reducer.getLoc());
+}
+
+TYPED_TEST_P(ReductionCorrectnessTest, ReduceParams)
+{
+  using ExecPolicy = typename std::tuple_element<0, TypeParam>::type;
+  using ReducePolicy = typename std::tuple_element<1, TypeParam>::type;
+
+  using Sum = RAJA::ReduceSum<ReducePolicy, double>;
+  using Min = RAJA::ReduceMin<ReducePolicy, double>;
+  using Max = RAJA::ReduceMax<ReducePolicy, double>;
+  using MinLoc = RAJA::ReduceMinLoc<ReducePolicy, double>;
+  using MaxLoc = RAJA::ReduceMaxLoc<ReducePolicy, double>;
+
+  Sum sum_reducer(0.0);
+  Min min_reducer(1024.0);
+  Max max_reducer(0.0);
+  MinLoc minloc_reducer(1024.0, -1);
+  MaxLoc maxloc_reducer(0.0, -1);
+
+  RAJA::Real_ptr array = this->array;
+  RAJA::forall<ExecPolicy>(
+      RAJA::RangeSegment(0, this->array_length),
+      RAJA::reduce_params(sum_reducer,
+                          min_reducer,
+                          max_reducer,
+                          minloc_reducer,
+                          maxloc_reducer),
+      [=](int i,
+          typename Sum::param_type& sum,
+          typename Min::param_type& min,
+          typename Max::param_type& max,
+          typename MinLoc::param_type& minloc,
+          typename MaxLoc::param_type& maxloc) {
+        sum += array[i];
+        min.min(array[i]);
+        max.max(array[i]);
+        minloc.minloc(array[i], i);
+        maxloc.maxloc(array[i], i);
+      });
+
+  ASSERT_FLOAT_EQ(this->sum, sum_reducer.get());
+  ASSERT_FLOAT_EQ(this->min, min_reducer.get());
+  ASSERT_FLOAT_EQ(this->max, max_reducer.get());
+  ASSERT_FLOAT_EQ(this->min, minloc_reducer.get());
+  ASSERT_EQ(this->minloc, minloc_reducer.getLoc());
+  ASSERT_FLOAT_EQ(this->max, maxloc_reducer.get());
+  ASSERT_EQ(this->maxloc, maxloc_reducer.getLoc());
+
+  // the reducers keep accumulating over a second loop
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, this->array_length),
+                           RAJA::reduce_params(sum_reducer),
+                           [=](int i, typename Sum::param_type& sum) {
+                             sum += array[i];
+                           });
+
+  ASSERT_FLOAT_EQ(2 * this->sum, sum_reducer.get());
+}
+
 REGISTER_TYPED_TEST_CASE_P(ReductionCorrectnessTest,
                            ReduceSum,
                            ReduceSum2,
@@ -871,7 +1001,10 @@ REGISTER_TYPED_TEST_CASE_P(ReductionCorrectnessTest,
                            ReduceMaxLoc,
                            ReduceMaxLocGenericIndex,
                            ReduceMaxLoc2,
-                           ReduceMaxLocGenericIndex2);
+                           ReduceMaxLocGenericIndex2,
+                           ReduceMinLocTies,
+                           ReduceMaxLocTies,
+                           ReduceParams);
 
 REGISTER_TYPED_TEST_CASE_P(ReductionGenericLocTest,
                            ReduceMinLoc2DIndex,
@@ -885,20 +1018,220 @@ REGISTER_TYPED_TEST_CASE_P(ReductionGenericLocTest,
 
 using types = ::testing::Types<
     std::tuple<RAJA::seq_exec, RAJA::seq_reduce>,
-    std::tuple<RAJA::loop_exec, RAJA::seq_reduce>
+    std::tuple<RAJA::loop_exec, RAJA::seq_reduce>,
+    std::tuple<RAJA::seq_exec, RAJA::seq_reduce_deterministic>
 #if defined(RAJA_ENABLE_OPENMP)
     ,
     std::tuple<RAJA::omp_parallel_for_exec, RAJA::omp_reduce>,
-    std::tuple<RAJA::omp_parallel_for_exec, RAJA::omp_reduce_ordered>
+    std::tuple<RAJA::omp_parallel_for_exec, RAJA::omp_reduce_ordered>,
+    std::tuple<RAJA::omp_parallel_for_exec, RAJA::omp_reduce_padded>,
+    std::tuple<RAJA::omp_parallel_for_exec, RAJA::omp_reduce_deterministic>
 #endif
 #if defined(RAJA_ENABLE_TBB)
     ,
-    std::tuple<RAJA::tbb_for_exec, RAJA::tbb_reduce>
+    std::tuple<RAJA::tbb_for_exec, RAJA::tbb_reduce>,
+    std::tuple<RAJA::tbb_for_exec, RAJA::tbb_reduce_deterministic>
+#endif
+#if defined(RAJA_ENABLE_THREADS)
+    ,
+    std::tuple<RAJA::threads_for_exec, RAJA::threads_reduce>,
+    std::tuple<RAJA::threads_for_dynamic<8>, RAJA::threads_reduce>
 #endif
     >;
 
 INSTANTIATE_TYPED_TEST_CASE_P(Reduce, ReductionCorrectnessTest, types);
 INSTANTIATE_TYPED_TEST_CASE_P(Reduce, ReductionGenericLocTest, types);
 
+//
+// Sums of values spanning many magnitudes, whose rounding depends on the
+// order of the additions, must be bitwise identical for every thread count
+// and back end, and equal to the correctly rounded exact sum.
+//
+class DeterministicReduceTest : public ::testing::Test
+{
+protected:
+  virtual void SetUp()
+  {
+    // each value appears with both signs, far apart in the array
+    const RAJA::Index_type n = 10000;
+    data.resize(2 * n);
+    for (RAJA::Index_type i = 0; i < n; ++i) {
+      const double mag = std::ldexp(1.0 + (i % 13) / 16.0, (i * 37) % 120 - 60);
+      data[i] = (i % 2) ? mag : -mag;
+      data[2 * n - 1 - i] = -data[i];
+    }
+    // so the exact sum is just these
+    data.insert(data.begin() + n / 3, 0.75);
+    data.insert(data.begin() + n, std::ldexp(1.0, -70));
+    exact = 0.75 + std::ldexp(1.0, -70);
+  }
+
+  template <typename ExecPolicy, typename ReducePolicy>
+  double sum() const
+  {
+    const double* x = data.data();
+    RAJA::ReduceSum<ReducePolicy, double> total(0.0);
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, data.size()),
+                             [=](RAJA::Index_type i) { total += x[i]; });
+    return total.get();
+  }
+
+  //! the same sum, with the reducer passed through reduce_params
+  template <typename ExecPolicy, typename ReducePolicy>
+  double param_sum() const
+  {
+    using Sum = RAJA::ReduceSum<ReducePolicy, double>;
+    const double* x = data.data();
+    Sum total(0.0);
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, data.size()),
+                             RAJA::reduce_params(total),
+                             [=](RAJA::Index_type i,
+                                 typename Sum::param_type& s) { s += x[i]; });
+    return total.get();
+  }
+
+  std::vector<double> data;
+  double exact;
+};
+
+TEST_F(DeterministicReduceTest, Seq)
+{
+  ASSERT_NE(exact, (sum<RAJA::seq_exec, RAJA::seq_reduce>()));
+  ASSERT_EQ(exact, (sum<RAJA::seq_exec, RAJA::seq_reduce_deterministic>()));
+  ASSERT_EQ(exact,
+            (param_sum<RAJA::seq_exec, RAJA::seq_reduce_deterministic>()));
+
+  std::vector<double> reversed(data.rbegin(), data.rend());
+  std::swap(data, reversed);
+  ASSERT_EQ(exact, (sum<RAJA::seq_exec, RAJA::seq_reduce_deterministic>()));
+}
 
+// the exact sum 1 + 2^-24 + 2^-60 is just above half a float ulp from 1,
+// so it rounds up; rounded to double first, it would be a tie and round
+// down to 1
+TEST_F(DeterministicReduceTest, FloatRoundsOnce)
+{
+  const float parts[] = {std::ldexp(1.0f, -60), 1.0f, std::ldexp(1.0f, -24)};
+  const float* x = parts;
+  const float expected = 1.0f + std::ldexp(1.0f, -23);
+  ASSERT_EQ(1.0f, static_cast<float>(1.0 + std::ldexp(1.0, -24) +
+                                     std::ldexp(1.0, -60)));
+
+  RAJA::ReduceSum<RAJA::seq_reduce_deterministic, float> sum(0.0f);
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 3),
+                               [=](RAJA::Index_type i) { sum += x[i]; });
+  ASSERT_EQ(expected, sum.get());
+
+  RAJA::super_accumulator acc;
+  for (float v : parts) {
+    acc.add(-v);
+  }
+  ASSERT_EQ(-expected, acc.get<float>());
+  ASSERT_EQ(-(1.0 + std::ldexp(1.0, -24) + std::ldexp(1.0, -60)),
+            acc.get());
+
+  // smallest subnormal float: 2^-150 is a tie and rounds to even, zero;
+  // anything above it rounds up
+  RAJA::super_accumulator tiny;
+  tiny.add(std::ldexp(1.0, -150));
+  ASSERT_EQ(0.0f, tiny.get<float>());
+  tiny.add(std::ldexp(1.0, -200));
+  ASSERT_EQ(std::ldexp(1.0f, -149), tiny.get<float>());
+
+  RAJA::super_accumulator big;
+  big.add(static_cast<double>(std::numeric_limits<float>::max()));
+  big.add(static_cast<double>(std::numeric_limits<float>::max()));
+  ASSERT_EQ(std::numeric_limits<float>::infinity(), big.get<float>());
+}
 
+// long double sums are not kept exact, but take the same policies
+TEST_F(DeterministicReduceTest, LongDouble)
+{
+  const RAJA::Index_type n = 1000;
+  RAJA::ReduceSum<RAJA::seq_reduce_deterministic, long double> seq_sum(0.5L);
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, n),
+                               [=](RAJA::Index_type i) { seq_sum += i; });
+  ASSERT_EQ(0.5L + n * (n - 1) / 2, seq_sum.get());
+
+#if defined(RAJA_ENABLE_OPENMP)
+  RAJA::ReduceSum<RAJA::omp_reduce_deterministic, long double> omp_sum(0.5L);
+  RAJA::forall<RAJA::omp_parallel_for_exec>(
+      RAJA::RangeSegment(0, n), [=](RAJA::Index_type i) { omp_sum += i; });
+  ASSERT_EQ(0.5L + n * (n - 1) / 2, omp_sum.get());
+#endif
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST_F(DeterministicReduceTest, OpenMP)
+{
+  const int max_threads = omp_get_max_threads();
+  for (int nthreads = 1; nthreads <= 7; ++nthreads) {
+    omp_set_num_threads(nthreads);
+    ASSERT_EQ(exact,
+              (sum<RAJA::omp_parallel_for_exec,
+                   RAJA::omp_reduce_deterministic>()));
+    ASSERT_EQ(exact,
+              (sum<RAJA::omp_parallel_for_static<7>,
+                   RAJA::omp_reduce_deterministic>()));
+    ASSERT_EQ(exact,
+              (param_sum<RAJA::omp_parallel_for_exec,
+                         RAJA::omp_reduce_deterministic>()));
+  }
+  omp_set_num_threads(max_threads);
+}
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+TEST_F(DeterministicReduceTest, TBB)
+{
+  for (int nthreads = 1; nthreads <= 4; ++nthreads) {
+    tbb::task_arena arena(nthreads);
+    double result = 0.0;
+    arena.execute([&] {
+      result = sum<RAJA::tbb_for_dynamic, RAJA::tbb_reduce_deterministic>();
+    });
+    ASSERT_EQ(exact, result);
+    arena.execute([&] {
+      result = param_sum<RAJA::tbb_for_dynamic,
+                         RAJA::tbb_reduce_deterministic>();
+    });
+    ASSERT_EQ(exact, result);
+  }
+}
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+//
+// A worker waiting on a nested loop may steal another chunk of the outer
+// loop; both chunks must land in the worker's accumulators.
+//
+TEST(ReduceParamsTBB, NestedLoop)
+{
+  using Sum = RAJA::ReduceSum<RAJA::tbb_reduce, long>;
+  const RAJA::Index_type n = 32, m = 32;
+  // enough workers to steal even on a single core
+  tbb::global_control workers(tbb::global_control::max_allowed_parallelism,
+                              4);
+  for (int nthreads = 2; nthreads <= 4; ++nthreads) {
+    tbb::task_arena arena(nthreads);
+    for (int rep = 0; rep < 3; ++rep) {
+      Sum total(0);
+      arena.execute([&] {
+        RAJA::forall<RAJA::tbb_for_dynamic>(
+            RAJA::RangeSegment(0, n),
+            RAJA::reduce_params(total),
+            [=](RAJA::Index_type i, Sum::param_type& s) {
+              s += i;
+              // slow enough that the worker waits for it
+              RAJA::forall<RAJA::tbb_for_exec>(
+                  RAJA::RangeSegment(0, m), [=](RAJA::Index_type) {
+                    std::this_thread::sleep_for(std::chrono::microseconds(20));
+                  });
+              s += i;
+            });
+      });
+      ASSERT_EQ(n * (n - 1), total.get());
+    }
+  }
+}
+#endif
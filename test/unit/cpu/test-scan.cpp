@@ -14,6 +14,7 @@
 #include <random>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 #include <cstdlib>
 
@@ -216,3 +217,31 @@ REGISTER_TYPED_TEST_CASE_P(Scan,
                            exclusive_inplace_offset);
 
 INSTANTIATE_TYPED_TEST_CASE_P(ScanTests, Scan, CrossTypes);
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(Scan, omp_short_lengths)
+{
+  // lengths below, at, and around the block size and thread count
+  for (int n = 0; n < 70; ++n) {
+    std::vector<int> in(n), out(n), ref(n);
+    std::iota(in.begin(), in.end(), 1);
+
+    std::partial_sum(in.begin(), in.end(), ref.begin());
+    RAJA::inclusive_scan(
+        RAJA::omp_parallel_for_exec{}, in.data(), in.data() + n, out.data());
+    ASSERT_EQ(ref, out);
+
+    int agg = 3;
+    for (int i = 0; i < n; ++i) {
+      ref[i] = agg;
+      agg += in[i];
+    }
+    RAJA::exclusive_scan_inplace(RAJA::omp_parallel_for_exec{},
+                                 in.data(),
+                                 in.data() + n,
+                                 RAJA::operators::plus<int>{},
+                                 3);
+    ASSERT_EQ(ref, in);
+  }
+}
+#endif
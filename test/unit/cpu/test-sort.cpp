@@ -0,0 +1,220 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA CPU sort operations.
+///
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <cstdlib>
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+#include "type_helper.hpp"
+
+// large enough to take the radix path for integral keys
+const int N = 100000;
+
+// number of distinct keys in the key-value tests, so keys repeat
+const int NumKeys = 1000;
+
+// Unit Test Space Exploration
+
+using ExecTypes = std::tuple<RAJA::seq_exec,
+                             RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                             ,
+                             RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                             ,
+                             RAJA::tbb_for_exec
+#endif
+                             >;
+
+using CompareTypes = std::tuple<RAJA::operators::less<int>,
+                                RAJA::operators::greater<int>,
+                                RAJA::operators::less<long long>,
+                                RAJA::operators::greater<unsigned>,
+                                RAJA::operators::less<double>,
+                                RAJA::operators::greater<float>>;
+
+using CrossTypes =
+    ForTesting<typename types::product<ExecTypes, CompareTypes>::type>;
+
+template <typename Tuple>
+struct Info {
+  using exec = typename std::tuple_element<0, Tuple>::type;
+  using function = typename std::tuple_element<1, Tuple>::type;
+  using data_type = typename function::first_argument_type;
+};
+
+template <typename T>
+std::vector<T> make_keys(int n, int range)
+{
+  std::mt19937 gen{static_cast<unsigned>(n)};
+  std::uniform_int_distribution<long long> dist(
+      std::is_signed<T>::value ? -range : 0, range);
+  std::vector<T> keys(n);
+  for (auto& k : keys) {
+    k = static_cast<T>(dist(gen));
+  }
+  return keys;
+}
+
+template <typename Tuple>
+struct Sort : public ::testing::Test {
+};
+
+TYPED_TEST_CASE_P(Sort);
+
+TYPED_TEST_P(Sort, sort)
+{
+  using T = typename Info<TypeParam>::data_type;
+  using Function = typename Info<TypeParam>::function;
+
+  std::vector<T> data = make_keys<T>(N, N);
+  std::vector<T> ref = data;
+  std::sort(ref.begin(), ref.end(), Function{});
+
+  RAJA::sort(typename Info<TypeParam>::exec(),
+             data.data(),
+             data.data() + N,
+             Function{});
+
+  ASSERT_TRUE(data == ref);
+}
+
+TYPED_TEST_P(Sort, stable_sort_container)
+{
+  using T = typename Info<TypeParam>::data_type;
+  using Function = typename Info<TypeParam>::function;
+
+  std::vector<T> data = make_keys<T>(N, N);
+  std::vector<T> ref = data;
+  std::sort(ref.begin(), ref.end(), Function{});
+
+  RAJA::stable_sort(typename Info<TypeParam>::exec(), data, Function{});
+
+  ASSERT_TRUE(data == ref);
+}
+
+TYPED_TEST_P(Sort, sort_pairs)
+{
+  using T = typename Info<TypeParam>::data_type;
+  using Function = typename Info<TypeParam>::function;
+
+  const std::vector<T> orig = make_keys<T>(N, NumKeys);
+  std::vector<T> keys = orig;
+  std::vector<int> vals(N);
+  std::iota(vals.begin(), vals.end(), 0);
+
+  RAJA::sort_pairs(typename Info<TypeParam>::exec(),
+                   keys.data(),
+                   keys.data() + N,
+                   vals.data(),
+                   Function{});
+
+  ASSERT_TRUE(std::is_sorted(keys.begin(), keys.end(), Function{}));
+  std::vector<bool> seen(N, false);
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(keys[i], orig[vals[i]]);
+    ASSERT_FALSE(seen[vals[i]]);
+    seen[vals[i]] = true;
+  }
+}
+
+TYPED_TEST_P(Sort, stable_sort_pairs)
+{
+  using T = typename Info<TypeParam>::data_type;
+  using Function = typename Info<TypeParam>::function;
+
+  const std::vector<T> orig = make_keys<T>(N, NumKeys);
+  std::vector<T> keys = orig;
+  std::vector<int> vals(N);
+  std::iota(vals.begin(), vals.end(), 0);
+
+  RAJA::stable_sort_pairs(
+      typename Info<TypeParam>::exec(), keys, vals, Function{});
+
+  ASSERT_TRUE(std::is_sorted(keys.begin(), keys.end(), Function{}));
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(keys[i], orig[vals[i]]);
+    if (i > 0 && !Function{}(keys[i - 1], keys[i])) {
+      // equal keys keep their original order
+      ASSERT_LT(vals[i - 1], vals[i]);
+    }
+  }
+}
+
+TYPED_TEST_P(Sort, lengths)
+{
+  using T = typename Info<TypeParam>::data_type;
+  using Function = typename Info<TypeParam>::function;
+
+  // empty, tiny, and sizes around the chunking and radix thresholds
+  for (int n : {0, 1, 2, 3, 17, 4095, 4096, 8193, 65535, 65536, 70001}) {
+    const std::vector<T> orig = make_keys<T>(n, 50);
+    std::vector<T> keys = orig;
+    std::vector<int> vals(n);
+    std::iota(vals.begin(), vals.end(), 0);
+
+    RAJA::stable_sort_pairs(
+        typename Info<TypeParam>::exec(), keys, vals, Function{});
+
+    std::vector<T> ref = orig;
+    std::stable_sort(ref.begin(), ref.end(), Function{});
+    ASSERT_TRUE(keys == ref) << "n = " << n;
+    for (int i = 1; i < n; ++i) {
+      if (!Function{}(keys[i - 1], keys[i])) {
+        ASSERT_LT(vals[i - 1], vals[i]) << "n = " << n;
+      }
+    }
+  }
+}
+
+REGISTER_TYPED_TEST_CASE_P(
+    Sort, sort, stable_sort_container, sort_pairs, stable_sort_pairs, lengths);
+
+INSTANTIATE_TYPED_TEST_CASE_P(SortTests, Sort, CrossTypes);
+
+TEST(Sort, stable_custom_compare)
+{
+  // order by the low digit only, so stability is visible on the keys
+  struct by_digit {
+    bool operator()(int a, int b) const { return a % 10 < b % 10; }
+  };
+
+  std::vector<int> data(N);
+  std::iota(data.begin(), data.end(), 0);
+  std::shuffle(data.begin(), data.end(), std::mt19937{42});
+  std::vector<int> ref = data;
+  std::stable_sort(ref.begin(), ref.end(), by_digit{});
+
+  std::vector<int> seq = data;
+  RAJA::stable_sort(RAJA::seq_exec{}, seq, by_digit{});
+  ASSERT_TRUE(seq == ref);
+
+#if defined(RAJA_ENABLE_OPENMP)
+  std::vector<int> omp = data;
+  RAJA::stable_sort(RAJA::omp_parallel_for_exec{}, omp, by_digit{});
+  ASSERT_TRUE(omp == ref);
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+  std::vector<int> tbb = data;
+  RAJA::stable_sort(RAJA::tbb_for_exec{}, tbb, by_digit{});
+  ASSERT_TRUE(tbb == ref);
+#endif
+}
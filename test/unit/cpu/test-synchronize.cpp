@@ -28,3 +28,22 @@ TEST(SynchronizeTest, omp)
 }
 
 #endif
+
+#if defined(RAJA_ENABLE_TBB)
+
+TEST(SynchronizeTest, tbb)
+{
+  int values[100] = {0};
+  int* data = values;
+
+  RAJA::forall<RAJA::tbb_for_dynamic>(RAJA::RangeSegment(0, 100),
+                                      [=](int i) { data[i] = i; });
+
+  RAJA::synchronize<RAJA::tbb_synchronize>();
+
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(values[i], i);
+  }
+}
+
+#endif
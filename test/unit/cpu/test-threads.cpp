@@ -0,0 +1,197 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Tests for the thread pool back end: loops, regions, kernel and
+/// reductions for several pool sizes.
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#if defined(RAJA_ENABLE_THREADS)
+
+class ThreadPoolTest : public ::testing::TestWithParam<int>
+{
+protected:
+  virtual void SetUp()
+  {
+    saved_size = RAJA::thread_pool::get().size();
+    RAJA::thread_pool::get().resize(GetParam());
+  }
+
+  virtual void TearDown() { RAJA::thread_pool::get().resize(saved_size); }
+
+  int saved_size;
+};
+
+TEST_P(ThreadPoolTest, ForallVisitsEachIndexOnce)
+{
+  for (RAJA::Index_type n : {0, 1, 3, 17, 1000, 10007}) {
+    std::vector<int> count(n, 0);
+    int* c = count.data();
+    RAJA::forall<RAJA::threads_for_exec>(RAJA::RangeSegment(0, n),
+                                         [=](RAJA::Index_type i) { ++c[i]; });
+    RAJA::forall<RAJA::threads_for_dynamic<7>>(
+        RAJA::RangeSegment(0, n), [=](RAJA::Index_type i) { ++c[i]; });
+    for (RAJA::Index_type i = 0; i < n; ++i) {
+      ASSERT_EQ(2, count[i]);
+    }
+  }
+}
+
+TEST_P(ThreadPoolTest, NestedForallRunsOnCallingThread)
+{
+  const RAJA::Index_type n = 64;
+  std::vector<int> count(n * n, 0);
+  int* c = count.data();
+  RAJA::forall<RAJA::threads_for_exec>(
+      RAJA::RangeSegment(0, n), [=](RAJA::Index_type i) {
+        RAJA::forall<RAJA::threads_for_exec>(
+            RAJA::RangeSegment(0, n),
+            [=](RAJA::Index_type j) { ++c[i * n + j]; });
+      });
+  for (auto v : count) {
+    ASSERT_EQ(1, v);
+  }
+}
+
+TEST_P(ThreadPoolTest, RegionLoopsAreSeparatedByBarriers)
+{
+  const RAJA::Index_type n = 5000;
+  std::vector<int> a(n, 0), b(n, 0), d(n, 0);
+  int* pa = a.data();
+  int* pb = b.data();
+  int* pd = d.data();
+
+  std::atomic<int> bodies{0};
+  std::atomic<int>* pbodies = &bodies;
+  RAJA::region<RAJA::threads_region>([=]() {
+    pbodies->fetch_add(1);
+    RAJA::forall<RAJA::threads_for_exec>(
+        RAJA::RangeSegment(0, n), [=](RAJA::Index_type i) { pa[i] = 1; });
+    // reads values written by other threads in the previous loop
+    RAJA::forall<RAJA::threads_for_dynamic<16>>(
+        RAJA::RangeSegment(0, n),
+        [=](RAJA::Index_type i) { pb[i] = pa[n - 1 - i] + 1; });
+    RAJA::forall<RAJA::threads_for_dynamic<3>>(
+        RAJA::RangeSegment(0, n),
+        [=](RAJA::Index_type i) { pd[i] = pb[n - 1 - i] + 1; });
+  });
+
+  ASSERT_EQ(GetParam(), bodies.load());
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    ASSERT_EQ(1, a[i]);
+    ASSERT_EQ(2, b[i]);
+    ASSERT_EQ(3, d[i]);
+  }
+}
+
+TEST_P(ThreadPoolTest, NestedRegionHasItsOwnCounters)
+{
+  const RAJA::Index_type n = 100000;
+  const int team = GetParam();
+  std::atomic<long> count{0};
+  std::atomic<long>* pcount = &count;
+  RAJA::region<RAJA::threads_region>([=]() {
+    // runs on each thread of the outer region as a team of one
+    RAJA::region<RAJA::threads_region>([=]() {
+      RAJA::forall<RAJA::threads_for_dynamic<64>>(
+          RAJA::RangeSegment(0, n),
+          [=](RAJA::Index_type) { pcount->fetch_add(1); });
+    });
+  });
+  ASSERT_EQ(team * n, count.load());
+}
+
+TEST_P(ThreadPoolTest, RegionsFromSeveralHostThreads)
+{
+  const RAJA::Index_type n = 10000;
+  const int nregions = 200;
+  std::atomic<long> counts[2];
+  auto host = [&](int t) {
+    counts[t].store(0);
+    std::atomic<long>* pcount = &counts[t];
+    for (int r = 0; r < nregions; ++r) {
+      RAJA::region<RAJA::threads_region>([=]() {
+        RAJA::forall<RAJA::threads_for_dynamic<16>>(
+            RAJA::RangeSegment(0, n),
+            [=](RAJA::Index_type) { pcount->fetch_add(1); });
+        RAJA::forall<RAJA::threads_for_exec>(
+            RAJA::RangeSegment(0, n),
+            [=](RAJA::Index_type) { pcount->fetch_add(1); });
+      });
+    }
+  };
+  std::thread other(host, 1);
+  host(0);
+  other.join();
+  ASSERT_EQ(2 * nregions * n, counts[0].load());
+  ASSERT_EQ(2 * nregions * n, counts[1].load());
+}
+
+TEST_P(ThreadPoolTest, Reductions)
+{
+  const RAJA::Index_type n = 10000;
+  RAJA::ReduceSum<RAJA::threads_reduce, long> sum(0);
+  RAJA::ReduceMaxLoc<RAJA::threads_reduce, long> maxloc(-1, -1);
+  RAJA::forall<RAJA::threads_for_exec>(RAJA::RangeSegment(0, n),
+                                       [=](RAJA::Index_type i) {
+                                         sum += i;
+                                         maxloc.maxloc(i % 100, i);
+                                       });
+  ASSERT_EQ(n * (n - 1) / 2, sum.get());
+  ASSERT_EQ(99, maxloc.get());
+  ASSERT_EQ(99, maxloc.getLoc());
+
+  using Sum = RAJA::ReduceSum<RAJA::threads_reduce, long>;
+  Sum psum(0);
+  RAJA::forall<RAJA::threads_for_dynamic<32>>(
+      RAJA::RangeSegment(0, n),
+      RAJA::reduce_params(psum),
+      [=](RAJA::Index_type i, Sum::param_type& s) { s += i; });
+  ASSERT_EQ(n * (n - 1) / 2, psum.get());
+
+  Sum rsum(0);
+  RAJA::region<RAJA::threads_region>([=]() {
+    RAJA::forall<RAJA::threads_for_exec>(RAJA::RangeSegment(0, n),
+                                         [=](RAJA::Index_type) {
+                                           rsum += 1;
+                                         });
+  });
+  ASSERT_EQ(n, rsum.get());
+}
+
+TEST_P(ThreadPoolTest, Kernel)
+{
+  const RAJA::Index_type n = 100;
+  std::vector<int> count(n * n, 0);
+  int* c = count.data();
+
+  using Pol = RAJA::KernelPolicy<RAJA::statement::For<
+      1,
+      RAJA::threads_for_exec,
+      RAJA::statement::For<0, RAJA::seq_exec, RAJA::statement::Lambda<0>>>>;
+  RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, n),
+                                     RAJA::RangeSegment(0, n)),
+                    [=](RAJA::Index_type i, RAJA::Index_type j) {
+                      ++c[j * n + i];
+                    });
+  for (auto v : count) {
+    ASSERT_EQ(1, v);
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(PoolSizes,
+                        ThreadPoolTest,
+                        ::testing::Values(1, 2, 3, 8));
+
+#endif
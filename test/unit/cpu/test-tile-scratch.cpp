@@ -0,0 +1,306 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Tests for the per-thread TileScratch arena and for the cpu_tile_mem
+/// LocalArrays that InitLocalMem takes from it.
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
+
+static bool aligned(const void* ptr)
+{
+  return reinterpret_cast<std::uintptr_t>(ptr) % RAJA::TileScratch::alignment
+         == 0;
+}
+
+TEST(TileScratch, AlignedAndReleasedInOrder)
+{
+  RAJA::TileScratch scratch;
+  RAJA::TileScratch::mark_type m = scratch.mark();
+  char* a = scratch.allocate<char>(3);
+  double* b = scratch.allocate<double>(100);
+  EXPECT_TRUE(aligned(a));
+  EXPECT_TRUE(aligned(b));
+  EXPECT_GE(reinterpret_cast<char*>(b) - a, 3);
+
+  RAJA::TileScratch::mark_type mb = scratch.mark();
+  double* c = scratch.allocate<double>(10);
+  scratch.release(mb);
+  EXPECT_EQ(c, scratch.allocate<double>(10));
+
+  scratch.release(m);
+  EXPECT_EQ(scratch.in_use(), 0u);
+  EXPECT_EQ(a, scratch.allocate<char>(3));
+  scratch.release(m);
+}
+
+TEST(TileScratch, GrowsWithoutMovingBuffers)
+{
+  RAJA::TileScratch scratch;
+  {
+    RAJA::TileScratchScope scope(scratch);
+    double* small = scratch.allocate<double>(16);
+    small[0] = 1.0;
+    // larger than the first block, and than a thread's stack
+    const size_t n = size_t(4) << 20;
+    double* big = scratch.allocate<double>(n);
+    EXPECT_TRUE(aligned(big));
+    big[0] = 2.0;
+    big[n - 1] = 3.0;
+    EXPECT_EQ(small[0], 1.0);
+    EXPECT_GE(scratch.capacity(), n * sizeof(double));
+  }
+  EXPECT_EQ(scratch.in_use(), 0u);
+
+  // released blocks are merged, so the same buffers fit in one
+  const size_t held = scratch.capacity();
+  RAJA::TileScratchScope scope(scratch);
+  scratch.allocate<double>(16);
+  scratch.allocate<double>(size_t(4) << 20);
+  EXPECT_EQ(scratch.capacity(), held);
+  EXPECT_THROW(scratch.trim(), std::runtime_error);
+}
+
+TEST(TileScratch, Padding)
+{
+  const size_t saved = RAJA::TileScratch::padding();
+  RAJA::TileScratch::set_padding(100);
+  EXPECT_EQ(RAJA::TileScratch::padding(), 128u);
+
+  RAJA::TileScratch scratch;
+  RAJA::TileScratchScope scope(scratch);
+  char* a = scratch.allocate<char>(4096);
+  char* b = scratch.allocate<char>(4096);
+  EXPECT_EQ(b - a, 4096 + 128);
+
+  RAJA::TileScratch::set_padding(saved);
+}
+
+TEST(TileScratch, DoubleBuffer)
+{
+  const int ntiles = 5, tile = 8;
+  std::vector<int> sums;
+  RAJA::TileScratch& scratch = RAJA::TileScratch::this_thread();
+  {
+    RAJA::TileDoubleBuffer<int> buf(tile);
+    EXPECT_NE(buf.current(), buf.next());
+    int* first = buf.current();
+
+    auto load = [&](int* t, int k) {
+      for (int i = 0; i < tile; ++i) {
+        t[i] = k * tile + i;
+      }
+    };
+    load(buf.current(), 0);
+    for (int k = 0; k < ntiles; ++k) {
+      if (k + 1 < ntiles) load(buf.next(), k + 1);
+      int sum = 0;
+      for (int i = 0; i < tile; ++i) {
+        sum += buf.current()[i];
+      }
+      sums.push_back(sum);
+      buf.swap();
+    }
+    // after an odd number of tiles the first buffer is next
+    EXPECT_EQ(buf.next(), first);
+  }
+  EXPECT_EQ(scratch.in_use(), 0u);
+
+  for (int k = 0; k < ntiles; ++k) {
+    EXPECT_EQ(sums[k], k * tile * tile + tile * (tile - 1) / 2);
+  }
+}
+
+using tile_t =
+    RAJA::LocalArray<double, RAJA::Perm<0, 1>, RAJA::SizeList<16, 16>>;
+
+template <typename ExecPolicy>
+using TransposePol = RAJA::KernelPolicy<RAJA::statement::Tile<
+    1,
+    RAJA::statement::tile_fixed<16>,
+    ExecPolicy,
+    RAJA::statement::Tile<
+        0,
+        RAJA::statement::tile_fixed<16>,
+        RAJA::loop_exec,
+        RAJA::statement::InitLocalMem<
+            RAJA::cpu_tile_mem,
+            RAJA::ParamList<2>,
+            RAJA::statement::ForICount<
+                1,
+                RAJA::statement::Param<0>,
+                RAJA::loop_exec,
+                RAJA::statement::ForICount<0,
+                                           RAJA::statement::Param<1>,
+                                           RAJA::loop_exec,
+                                           RAJA::statement::Lambda<0>>>,
+            RAJA::statement::ForICount<
+                0,
+                RAJA::statement::Param<1>,
+                RAJA::loop_exec,
+                RAJA::statement::ForICount<1,
+                                           RAJA::statement::Param<0>,
+                                           RAJA::loop_exec,
+                                           RAJA::statement::Lambda<1>>>>>>>;
+
+template <typename ExecPolicy>
+static void transpose(RAJA::Index_type nr,
+                      RAJA::Index_type nc,
+                      std::set<const double*>* tiles)
+{
+  std::vector<double> a(nr * nc), at(nr * nc, -1.0);
+  for (RAJA::Index_type i = 0; i < nr * nc; ++i) {
+    a[i] = static_cast<double>(i);
+  }
+  RAJA::View<double, RAJA::Layout<2>> av(a.data(), nr, nc);
+  RAJA::View<double, RAJA::Layout<2>> atv(at.data(), nc, nr);
+
+  RAJA::kernel_param<TransposePol<ExecPolicy>>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, nc), RAJA::RangeSegment(0, nr)),
+      RAJA::make_tuple(RAJA::Index_type(0), RAJA::Index_type(0), tile_t()),
+      [=](RAJA::Index_type c,
+          RAJA::Index_type r,
+          RAJA::Index_type tr,
+          RAJA::Index_type tc,
+          tile_t& t) {
+        if (tiles != nullptr) tiles->insert(&t(0, 0));
+        t(tr, tc) = av(r, c);
+      },
+      [=](RAJA::Index_type c,
+          RAJA::Index_type r,
+          RAJA::Index_type tr,
+          RAJA::Index_type tc,
+          tile_t& t) { atv(c, r) = t(tr, tc); });
+
+  for (RAJA::Index_type r = 0; r < nr; ++r) {
+    for (RAJA::Index_type c = 0; c < nc; ++c) {
+      ASSERT_EQ(atv(c, r), av(r, c));
+    }
+  }
+}
+
+TEST(InitLocalMem, ReusesOneAlignedTile)
+{
+  std::set<const double*> tiles;
+  transpose<RAJA::seq_exec>(40, 50, &tiles);
+  ASSERT_EQ(tiles.size(), 1u);
+  EXPECT_TRUE(aligned(*tiles.begin()));
+  EXPECT_EQ(RAJA::TileScratch::this_thread().in_use(), 0u);
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(InitLocalMem, OpenMP)
+{
+  transpose<RAJA::omp_parallel_for_exec>(70, 90, nullptr);
+}
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+TEST(InitLocalMem, TBB)
+{
+  transpose<RAJA::tbb_for_exec>(70, 90, nullptr);
+}
+#endif
+
+TEST(InitLocalMem, NestedArrays)
+{
+  using outer_t = RAJA::LocalArray<int, RAJA::Perm<0>, RAJA::SizeList<3>>;
+  using inner_t = RAJA::LocalArray<int, RAJA::Perm<0>, RAJA::SizeList<5>>;
+  using pol = RAJA::KernelPolicy<RAJA::statement::InitLocalMem<
+      RAJA::cpu_tile_mem,
+      RAJA::ParamList<0>,
+      RAJA::statement::For<
+          0,
+          RAJA::seq_exec,
+          RAJA::statement::InitLocalMem<RAJA::cpu_tile_mem,
+                                        RAJA::ParamList<1>,
+                                        RAJA::statement::Lambda<0>>>>>;
+
+  std::set<const int*> outer, inner;
+  std::set<const int*>* po = &outer;
+  std::set<const int*>* pi = &inner;
+  RAJA::kernel_param<pol>(RAJA::make_tuple(RAJA::RangeSegment(0, 4)),
+                          RAJA::make_tuple(outer_t(), inner_t()),
+                          [=](int i, outer_t& o, inner_t& in) {
+                            o(i % 3) = i;
+                            in(4) = i;
+                            po->insert(&o(0));
+                            pi->insert(&in(0));
+                          });
+  ASSERT_EQ(outer.size(), 1u);
+  ASSERT_EQ(inner.size(), 1u);
+  EXPECT_GE(*inner.begin() - *outer.begin(), 3);
+  EXPECT_EQ(RAJA::TileScratch::this_thread().in_use(), 0u);
+}
+
+struct counted {
+  static int live;
+  int value = 7;
+  counted() { ++live; }
+  ~counted() { --live; }
+};
+int counted::live = 0;
+
+TEST(InitLocalMem, ConstructsAndDestroysElements)
+{
+  using array_t = RAJA::LocalArray<counted, RAJA::Perm<0>, RAJA::SizeList<6>>;
+  using pol = RAJA::KernelPolicy<
+      RAJA::statement::InitLocalMem<RAJA::cpu_tile_mem,
+                                    RAJA::ParamList<0>,
+                                    RAJA::statement::Lambda<0>>>;
+  int seen = 0, value = 0;
+  int* pseen = &seen;
+  int* pvalue = &value;
+  RAJA::kernel_param<pol>(RAJA::make_tuple(RAJA::RangeSegment(0, 1)),
+                          RAJA::make_tuple(array_t()),
+                          [=](int, array_t& a) {
+                            *pseen = counted::live;
+                            *pvalue = a(5).value;
+                          });
+  EXPECT_EQ(seen, 6);
+  EXPECT_EQ(value, 7);
+  EXPECT_EQ(counted::live, 0);
+}
+
+TEST(InitLocalMem, TileLargerThanStack)
+{
+  // 8 MiB, as large as a default thread stack
+  using big_t =
+      RAJA::LocalArray<double, RAJA::Perm<0, 1>, RAJA::SizeList<1024, 1024>>;
+  using pol = RAJA::KernelPolicy<RAJA::statement::InitLocalMem<
+      RAJA::cpu_tile_mem,
+      RAJA::ParamList<0>,
+      RAJA::statement::For<0, RAJA::seq_exec, RAJA::statement::Lambda<0>>,
+      RAJA::statement::For<0, RAJA::seq_exec, RAJA::statement::Lambda<1>>>>;
+
+  double sum = 0.0;
+  double* psum = &sum;
+  std::thread worker([=]() {
+    RAJA::kernel_param<pol>(
+        RAJA::make_tuple(RAJA::RangeSegment(0, 1024)),
+        RAJA::make_tuple(big_t()),
+        [=](int i, big_t& t) {
+          for (int j = 0; j < 1024; ++j) {
+            t(i, j) = 1.0;
+          }
+        },
+        [=](int i, big_t& t) {
+          for (int j = 0; j < 1024; ++j) {
+            *psum += t(j, i);
+          }
+        });
+  });
+  worker.join();
+  EXPECT_EQ(sum, 1024.0 * 1024.0);
+}
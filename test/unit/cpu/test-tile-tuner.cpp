@@ -0,0 +1,212 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Tests for run-time tile sizes (statement::tile_dynamic) and for the
+/// TileTuner that picks them and caches them on disk.
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using TileDynamicPol = RAJA::KernelPolicy<RAJA::statement::Tile<
+    1,
+    RAJA::statement::tile_dynamic<0>,
+    RAJA::seq_exec,
+    RAJA::statement::Tile<
+        0,
+        RAJA::statement::tile_dynamic<1>,
+        RAJA::loop_exec,
+        RAJA::statement::For<
+            1,
+            RAJA::loop_exec,
+            RAJA::statement::For<0,
+                                 RAJA::loop_exec,
+                                 RAJA::statement::Lambda<0>>>>>>;
+
+TEST(TileDynamic, VisitsEachPointOnce)
+{
+  const RAJA::Index_type ni = 37, nj = 23;
+  for (RAJA::Index_type ti : {1, 4, 16, 100}) {
+    for (RAJA::Index_type tj : {1, 5, 23}) {
+      std::vector<int> count(ni * nj, 0);
+      int* c = count.data();
+      RAJA::kernel_param<TileDynamicPol>(
+          RAJA::make_tuple(RAJA::RangeSegment(0, ni),
+                           RAJA::RangeSegment(0, nj)),
+          RAJA::make_tuple(tj, ti),
+          [=](RAJA::Index_type i, RAJA::Index_type j, RAJA::Index_type,
+              RAJA::Index_type) { ++c[j * ni + i]; });
+      for (auto v : count) {
+        ASSERT_EQ(1, v);
+      }
+    }
+  }
+}
+
+TEST(TileDynamic, TileTCount)
+{
+  using Pol = RAJA::KernelPolicy<RAJA::statement::TileTCount<
+      0,
+      RAJA::statement::Param<1>,
+      RAJA::statement::tile_dynamic<0>,
+      RAJA::seq_exec,
+      RAJA::statement::For<0, RAJA::seq_exec, RAJA::statement::Lambda<0>>>>;
+
+  const RAJA::Index_type n = 10;
+  std::vector<RAJA::Index_type> tile_of(n, -1);
+  RAJA::Index_type* t = tile_of.data();
+  RAJA::kernel_param<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, n)),
+                          RAJA::make_tuple(RAJA::Index_type(4),
+                                           RAJA::Index_type(0)),
+                          [=](RAJA::Index_type i,
+                              RAJA::Index_type,
+                              RAJA::Index_type tile) { t[i] = tile; });
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    ASSERT_EQ(i / 4, tile_of[i]);
+  }
+}
+
+TEST(TileDynamic, RejectsNonPositiveSize)
+{
+  ASSERT_ANY_THROW(RAJA::kernel_param<TileDynamicPol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, 8), RAJA::RangeSegment(0, 8)),
+      RAJA::make_tuple(RAJA::Index_type(0), RAJA::Index_type(4)),
+      [=](RAJA::Index_type, RAJA::Index_type, RAJA::Index_type,
+          RAJA::Index_type) {}));
+}
+
+class TileTunerTest : public ::testing::Test
+{
+protected:
+  virtual void SetUp()
+  {
+    RAJA::TileTuner& tuner = RAJA::TileTuner::getInstance();
+    saved_file = tuner.cache_file();
+    saved_tuning = tuner.tuning();
+    path = ::testing::TempDir() + "raja_tile_cache_test.txt";
+    std::remove(path.c_str());
+    tuner.clear();
+    tuner.set_cache_file(path);
+  }
+
+  virtual void TearDown()
+  {
+    RAJA::TileTuner& tuner = RAJA::TileTuner::getInstance();
+    tuner.clear();
+    tuner.set_cache_file(saved_file);
+    tuner.set_tuning(saved_tuning);
+    std::remove(path.c_str());
+  }
+
+  std::string path;
+  std::string saved_file;
+  bool saved_tuning;
+};
+
+TEST_F(TileTunerTest, UntunedUsesFirstCandidate)
+{
+  RAJA::TileTuner& tuner = RAJA::TileTuner::getInstance();
+  tuner.set_tuning(false);
+  int runs = 0;
+  RAJA::Index_type tile = tuner.select(
+      "untuned", {100}, {16, 32}, [&](RAJA::Index_type) { ++runs; });
+  ASSERT_EQ(16, tile);
+  ASSERT_EQ(0, runs);
+  ASSERT_FALSE(tuner.lookup("untuned", {100}, tile));
+}
+
+TEST_F(TileTunerTest, TunesSavesAndReloads)
+{
+  RAJA::TileTuner& tuner = RAJA::TileTuner::getInstance();
+  tuner.set_tuning(true);
+
+  // the work done grows with the distance from a tile size of 32
+  auto run = [](RAJA::Index_type tile) {
+    const long ratio = tile > 32 ? tile / 32 : 32 / tile;
+    const long work = 100000 * ratio * ratio;
+    volatile long sink = 0;
+    for (long k = 0; k < work; ++k) {
+      sink = sink + k;
+    }
+  };
+  ASSERT_EQ(32, tuner.select("smooth", {64, 64}, {8, 16, 32, 64, 128}, run));
+
+  // another shape is tuned separately
+  RAJA::Index_type tile = 0;
+  ASSERT_FALSE(tuner.lookup("smooth", {128, 64}, tile));
+
+  // a later run reads the size from the file without timing anything
+  tuner.clear();
+  tuner.set_tuning(false);
+  ASSERT_TRUE(tuner.load(path));
+  int runs = 0;
+  tile = tuner.select("smooth", {64, 64}, {8, 16}, [&](RAJA::Index_type) {
+    ++runs;
+  });
+  ASSERT_EQ(32, tile);
+  ASSERT_EQ(0, runs);
+}
+
+TEST_F(TileTunerTest, SaveKeepsOtherEntries)
+{
+  {
+    std::ofstream out(path);
+    out << "# comment\nother-machine jacobi 10x10 7\n";
+  }
+  RAJA::TileTuner& tuner = RAJA::TileTuner::getInstance();
+  tuner.store("jacobi", {10, 10}, 12);
+  ASSERT_TRUE(tuner.save(path));
+
+  tuner.clear();
+  ASSERT_TRUE(tuner.load(path));
+  RAJA::Index_type tile = 0;
+  ASSERT_TRUE(tuner.lookup("jacobi", {10, 10}, tile));
+  ASSERT_EQ(12, tile);
+
+  std::ifstream in(path);
+  std::string text((std::istreambuf_iterator<char>(in)),
+                   std::istreambuf_iterator<char>());
+  ASSERT_NE(std::string::npos, text.find("other-machine jacobi 10x10 7"));
+}
+
+// savers that share a cache file, like MPI ranks, write separate temporaries
+TEST_F(TileTunerTest, ConcurrentSaves)
+{
+  const std::string tmp = RAJA::detail::tile_cache_temp(path);
+  ASSERT_EQ(0u, tmp.find(path + ".tmp."));
+  ASSERT_NE(path + ".tmp", tmp);
+
+  RAJA::TileTuner& tuner = RAJA::TileTuner::getInstance();
+  tuner.store("halo", {8}, 4);
+  std::atomic<int> failed{0};
+  std::vector<std::thread> savers;
+  for (int t = 0; t < 4; ++t) {
+    savers.emplace_back([&]() {
+      for (int k = 0; k < 50; ++k) {
+        if (!tuner.save(path)) ++failed;
+      }
+    });
+  }
+  for (auto& s : savers) {
+    s.join();
+  }
+  ASSERT_EQ(0, failed.load());
+
+  tuner.clear();
+  ASSERT_TRUE(tuner.load(path));
+  RAJA::Index_type tile = 0;
+  ASSERT_TRUE(tuner.lookup("halo", {8}, tile));
+  ASSERT_EQ(4, tile);
+}
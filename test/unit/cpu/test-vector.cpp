@@ -0,0 +1,253 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for simd_register, vector_exec and View
+/// access through vector indices.
+///
+
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+
+#include "gtest/gtest.h"
+
+template <typename T>
+class VectorTest : public ::testing::Test
+{
+};
+
+// (value type, width): native AVX2/AVX-512 shapes and odd portable ones
+template <typename T, camp::idx_t W>
+struct vector_params {
+  using value_type = T;
+  static constexpr camp::idx_t width = W;
+};
+
+using VectorTypes = ::testing::Types<vector_params<double, 4>,
+                                     vector_params<double, 8>,
+                                     vector_params<float, 8>,
+                                     vector_params<float, 16>,
+                                     vector_params<double, 3>,
+                                     vector_params<int, 4>>;
+
+TYPED_TEST_CASE(VectorTest, VectorTypes);
+
+TYPED_TEST(VectorTest, RegisterMaskedLoadStore)
+{
+  using T = typename TypeParam::value_type;
+  constexpr camp::idx_t W = TypeParam::width;
+  using reg = RAJA::simd_register<T, W>;
+
+  T in[W];
+  for (camp::idx_t k = 0; k < W; ++k) {
+    in[k] = static_cast<T>(k + 1);
+  }
+
+  for (camp::idx_t n = 1; n <= W; ++n) {
+    reg a = reg::load(in, n);
+    for (camp::idx_t k = 0; k < W; ++k) {
+      ASSERT_EQ(a[k], k < n ? in[k] : T(0));
+    }
+    ASSERT_EQ(a.sum(n), static_cast<T>(n * (n + 1) / 2));
+    ASSERT_EQ(a.max(n), static_cast<T>(n));
+    ASSERT_EQ(a.min(n), T(1));
+
+    T out[W + 1];
+    for (camp::idx_t k = 0; k <= W; ++k) {
+      out[k] = T(-1);
+    }
+    (a * T(2) + reg(T(1))).store(out, n);
+    for (camp::idx_t k = 0; k <= W; ++k) {
+      ASSERT_EQ(out[k], k < n ? 2 * in[k] + 1 : T(-1));
+    }
+  }
+}
+
+TYPED_TEST(VectorTest, RegisterGatherScatter)
+{
+  using T = typename TypeParam::value_type;
+  constexpr camp::idx_t W = TypeParam::width;
+  using reg = RAJA::simd_register<T, W>;
+
+  std::vector<T> data(4 * W);
+  for (size_t k = 0; k < data.size(); ++k) {
+    data[k] = static_cast<T>(k);
+  }
+
+  RAJA::Index_type off[W];
+  for (camp::idx_t k = 0; k < W; ++k) {
+    off[k] = 4 * W - 1 - 3 * k;
+  }
+
+  for (camp::idx_t n = 1; n <= W; ++n) {
+    reg g = reg::gather(data.data(), off, n);
+    for (camp::idx_t k = 0; k < W; ++k) {
+      ASSERT_EQ(g[k], k < n ? data[off[k]] : T(0));
+    }
+
+    reg s = reg::load_strided(data.data() + 1, 3, n);
+    for (camp::idx_t k = 0; k < n; ++k) {
+      ASSERT_EQ(s[k], data[1 + 3 * k]);
+    }
+
+    std::vector<T> out(4 * W, T(-1));
+    g.scatter(out.data(), off, n);
+    for (camp::idx_t k = 0; k < W; ++k) {
+      ASSERT_EQ(out[off[k]], k < n ? data[off[k]] : T(-1));
+    }
+  }
+}
+
+TYPED_TEST(VectorTest, RegisterArithmetic)
+{
+  using T = typename TypeParam::value_type;
+  constexpr camp::idx_t W = TypeParam::width;
+  using reg = RAJA::simd_register<T, W>;
+
+  T a_in[W], b_in[W];
+  for (camp::idx_t k = 0; k < W; ++k) {
+    a_in[k] = static_cast<T>(2 * k + 2);
+    b_in[k] = static_cast<T>(W - k);
+  }
+  reg a = reg::load(a_in);
+  reg b = reg::load(b_in);
+
+  reg sum = a + b;
+  reg diff = a - b;
+  reg quot = a / reg(T(2));
+  reg fused = RAJA::vfma(a, b, reg(T(1)));
+  reg lo = RAJA::vmin(a, b);
+  reg hi = RAJA::vmax(a, b);
+  reg neg = -a;
+  for (camp::idx_t k = 0; k < W; ++k) {
+    ASSERT_EQ(sum[k], a_in[k] + b_in[k]);
+    ASSERT_EQ(diff[k], a_in[k] - b_in[k]);
+    ASSERT_EQ(quot[k], a_in[k] / T(2));
+    ASSERT_EQ(fused[k], a_in[k] * b_in[k] + T(1));
+    ASSERT_EQ(lo[k], a_in[k] < b_in[k] ? a_in[k] : b_in[k]);
+    ASSERT_EQ(hi[k], a_in[k] < b_in[k] ? b_in[k] : a_in[k]);
+    ASSERT_EQ(neg[k], -a_in[k]);
+  }
+}
+
+TYPED_TEST(VectorTest, ForallView)
+{
+  using T = typename TypeParam::value_type;
+  constexpr camp::idx_t W = TypeParam::width;
+  using view = RAJA::View<T, RAJA::Layout<1>>;
+  using vindex = RAJA::vector_index<RAJA::Index_type, W>;
+
+  // sizes below, at and above multiples of the width
+  for (RAJA::Index_type n : {RAJA::Index_type(1),
+                             RAJA::Index_type(W - 1),
+                             RAJA::Index_type(W),
+                             RAJA::Index_type(3 * W + 1),
+                             RAJA::Index_type(100)}) {
+    if (n < 1) continue;
+    std::vector<T> x_data(n + 2), y_data(n + 2, T(7));
+    for (RAJA::Index_type i = 0; i < n + 2; ++i) {
+      x_data[i] = static_cast<T>(i);
+    }
+    view x(x_data.data(), n + 2);
+    view y(y_data.data(), n + 2);
+
+    RAJA::ReduceSum<RAJA::seq_reduce, T> total(T(0));
+    RAJA::forall<RAJA::vector_exec<W>>(
+        RAJA::RangeSegment(1, n + 1), [=](vindex i) {
+          y(i) = T(2) * x(i) + x(i + 1) - x(i - 1);
+          y(i) += T(1);
+          total += x(i).load().sum(i.size());
+        });
+
+    ASSERT_EQ(y_data[0], T(7));
+    ASSERT_EQ(y_data[n + 1], T(7));
+    for (RAJA::Index_type i = 1; i <= n; ++i) {
+      ASSERT_EQ(y_data[i], static_cast<T>(2 * i + 3));
+    }
+    ASSERT_EQ(total.get(), static_cast<T>(n * (n + 1) / 2));
+  }
+}
+
+TEST(Vector, StridedView)
+{
+  constexpr camp::idx_t W = 4;
+  const RAJA::Index_type N = 11;
+  const RAJA::Index_type M = 6;
+  std::vector<double> a_data(N * M), t_data(N * M, -1.0);
+  for (RAJA::Index_type k = 0; k < N * M; ++k) {
+    a_data[k] = static_cast<double>(k);
+  }
+  RAJA::View<double, RAJA::Layout<2>> a(a_data.data(), N, M);
+  RAJA::View<double, RAJA::Layout<2>> t(t_data.data(), M, N);
+
+  // vector index on the outer dimension of a: gathered, then contiguous
+  // stores into t
+  for (RAJA::Index_type j = 0; j < M; ++j) {
+    RAJA::forall<RAJA::vector_exec<W>>(
+        RAJA::RangeSegment(0, N),
+        [=](RAJA::vector_index<RAJA::Index_type, W> i) { t(j, i) = a(i, j); });
+  }
+
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    for (RAJA::Index_type j = 0; j < M; ++j) {
+      ASSERT_EQ(t_data[i + N * j], a_data[j + M * i]);
+    }
+  }
+}
+
+TEST(Vector, NonRangeSegment)
+{
+  constexpr camp::idx_t W = 4;
+  std::vector<RAJA::Index_type> idx = {9, 2, 5, 0, 7};
+  std::vector<int> data(10, 0);
+  RAJA::View<int, RAJA::Layout<1>> v(data.data(), 10);
+
+  RAJA::forall<RAJA::vector_exec<W>>(
+      RAJA::ListSegment(idx.data(), idx.size()),
+      [=](RAJA::vector_index<RAJA::Index_type, W> i) {
+        EXPECT_EQ(i.size(), 1);
+        v(i) += 1;
+      });
+
+  for (int k = 0; k < 10; ++k) {
+    ASSERT_EQ(data[k], (k == 9 || k == 2 || k == 5 || k == 0 || k == 7));
+  }
+}
+
+TYPED_TEST(VectorTest, ReduceMinMaxLoc)
+{
+  using T = typename TypeParam::value_type;
+  constexpr camp::idx_t W = TypeParam::width;
+  using view = RAJA::View<T, RAJA::Layout<1>>;
+  using vindex = RAJA::vector_index<RAJA::Index_type, W>;
+
+  // extremes repeat every 17 elements, so several lanes see the same value
+  const RAJA::Index_type n = 10 * W + 3;
+  std::vector<T> x_data(n);
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    x_data[i] = static_cast<T>(i % 17 == 5 ? -3 : (i % 17 == 9 ? 40 : i % 7));
+  }
+  view x(x_data.data(), n);
+
+  RAJA::ReduceMinLoc<RAJA::seq_reduce, T> minloc(T(100), -1);
+  RAJA::ReduceMaxLoc<RAJA::seq_reduce, T> maxloc(T(-100), -1);
+  RAJA::forall<RAJA::vector_exec<W>>(RAJA::RangeSegment(0, n),
+                                     [=](vindex i) {
+                                       minloc.minloc(x(i), i);
+                                       maxloc.maxloc(x(i), i);
+                                     });
+
+  ASSERT_EQ(minloc.get(), T(-3));
+  ASSERT_EQ(minloc.getLoc(), 5);
+  ASSERT_EQ(maxloc.get(), T(40));
+  ASSERT_EQ(maxloc.getLoc(), 9);
+
+  // scalar and vector updates combine into the same result
+  minloc.minloc(T(-3), 2);
+  ASSERT_EQ(minloc.getLoc(), 2);
+}
@@ -281,6 +281,18 @@ INSTANTIATE_TYPED_TEST_CASE_P(OpenMP, Kernel, OMPTypes);
 using TBBTypes = ::testing::Types<
     list<KernelPolicy<For<1, RAJA::tbb_for_exec, For<0, s, Lambda<0>>>>,
          list<TypedIndex, Index_type>,
+         RAJA::tbb_reduce>,
+    list<KernelPolicy<
+             statement::Tile<1,
+                             statement::tile_fixed<2>,
+                             RAJA::tbb_for_exec,
+                             For<1, RAJA::loop_exec, For<0, s, Lambda<0>>>>>,
+         list<TypedIndex, Index_type>,
+         RAJA::tbb_reduce>,
+    list<KernelPolicy<statement::Collapse<RAJA::tbb_collapse_exec,
+                                         ArgList<0, 1>,
+                                         Lambda<0>>>,
+         list<Index_type, Index_type>,
          RAJA::tbb_reduce>>;
 INSTANTIATE_TYPED_TEST_CASE_P(TBB, Kernel, TBBTypes);
 #endif
@@ -1297,8 +1309,227 @@ TEST(Kernel, Collapse8)
   delete[] data;
 }
 
+template <typename CollapsePol>
+void testOmpCollapse4()
+{
+  int N = 5;
+  int M = 3;
+  int K = 7;
+  int P = 11;
+
+  int *data = new int[N * M * K * P];
+  for (int i = 0; i < N * M * K * P; ++i) {
+    data[i] = 0;
+  }
+
+  using Pol = RAJA::KernelPolicy<RAJA::statement::
+                                     Collapse<CollapsePol,
+                                              ArgList<0, 1, 2, 3>,
+                                              Lambda<0>>>;
+
+  RAJA::kernel<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, K),
+                       RAJA::RangeSegment(0, M),
+                       RAJA::RangeSegment(0, N),
+                       RAJA::RangeSegment(0, P)),
+      [=](Index_type k, Index_type j, Index_type i, Index_type r) {
+        Index_type id = r + P * (i + N * (j + M * k));
+        data[id] += id;
+      });
+
+  for (int id = 0; id < N * M * K * P; ++id) {
+    ASSERT_EQ(data[id], id);
+  }
+
+  delete[] data;
+}
+
+TEST(Kernel, Collapse4D)
+{
+  testOmpCollapse4<RAJA::omp_parallel_collapse_exec>();
+  testOmpCollapse4<RAJA::omp_parallel_collapse_static<0>>();
+  testOmpCollapse4<RAJA::omp_parallel_collapse_static<4>>();
+  testOmpCollapse4<RAJA::omp_parallel_collapse_static<1000>>();
+  testOmpCollapse4<RAJA::omp_parallel_collapse_dynamic<>>();
+  testOmpCollapse4<RAJA::omp_parallel_collapse_dynamic<13>>();
+}
+
+TEST(Kernel, Collapse5D)
+{
+  int N = 4;
+  int M = 3;
+  int K = 2;
+  int P = 5;
+  int Q = 9;
+
+  int *data = new int[N * M * K * P * Q];
+  for (int i = 0; i < N * M * K * P * Q; ++i) {
+    data[i] = 0;
+  }
+
+  // collapse in an order other than the tuple order, zero-sized loops skip
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::omp_parallel_collapse_dynamic<6>,
+                                ArgList<4, 2, 0, 3, 1>,
+                                Lambda<0>>>;
+
+  RAJA::kernel<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, N),
+                       RAJA::RangeSegment(0, M),
+                       RAJA::RangeSegment(0, K),
+                       RAJA::RangeSegment(0, P),
+                       RAJA::RangeSegment(0, Q)),
+      [=](Index_type n, Index_type m, Index_type k, Index_type p,
+          Index_type q) {
+        Index_type id = q + Q * (p + P * (k + K * (m + M * n)));
+        data[id] += id;
+      });
+
+  for (int id = 0; id < N * M * K * P * Q; ++id) {
+    ASSERT_EQ(data[id], id);
+  }
+
+  RAJA::kernel<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, N),
+                       RAJA::RangeSegment(0, M),
+                       RAJA::RangeSegment(0, 0),
+                       RAJA::RangeSegment(0, P),
+                       RAJA::RangeSegment(0, Q)),
+      [=](Index_type, Index_type, Index_type, Index_type, Index_type) {
+        data[0] = -1;
+      });
+  ASSERT_EQ(data[0], 0);
+
+  delete[] data;
+}
+
 #endif  // RAJA_ENABLE_OPENMP
 
+#if defined(RAJA_ENABLE_TBB)
+
+TEST(Kernel, TBBCollapse2)
+{
+  int N = 37;
+  int M = 29;
+
+  int *data = new int[N * M];
+  for (int i = 0; i < M * N; ++i) {
+    data[i] = -1;
+  }
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::
+          Collapse<RAJA::tbb_collapse_exec, ArgList<1, 0>, Lambda<0>>>;
+
+  RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, N),
+                                     RAJA::RangeSegment(0, M)),
+
+                    [=](Index_type i, Index_type j) { data[i + j * N] = i; });
+
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < M; ++j) {
+      ASSERT_EQ(data[i + j * N], i);
+    }
+  }
+
+  delete[] data;
+}
+
+TEST(Kernel, TBBCollapse3)
+{
+  int N = 17;
+  int M = 5;
+  int K = 3;
+
+  int *data = new int[N * M * K];
+  for (int i = 0; i < M * N * K; ++i) {
+    data[i] = 0;
+  }
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::tbb_collapse_exec,
+                                ArgList<0, 1, 2>,
+                                Lambda<0>>>;
+
+  RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, K),
+                                     RAJA::RangeSegment(0, M),
+                                     RAJA::RangeSegment(0, N)),
+                    [=](Index_type k, Index_type j, Index_type i) {
+                      data[i + N * (j + M * k)] += i + N * (j + M * k);
+                    });
+
+  for (int k = 0; k < K; k++) {
+    for (int j = 0; j < M; ++j) {
+      for (int i = 0; i < N; ++i) {
+        int id = i + N * (j + M * k);
+        ASSERT_EQ(data[id], id);
+      }
+    }
+  }
+
+  delete[] data;
+}
+
+TEST(Kernel, TBBTileCollapse)
+{
+  int N = 50;
+  int M = 13;
+  int K = 9;
+
+  int *data = new int[N * M * K];
+  for (int i = 0; i < M * N * K; ++i) {
+    data[i] = 0;
+  }
+
+  // tiles that do not divide the extents, and a 2-deep nest below
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::tbb_tile_collapse_exec<4, 16>,
+                                ArgList<2, 0>,
+                                For<1, RAJA::loop_exec, Lambda<0>>>>;
+
+  RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, N),
+                                     RAJA::RangeSegment(0, M),
+                                     RAJA::RangeSegment(0, K)),
+                    [=](Index_type i, Index_type j, Index_type k) {
+                      data[i + N * (j + M * k)] += i + N * (j + M * k);
+                    });
+
+  for (int id = 0; id < N * M * K; ++id) {
+    ASSERT_EQ(data[id], id);
+  }
+
+  delete[] data;
+}
+
+TEST(Kernel, TBBTile)
+{
+  using namespace RAJA;
+
+  constexpr int N = 23;
+  int *x = new int[N * N];
+  for (int i = 0; i < N * N; ++i) {
+    x[i] = 0;
+  }
+
+  using Inner = For<1, loop_exec, For<0, loop_exec, Lambda<0>>>;
+  using Pol = KernelPolicy<statement::Tile<
+      1,
+      statement::tile_fixed<4>,
+      tbb_for_exec,
+      statement::Tile<0, statement::tile_fixed<8>, tbb_for_dynamic, Inner>>>;
+
+  kernel<Pol>(RAJA::make_tuple(RangeSegment(0, N), RangeSegment(0, N)),
+              [=](Index_type i, Index_type j) { x[i + N * j] += 1; });
+
+  for (int i = 0; i < N * N; ++i) {
+    ASSERT_EQ(x[i], 1);
+  }
+
+  delete[] x;
+}
+
+#endif  // RAJA_ENABLE_TBB
+
 
 
 
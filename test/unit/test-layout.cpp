@@ -12,6 +12,10 @@
 #include "RAJA/RAJA.hpp"
 #include "gtest/gtest.h"
 
+#include <cstdint>
+#include <limits>
+#include <vector>
+
 RAJA_INDEX_VALUE(TestIndex1D, "TestIndex1D");
 
 RAJA_INDEX_VALUE(TIX, "TIX");
@@ -464,3 +468,112 @@ TEST(LayoutTest, 4D_PermutedStaticLayout)
   }
 }
 
+
+TEST(LayoutTest, 3D_StaticLayoutToIndices)
+{
+  using static_layout = RAJA::StaticLayout<RAJA::PERM_JKI, 7, 13, 5>;
+  static_layout layout;
+
+  for (int i = 0; i < 7; ++i) {
+    for (int j = 0; j < 13; ++j) {
+      for (int k = 0; k < 5; ++k) {
+        int ii, jj, kk;
+        layout.toIndices(layout(i, j, k), ii, jj, kk);
+        ASSERT_EQ(i, ii);
+        ASSERT_EQ(j, jj);
+        ASSERT_EQ(k, kk);
+      }
+    }
+  }
+}
+
+TEST(LayoutTest, PermutedLayoutStrideOne)
+{
+  auto dynamic_layout = RAJA::make_permuted_layout(
+      {{7, 13, 5}}, RAJA::as_array<RAJA::PERM_KIJ>::get());
+  auto layout = RAJA::make_permuted_layout<RAJA::PERM_KIJ>({{7, 13, 5}});
+
+  static_assert(decltype(layout)::stride1_dim == 1,
+                "stride-1 dimension is the last one in the permutation");
+  for (int i = 0; i < 7; ++i) {
+    for (int j = 0; j < 13; ++j) {
+      for (int k = 0; k < 5; ++k) {
+        ASSERT_EQ(dynamic_layout(i, j, k), layout(i, j, k));
+      }
+    }
+  }
+}
+
+TEST(LayoutTest, FastDivide)
+{
+  // divisors around powers of two and a few large ones
+  std::vector<std::uint64_t> divisors;
+  for (int b = 0; b < 63; ++b) {
+    const std::uint64_t p = std::uint64_t(1) << b;
+    divisors.push_back(p);
+    divisors.push_back(p + 1);
+    if (p > 2) divisors.push_back(p - 1);
+  }
+  divisors.push_back(3);
+  divisors.push_back(7);
+  divisors.push_back(1000003);
+  divisors.push_back((std::uint64_t(1) << 63) - 25);
+
+  const std::int64_t max = std::numeric_limits<std::int64_t>::max();
+  for (std::uint64_t d : divisors) {
+    RAJA::detail::fast_divider div(d);
+    const std::int64_t sd = static_cast<std::int64_t>(d);
+    for (std::int64_t n : {std::int64_t(0),
+                           std::int64_t(1),
+                           sd - 1,
+                           sd,
+                           sd + 1,
+                           2 * sd - 1,
+                           std::int64_t(123456789),
+                           max / 3,
+                           max - sd,
+                           max - 1,
+                           max}) {
+      if (n < 0) continue;
+      ASSERT_EQ(n / sd, div.divide(n)) << n << " / " << d;
+    }
+  }
+}
+
+// the toIndices dividers live in LayoutDecoder, not in every Layout and View
+static_assert(sizeof(RAJA::Layout<3>) == 4 * 3 * sizeof(RAJA::Index_type),
+              "a Layout holds only sizes, strides and their inverses");
+static_assert(sizeof(RAJA::Layout<1, int>) == 4 * sizeof(int),
+              "a Layout holds only sizes, strides and their inverses");
+
+TEST(LayoutTest, 3D_LayoutDecoder)
+{
+  const auto layout = RAJA::make_permuted_layout(
+      {{7, 0, 5}}, RAJA::as_array<RAJA::PERM_KIJ>::get());
+  const RAJA::LayoutDecoder<3> decoder(layout);
+  for (RAJA::Index_type lin = 0; lin < layout.size(); ++lin) {
+    RAJA::Index_type i, j, k, di, dj, dk;
+    layout.toIndices(lin, i, j, k);
+    decoder.toIndices(lin, di, dj, dk);
+    ASSERT_EQ(i, di);
+    ASSERT_EQ(j, dj);
+    ASSERT_EQ(k, dk);
+  }
+}
+
+TEST(LayoutTest, 4D_ToIndicesLarge)
+{
+  // a layout spanning more than 2^32 elements
+  RAJA::Layout<4> layout(1000, 3, 70001, 257);
+  const auto decoder = RAJA::make_layout_decoder(layout);
+  const RAJA::Index_type size = layout.size();
+  for (RAJA::Index_type lin = 0; lin < size; lin += size / 9973 + 1) {
+    RAJA::Index_type i, j, k, l;
+    decoder.toIndices(lin, i, j, k, l);
+    ASSERT_EQ(lin / (3 * 70001 * 257), i);
+    ASSERT_EQ(lin / (70001 * 257) % 3, j);
+    ASSERT_EQ(lin / 257 % 70001, k);
+    ASSERT_EQ(lin % 257, l);
+    ASSERT_EQ(lin, layout(i, j, k, l));
+  }
+}
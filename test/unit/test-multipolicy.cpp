@@ -9,7 +9,10 @@
 /// Source file containing tests for basic multipolicy operation
 ///
 
+#include <chrono>
 #include <cstddef>
+#include <thread>
+#include <vector>
 #include "gtest/gtest.h"
 
 // Tag type to dispatch to test bodies based on policy selected by multipolicy
@@ -50,9 +53,22 @@ void forall_impl(const mp_tag<i> &p, Iterable &&iter, mp_test_body const &body)
 {
   body(p, iter.size());
 }
+
+// mock policy taking ms milliseconds per launch, for AutoTunedPolicy tests
+template <int ms>
+struct sleep_tag {
+};
+
+template <int ms, typename Iterable, typename Body>
+void forall_impl(const sleep_tag<ms> &, Iterable &&, Body &&body)
+{
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+  body(ms);
+}
 }  // namespace test_policy
 
 using test_policy::mp_tag;
+using test_policy::sleep_tag;
 
 // NOTE: this *must* be after the above to work
 #include "RAJA/RAJA.hpp"
@@ -101,3 +117,92 @@ TEST(MultiPolicy, invalid_index)
       });
   ASSERT_THROW(make_invalid_index_throw(mp, seg), std::runtime_error);
 }
+
+TEST(MultiPolicy, selector_called_once)
+{
+  int calls = 0;
+  auto mp = RAJA::make_multi_policy<RAJA::seq_exec, RAJA::loop_exec>(
+      [&](const RAJA::RangeSegment &) {
+        ++calls;
+        return 1;
+      });
+  RAJA::forall(mp, RAJA::RangeSegment(0, 10), [](RAJA::Index_type) {});
+  ASSERT_EQ(calls, 1);
+}
+
+TEST(AutoTunedPolicy, locks_in_fastest)
+{
+  using tuned = RAJA::AutoTunedPolicy<sleep_tag<6>, sleep_tag<1>, sleep_tag<3>>;
+  std::vector<int> runs(7, 0);
+  auto body = [&](int ms) { ++runs[ms]; };
+
+  // 2 samples of each candidate, then the 1 ms policy only
+  for (int i = 0; i < 6; ++i) {
+    ASSERT_EQ(tuned::selected(body, 10), -1);
+    RAJA::forall(tuned(2), RAJA::RangeSegment(0, 10), body);
+  }
+  ASSERT_EQ(tuned::selected(body, 10), 1);
+  ASSERT_EQ(runs[6], 2);
+  ASSERT_EQ(runs[3], 2);
+  ASSERT_EQ(runs[1], 2);
+
+  for (int i = 0; i < 4; ++i) {
+    RAJA::forall(tuned(2), RAJA::RangeSegment(0, 10), body);
+  }
+  ASSERT_EQ(runs[1], 6);
+
+  // same bucket, different size
+  ASSERT_EQ(tuned::selected(body, 15), 1);
+  // other buckets are tuned on their own
+  ASSERT_EQ(tuned::selected(body, 1000), -1);
+  ASSERT_EQ(tuned::selected(body, 0), -1);
+}
+
+TEST(AutoTunedPolicy, resamples)
+{
+  using tuned = RAJA::AutoTunedPolicy<sleep_tag<3>, sleep_tag<1>>;
+  std::vector<int> runs(4, 0);
+  auto body = [&](int ms) { ++runs[ms]; };
+
+  for (int i = 0; i < 2; ++i) {
+    RAJA::forall(tuned(1, 3), RAJA::RangeSegment(0, 10), body);
+  }
+  ASSERT_EQ(tuned::selected(body, 10), 1);
+
+  // the third launch after locking in samples again
+  for (int i = 0; i < 2; ++i) {
+    RAJA::forall(tuned(1, 3), RAJA::RangeSegment(0, 10), body);
+  }
+  ASSERT_EQ(tuned::selected(body, 10), 1);
+  RAJA::forall(tuned(1, 3), RAJA::RangeSegment(0, 10), body);
+  ASSERT_EQ(tuned::selected(body, 10), -1);
+  RAJA::forall(tuned(1, 3), RAJA::RangeSegment(0, 10), body);
+  ASSERT_EQ(tuned::selected(body, 10), 1);
+  ASSERT_EQ(runs[3], 2);
+}
+
+TEST(AutoTunedPolicy, host_policies)
+{
+  using tuned = RAJA::AutoTunedPolicy<RAJA::seq_exec,
+                                      RAJA::simd_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                      ,
+                                      RAJA::omp_parallel_for_static<64>
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                      ,
+                                      RAJA::tbb_for_dynamic
+#endif
+                                      >;
+
+  const int n = 10000;
+  std::vector<double> x(n, 0.0);
+  double *data = x.data();
+  for (int rep = 0; rep < 20; ++rep) {
+    RAJA::forall<tuned>(RAJA::RangeSegment(0, n),
+                        [=](RAJA::Index_type i) { data[i] += 1.0; });
+  }
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(x[i], 20.0);
+  }
+}
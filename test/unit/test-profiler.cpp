@@ -0,0 +1,223 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-19, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the region profiler and launch hooks
+///
+
+#include "gtest/gtest.h"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// count of region name in a report
+static int occurrences(const std::string& report, const std::string& name)
+{
+  int n = 0;
+  for (auto pos = report.find(name); pos != std::string::npos;
+       pos = report.find(name, pos + 1)) {
+    ++n;
+  }
+  return n;
+}
+
+TEST(ProfilerTest, NestedRegions)
+{
+  RAJA::Profiler& p = RAJA::Profiler::getInstance();
+  p.reset();
+
+  for (int i = 0; i < 3; ++i) {
+    RAJA::ProfileRegion outer("outer");
+    for (int j = 0; j < 2; ++j) {
+      RAJA::ProfileRegion inner("inner");
+    }
+  }
+
+  std::ostringstream flat;
+  p.report(flat);
+  const std::string s = flat.str();
+  EXPECT_EQ(occurrences(s, "outer/inner\n"), 1);
+
+  std::ostringstream json;
+  p.report(json, RAJA::Profiler::format::json);
+  const std::string j = json.str();
+  EXPECT_NE(j.find("{\"name\": \"outer\", \"kind\": \"region\", \"count\": 3"),
+            std::string::npos);
+  EXPECT_NE(j.find("{\"name\": \"inner\", \"kind\": \"region\", \"count\": 6"),
+            std::string::npos);
+}
+
+TEST(ProfilerTest, MismatchedEnd)
+{
+  RAJA::Profiler& p = RAJA::Profiler::getInstance();
+  p.begin("open");
+  EXPECT_THROW(p.end("other"), std::runtime_error);
+  p.end("open");
+  EXPECT_THROW(p.end("open"), std::runtime_error);
+}
+
+TEST(ProfilerTest, ReusedNameBuffer)
+{
+  RAJA::Profiler& p = RAJA::Profiler::getInstance();
+  p.reset();
+
+  char name[16];
+  std::strcpy(name, "halo");
+  p.begin(name);
+  p.end(name);
+  std::strcpy(name, "interior");
+  p.begin(name);
+  EXPECT_NO_THROW(p.end(name));
+
+  std::ostringstream flat;
+  p.report(flat);
+  const std::string s = flat.str();
+  EXPECT_EQ(occurrences(s, "halo\n"), 1);
+  EXPECT_EQ(occurrences(s, "interior\n"), 1);
+}
+
+TEST(ProfilerTest, LaunchTiming)
+{
+  RAJA::Profiler& p = RAJA::Profiler::getInstance();
+  p.reset();
+  p.time_launches(true);
+
+  std::vector<int> a(100, 0);
+  int* data = a.data();
+  {
+    RAJA::ProfileRegion region("launches");
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 100),
+                                 [=](int i) { data[i] += 1; });
+    RAJA::forall<RAJA::loop_exec>(RAJA::RangeSegment(0, 100),
+                                  [=](int i) { data[i] += 1; });
+
+    using pol = RAJA::KernelPolicy<RAJA::statement::For<
+        1,
+        RAJA::seq_exec,
+        RAJA::statement::For<0, RAJA::seq_exec, RAJA::statement::Lambda<0>>>>;
+    RAJA::kernel<pol>(RAJA::make_tuple(RAJA::RangeSegment(0, 10),
+                                       RAJA::RangeSegment(0, 10)),
+                      [=](int i, int j) { data[i + 10 * j] += 1; });
+  }
+
+  p.time_launches(false);
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 100),
+                               [=](int i) { data[i] += 1; });
+
+  for (int v : a) {
+    ASSERT_EQ(v, 4);
+  }
+
+  std::ostringstream json;
+  p.report(json, RAJA::Profiler::format::json);
+  const std::string j = json.str();
+  EXPECT_NE(j.find("{\"name\": \"forall<RAJA::policy::sequential::seq_exec>\", "
+                   "\"kind\": \"forall\", \"count\": 1"),
+            std::string::npos)
+      << j;
+  EXPECT_NE(j.find("forall<RAJA::policy::loop::loop_exec>"), std::string::npos);
+  EXPECT_NE(j.find("\"kind\": \"kernel\", \"count\": 1"), std::string::npos);
+}
+
+TEST(ProfilerTest, LaunchSignatureCopies)
+{
+  RAJA::Profiler& p = RAJA::Profiler::getInstance();
+  p.reset();
+  p.time_launches(true);
+
+  // the begin and end hooks may see different copies of the signature
+  const char* sig = RAJA::util::detail::policy_signature<RAJA::seq_exec>();
+  const std::string copy(sig);
+  const RAJA::util::launch_info first{RAJA::util::launch_kind::forall, sig};
+  const RAJA::util::launch_info other{RAJA::util::launch_kind::forall,
+                                      copy.c_str()};
+  auto launch = [](const RAJA::util::launch_info& pre,
+                   const RAJA::util::launch_info& post) {
+    for (auto& e : RAJA::util::detail::get_launch_hooks().entries) {
+      if (e.active && e.pre) e.pre(pre, e.user_data);
+    }
+    for (auto& e : RAJA::util::detail::get_launch_hooks().entries) {
+      if (e.active && e.post) e.post(post, e.user_data);
+    }
+  };
+
+  p.begin("outer");
+  launch(first, other);
+  launch(other, first);
+  EXPECT_NO_THROW(p.end("outer"));
+  p.time_launches(false);
+
+  std::ostringstream json;
+  p.report(json, RAJA::Profiler::format::json);
+  const std::string j = json.str();
+  EXPECT_EQ(occurrences(j, "forall<RAJA::policy::sequential::seq_exec>"), 1)
+      << j;
+  EXPECT_NE(j.find("{\"name\": \"forall<RAJA::policy::sequential::seq_exec>\", "
+                   "\"kind\": \"forall\", \"count\": 2"),
+            std::string::npos)
+      << j;
+}
+
+TEST(ProfilerTest, LaunchHooks)
+{
+  struct counts {
+    int pre = 0;
+    int post = 0;
+    const char* policy = nullptr;
+  } c;
+
+  auto pre = [](const RAJA::util::launch_info& info, void* data) {
+    auto* c = static_cast<counts*>(data);
+    ++c->pre;
+    c->policy = info.policy;
+  };
+  auto post = [](const RAJA::util::launch_info&, void* data) {
+    ++static_cast<counts*>(data)->post;
+  };
+
+  const int id = RAJA::util::add_launch_hooks(pre, post, &c);
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+  iset.push_back(RAJA::RangeSegment(0, 10));
+  RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      iset, [](int) {});
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 10), [](int) {});
+  RAJA::util::remove_launch_hooks(id);
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 10), [](int) {});
+
+  EXPECT_EQ(c.pre, 2);
+  EXPECT_EQ(c.post, 2);
+  EXPECT_EQ(RAJA::util::launch_policy_name(c.policy),
+            "RAJA::policy::sequential::seq_exec");
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(ProfilerTest, ThreadMerge)
+{
+  RAJA::Profiler& p = RAJA::Profiler::getInstance();
+  p.reset();
+
+  const int nthreads = omp_get_max_threads();
+#pragma omp parallel num_threads(nthreads)
+  {
+    RAJA::ProfileRegion region("parallel");
+  }
+
+  std::ostringstream json;
+  p.report(json, RAJA::Profiler::format::json);
+  std::ostringstream expected;
+  expected << "{\"name\": \"parallel\", \"kind\": \"region\", \"count\": "
+           << nthreads;
+  EXPECT_NE(json.str().find(expected.str()), std::string::npos);
+  std::ostringstream threads;
+  threads << "\"threads\": " << nthreads;
+  EXPECT_NE(json.str().find(threads.str()), std::string::npos);
+}
+#endif
@@ -53,4 +53,9 @@ TEST(Region, basic_Functions)
 #if defined(RAJA_ENABLE_OPENMP)
   testRegionPol<RAJA::omp_parallel_region, RAJA::omp_for_exec>();
 #endif
+
+#if defined(RAJA_ENABLE_TBB)
+  testRegionPol<RAJA::tbb_region, RAJA::tbb_for_exec>();
+  testRegionPol<RAJA::tbb_region, RAJA::tbb_for_dynamic>();
+#endif
 }